@@ -0,0 +1,126 @@
+#ifndef INCLUDED_BENCH_BINARY_IO_H
+#define INCLUDED_BENCH_BINARY_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>		// remove, snprintf
+#include <fstream>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/binary_io.h"
+#include "../Declaration/mapped_file.h"
+
+namespace MySTL
+{
+	namespace BenchBinaryIO
+	{
+		using namespace MySTL::Benchmark;
+
+		const char bench_file[] = "binary_io_bench.bin";
+
+		// the element by element text output this format replaces
+		template <typename T>
+		inline double save_text(const MySTL::vector<T> &v)
+		{
+			timer t;
+			{
+				std::ofstream os(bench_file);
+				for (auto it = v.begin(); it != v.end(); ++it)
+					os << *it << '\n';
+			}
+			return t.elapsed_ms();
+		}
+
+		template <typename Container>
+		inline double save(const Container &c)
+		{
+			timer t;
+			{
+				std::ofstream os(bench_file, std::ios::binary | std::ios::trunc);
+				save_binary(os, c);
+			}
+			return t.elapsed_ms();
+		}
+
+		template <typename Container>
+		inline double load(Container &c)
+		{
+			timer t;
+			std::ifstream is(bench_file, std::ios::binary);
+			load_binary(is, c);
+			return t.elapsed_ms();
+		}
+
+		inline void bench_all()
+		{
+			print_header("binary_io");
+			const std::size_t n = 32 * 1024 * 1024;	// 256 MB of uint64_t
+			const double gb = n * sizeof(std::uint64_t) / (1024.0 * 1024 * 1024);
+			MySTL::vector<std::uint64_t> values;
+			values.reserve(n);
+			for (std::size_t i = 0; i != n; ++i)
+				values.push_back(i * 2654435761ULL);
+
+			std::cout << "-----\t vector<uint64_t>, " << n << " elements" << '\n';
+			print_row("operator<< text, 1/8 of it", gb / 8 / (save_text(MySTL::vector<std::uint64_t>(values.begin(), values.begin() + n / 8)) / 1000.0), "GB/s");
+			print_row("save_binary", gb / (save(values) / 1000.0), "GB/s");
+			MySTL::vector<std::uint64_t> loaded;
+			print_row("load_binary", gb / (load(loaded) / 1000.0), "GB/s");
+			do_not_optimize(loaded[n - 1]);
+			{
+				// zero copy: map the file, check the header, sum the elements in place
+				timer t;
+				mapped_file file;
+				file.open(bench_file, false);
+				span<const std::uint64_t> view = view_binary_array<std::uint64_t>(file.data(), file.size());
+				std::uint64_t sum = 0;
+				for (std::size_t i = 0; i != view.size(); ++i)
+					sum += view[i];
+				do_not_optimize(sum);
+				print_row("mapped_file + view_binary_array, summed", gb / (t.elapsed_ms() / 1000.0), "GB/s");
+			}
+			{
+				timer t;
+				mapped_file file;
+				file.open(bench_file, false);
+				span<const std::uint64_t> view = view_binary_array<std::uint64_t>(file.data(), file.size());
+				do_not_optimize(view.size());
+				print_row("mapped_file + view_binary_array, open only", t.elapsed_ms(), "ms");
+			}
+
+			const std::size_t strings = 2 * 1000 * 1000;
+			MySTL::vector<MySTL::string> words;
+			words.reserve(strings);
+			char buf[32];
+			std::size_t chars = 0;
+			for (std::size_t i = 0; i != strings; ++i)
+			{
+				const int len = std::snprintf(buf, sizeof(buf), "word-%zu", i * 7919);
+				words.emplace_back(buf, static_cast<std::size_t>(len));
+				chars += static_cast<std::size_t>(len);
+			}
+			const double string_gb = (chars + (strings + 1) * sizeof(std::uint64_t)) / (1024.0 * 1024 * 1024);
+			std::cout << "-----\t vector<string>, " << strings << " strings" << '\n';
+			print_row("save_binary", string_gb / (save(words) / 1000.0), "GB/s");
+			MySTL::vector<MySTL::string> words2;
+			print_row("load_binary", string_gb / (load(words2) / 1000.0), "GB/s");
+			{
+				timer t;
+				mapped_file file;
+				file.open(bench_file, false);
+				string_table_view table = view_binary_string_table(file.data(), file.size());
+				std::size_t total = 0;
+				for (std::size_t i = 0; i != table.size(); ++i)
+					total += table[i].size();
+				do_not_optimize(total);
+				print_row("mapped_file + view_binary_string_table", string_gb / (t.elapsed_ms() / 1000.0), "GB/s");
+			}
+
+			std::remove(bench_file);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef INCLUDED_BENCH_BIT_VECTOR_H
+#define INCLUDED_BENCH_BIT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchBitVector
+	{
+		using namespace MySTL::Benchmark;
+
+		// the layout vector<bool> had before it was packed: one byte per flag
+		typedef MySTL::vector<unsigned char> bytes;
+		typedef MySTL::vector<bool> bits;
+
+		inline std::uint64_t next(std::uint64_t &x)
+		{
+			x ^= x << 13; x ^= x >> 7; x ^= x << 17;	// xorshift
+			return x;
+		}
+
+		inline void bench_all()
+		{
+			print_header("vector<bool> packed vs one byte per flag");
+			const std::size_t n = 256 * 1024 * 1024;
+			std::uint64_t seed = 88172645463325252ULL;
+
+			bytes a8(n, 0), b8(n, 0);
+			bits a1(n), b1(n);
+			for (std::size_t i = 0; i < n; i += 1 + next(seed) % 64)		// about 3% set
+				a8[i] = 1, a1[i] = true;
+			for (std::size_t i = 0; i < n; i += 1 + next(seed) % 16)		// about 12% set
+				b8[i] = 1, b1[i] = true;
+			std::cout << "-----\t " << n << " flags" << '\n';
+			print_row("memory, bytes", n / (1024.0 * 1024), "MB");
+			print_row("memory, packed", a1.word_count() * sizeof(bits::word_type) / (1024.0 * 1024), "MB");
+
+			std::cout << "-----\t count" << '\n';
+			{
+				timer t;
+				std::size_t c = 0;
+				for (std::size_t i = 0; i != n; ++i)
+					c += a8[i];
+				do_not_optimize(c);
+				print_row("bytes, loop", t.elapsed_ms(), "ms");
+			}
+			{
+				timer t;
+				do_not_optimize(a1.count());
+				print_row("packed, popcnt", t.elapsed_ms(), "ms");
+			}
+
+			std::cout << "-----\t visit every set flag" << '\n';
+			{
+				timer t;
+				std::size_t sum = 0;
+				for (std::size_t i = 0; i != n; ++i)
+					if (a8[i])
+						sum += i;
+				do_not_optimize(sum);
+				print_row("bytes, loop", t.elapsed_ms(), "ms");
+			}
+			{
+				timer t;
+				std::size_t sum = 0;
+				for (std::size_t i = a1.find_first(); i != bits::npos; i = a1.find_next(i))
+					sum += i;
+				do_not_optimize(sum);
+				print_row("packed, find_first / find_next", t.elapsed_ms(), "ms");
+			}
+
+			std::cout << "-----\t set a range of n / 2 flags" << '\n';
+			{
+				timer t;
+				for (std::size_t i = n / 4; i != n / 4 * 3; ++i)
+					a8[i] = 1;
+				do_not_optimize(a8[n / 2]);
+				print_row("bytes, loop", t.elapsed_ms(), "ms");
+			}
+			{
+				timer t;
+				for (std::size_t i = n / 4; i != n / 4 * 3; ++i)
+					a1[i] = true;
+				do_not_optimize(a1.words()[0]);
+				print_row("packed, bit by bit", t.elapsed_ms(), "ms");
+			}
+			{
+				timer t;
+				a1.set(n / 4, n / 4 * 3);
+				do_not_optimize(a1.words()[0]);
+				print_row("packed, set(first, last)", t.elapsed_ms(), "ms");
+			}
+
+			std::cout << "-----\t a &= b, a |= b, a ^= b" << '\n';
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					a8[i] &= b8[i];
+				for (std::size_t i = 0; i != n; ++i)
+					a8[i] |= b8[i];
+				for (std::size_t i = 0; i != n; ++i)
+					a8[i] ^= b8[i];
+				do_not_optimize(a8[0]);
+				print_row("bytes, loop", t.elapsed_ms(), "ms");
+			}
+			{
+				timer t;
+				a1 &= b1;
+				a1 |= b1;
+				a1 ^= b1;
+				do_not_optimize(a1.words()[0]);
+				print_row("packed, word-wise", t.elapsed_ms(), "ms");
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef INCLUDED_BENCH_COMMON_H
+#define INCLUDED_BENCH_COMMON_H
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <cstddef>
+
+#include "../Declaration/allocator.h"
+
+namespace MySTL
+{
+	namespace Benchmark
+	{
+		// wall clock stopwatch
+		class timer
+		{
+		public:
+			timer() : start(std::chrono::steady_clock::now()) {}
+
+			void reset() { start = std::chrono::steady_clock::now(); }
+
+			double elapsed_ms() const
+			{
+				return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			}
+
+		private:
+			std::chrono::steady_clock::time_point start;
+		};
+
+		// keep the optimizer from discarding a result we only compute for timing:
+		// publish its address and read it through a volatile lvalue
+		template <typename T>
+		inline void do_not_optimize(const T &value)
+		{
+			static const void * volatile sink = nullptr;
+			static volatile unsigned char byte = 0;
+			sink = &value;
+			byte = *reinterpret_cast<const volatile unsigned char*>(&value);
+		}
+
+		// bytes held by counting_allocator, the high-water mark and the number of allocations
+		struct allocation_stats
+		{
+			static std::size_t &current() { static std::size_t bytes = 0; return bytes; }
+			static std::size_t &peak() { static std::size_t bytes = 0; return bytes; }
+			static std::size_t &count() { static std::size_t n = 0; return n; }
+			static void reset() { current() = peak() = count() = 0; }
+		};
+
+		template <typename T>
+		class counting_allocator : public MySTL::allocator<T>
+		{
+		public:
+			static T* allocate(std::size_t n)
+			{
+				allocation_stats::current() += n * sizeof(T);
+				if (allocation_stats::current() > allocation_stats::peak())
+					allocation_stats::peak() = allocation_stats::current();
+				++allocation_stats::count();
+				return MySTL::allocator<T>::allocate(n);
+			}
+
+			static void deallocate(T *p, std::size_t n)
+			{
+				allocation_stats::current() -= n * sizeof(T);
+				MySTL::allocator<T>::deallocate(p, n);
+			}
+		};
+
+		inline void print_header(const char *name)
+		{
+			std::cout << "==========bench " << name << "==========" << std::endl;
+		}
+
+		inline void print_row(const char *label, double value, const char *unit)
+		{
+			std::cout << std::left << std::setw(40) << label
+				<< std::right << std::setw(14) << std::fixed << std::setprecision(2) << value
+				<< ' ' << unit << std::endl;
+		}
+	}
+}
+
+#endif
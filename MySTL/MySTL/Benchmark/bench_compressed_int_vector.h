@@ -0,0 +1,125 @@
+#ifndef INCLUDED_BENCH_COMPRESSED_INT_VECTOR_H
+#define INCLUDED_BENCH_COMPRESSED_INT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>	// std::lower_bound
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/compressed_int_vector.h"
+
+namespace MySTL
+{
+	namespace BenchCompressedIntVector
+	{
+		using namespace MySTL::Benchmark;
+
+		inline std::uint64_t next(std::uint64_t &x)
+		{
+			x ^= x << 13; x ^= x >> 7; x ^= x << 17;	// xorshift
+			return x;
+		}
+
+		// sorted ids with gaps of 1 ~ @max_gap, and a jump of 2^20 every 10000
+		template <typename T>
+		inline void make_ids(MySTL::vector<T> &ids, std::size_t n, std::uint64_t max_gap)
+		{
+			std::uint64_t seed = 88172645463325252ULL;
+			T id = 0;
+			ids.reserve(n);
+			for (std::size_t i = 0; i != n; ++i)
+			{
+				id += static_cast<T>(1 + next(seed) % max_gap + (i % 10000 == 9999 ? 1u << 20 : 0));
+				ids.push_back(id);
+			}
+		}
+
+		template <typename T>
+		inline void run(const char *name, std::size_t n, std::uint64_t max_gap)
+		{
+			MySTL::vector<T> ids;
+			make_ids(ids, n, max_gap);
+			std::cout << "-----\t " << n << ' ' << name << ", gaps 1 ~ " << max_gap << '\n';
+
+			MySTL::compressed_int_vector<T> c;
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					c.push_back(ids[i]);
+				print_row("push_back, compressed", n / t.elapsed_ms() / 1000.0, "M/s");
+			}
+			c.shrink_to_fit();
+			print_row("memory, vector", n * sizeof(T) / (1024.0 * 1024), "MB");
+			print_row("memory, compressed", c.memory_bytes() / (1024.0 * 1024), "MB");
+			print_row("reduction", static_cast<double>(n * sizeof(T)) / c.memory_bytes(), "x");
+
+			const double values = static_cast<double>(n) / 1e6;
+			{
+				timer t;
+				T sum = 0;
+				for (auto it = ids.begin(); it != ids.end(); ++it)
+					sum += *it;
+				do_not_optimize(sum);
+				print_row("sum, vector", values / (t.elapsed_ms() / 1000.0), "M/s");
+			}
+			{
+				timer t;
+				T sum = 0;
+				c.for_each([&sum](T x) { sum += x; });
+				do_not_optimize(sum);
+				print_row("sum, for_each", values / (t.elapsed_ms() / 1000.0), "M/s");
+			}
+			{
+				timer t;
+				T sum = 0;
+				for (auto it = c.begin(); it != c.end(); ++it)
+					sum += *it;
+				do_not_optimize(sum);
+				print_row("sum, iterator", values / (t.elapsed_ms() / 1000.0), "M/s");
+			}
+
+			const std::size_t probes = 1000 * 1000;
+			std::uint64_t seed = 2463534242ULL;
+			{
+				timer t;
+				T sum = 0;
+				for (std::size_t i = 0; i != probes; ++i)
+					sum += c[static_cast<std::size_t>(next(seed) % n)];
+				do_not_optimize(sum);
+				print_row("operator[], compressed", t.elapsed_ms() * 1e6 / probes, "ns");
+			}
+			{
+				const T last = ids[n - 1];
+				T *first = ids.begin(), *end = ids.end();
+				timer t;
+				std::size_t sum = 0;
+				for (std::size_t i = 0; i != probes; ++i)
+					sum += static_cast<std::size_t>(std::lower_bound(first, end, static_cast<T>(next(seed) % last)) - first);
+				do_not_optimize(sum);
+				print_row("lower_bound, vector", t.elapsed_ms() * 1e6 / probes, "ns");
+			}
+			{
+				const T last = ids[n - 1];
+				timer t;
+				std::size_t sum = 0;
+				for (std::size_t i = 0; i != probes; ++i)
+					sum += c.lower_bound(static_cast<T>(next(seed) % last));
+				do_not_optimize(sum);
+				print_row("lower_bound, compressed", t.elapsed_ms() * 1e6 / probes, "ns");
+			}
+		}
+
+		inline void bench_all()
+		{
+			print_header("compressed_int_vector");
+			const std::size_t n = 32 * 1024 * 1024;
+			run<std::uint32_t>("uint32_t", n, 16);
+			run<std::uint32_t>("uint32_t", n, 100);
+			run<std::uint64_t>("uint64_t", n, 16);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef INCLUDED_BENCH_CONCURRENT_VECTOR_H
+#define INCLUDED_BENCH_CONCURRENT_VECTOR_H
+
+#include <cstddef>
+#include <thread>
+#include <mutex>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/concurrent_vector.h"
+
+namespace MySTL
+{
+	namespace BenchConcurrentVector
+	{
+		using namespace MySTL::Benchmark;
+
+		// @threads threads run body(t) at once, returns the wall time in ms
+		template <typename Body>
+		inline double run_threads(std::size_t threads, Body body)
+		{
+			MySTL::vector<std::thread> pool;
+			pool.reserve(threads);	// no allocation while the threads run
+			timer t;
+			for (std::size_t i = 0; i < threads; ++i)
+				pool.push_back(std::thread(body, i));
+			for (auto it = pool.begin(); it != pool.end(); ++it)
+				it->join();
+			return t.elapsed_ms();
+		}
+
+		// @n ints appended by @threads collectors, into one shared container
+		inline void run(std::size_t threads, std::size_t n)
+		{
+			const std::size_t per_thread = n / threads, batch = 64;
+			std::cout << "-----\t " << threads << (threads == 1 ? " thread" : " threads") << '\n';
+			{
+				MySTL::vector<int> v;
+				v.reserve(n);	// reallocation under the lock would not be fair to it
+				std::mutex m;
+				const double ms = run_threads(threads, [&](std::size_t t)
+				{
+					for (std::size_t i = 0; i < per_thread; ++i)
+					{
+						std::lock_guard<std::mutex> lock(m);
+						v.push_back(static_cast<int>(t + i));
+					}
+				});
+				print_row("mutex + vector, push_back", n / ms / 1000.0, "M/s");
+			}
+			{
+				MySTL::concurrent_vector<int> v;
+				const double ms = run_threads(threads, [&](std::size_t t)
+				{
+					for (std::size_t i = 0; i < per_thread; ++i)
+						v.push_back(static_cast<int>(t + i));
+				});
+				do_not_optimize(v.size());
+				print_row("concurrent_vector, push_back", n / ms / 1000.0, "M/s");
+			}
+			{
+				MySTL::concurrent_vector<int> v;
+				const double ms = run_threads(threads, [&](std::size_t t)
+				{
+					int local[batch];
+					for (std::size_t i = 0; i < per_thread; i += batch)
+					{
+						for (std::size_t k = 0; k < batch; ++k)
+							local[k] = static_cast<int>(t + i + k);
+						v.grow_by(local, local + batch);
+					}
+				});
+				do_not_optimize(v.size());
+				print_row("concurrent_vector, grow_by(64)", n / ms / 1000.0, "M/s");
+			}
+		}
+
+		inline void bench_all()
+		{
+			print_header("concurrent_vector");
+			std::cout << "hardware threads: " << std::thread::hardware_concurrency() << '\n';
+			const std::size_t n = 16 * 1024 * 1024;
+			for (std::size_t threads = 1; threads <= 32; threads *= 2)
+				run(threads, n);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef INCLUDED_BENCH_CONTIGUOUS_DISPATCH_H
+#define INCLUDED_BENCH_CONTIGUOUS_DISPATCH_H
+
+#include <cstddef>
+
+#include "bench_common.h"
+#include "../Declaration/iterator.h"
+#include "../Declaration/algorithm.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchContiguousDispatch
+	{
+		using namespace MySTL::Benchmark;
+
+		// a pointer that only advertises random_access_iterator_tag, so every algorithm
+		// takes its element-wise loop; the baseline for the contiguous dispatch
+		template <typename T>
+		class random_access_only : public MySTL::iterator<random_access_iterator_tag, T>
+		{
+		public:
+			explicit random_access_only(T *p) : ptr(p) {}
+			T& operator*() const { return *ptr; }
+			random_access_only& operator++() { ++ptr; return *this; }
+			random_access_only operator+(std::ptrdiff_t n) const { return random_access_only(ptr + n); }
+			std::ptrdiff_t operator-(const random_access_only &rhs) const { return ptr - rhs.ptr; }
+			bool operator==(const random_access_only &rhs) const { return ptr == rhs.ptr; }
+			bool operator!=(const random_access_only &rhs) const { return ptr != rhs.ptr; }
+			bool operator<(const random_access_only &rhs) const { return ptr < rhs.ptr; }
+		private:
+			T *ptr;
+		};
+
+		template <typename T>
+		inline random_access_only<T> wrap(T *p) { return random_access_only<T>(p); }
+
+		// best of @rounds, in ms
+		template <typename Function>
+		inline double best_of(int rounds, Function f)
+		{
+			double best = 1e300;
+			for (int r = 0; r < rounds; ++r)
+			{
+				timer t;
+				f();
+				double ms = t.elapsed_ms();
+				if (ms < best)
+					best = ms;
+			}
+			return best;
+		}
+
+		// vector::insert(pos, first, last) with the source taken from another vector
+		inline void bench_insert(std::size_t n)
+		{
+			MySTL::vector<int> src;
+			for (std::size_t i = 0; i != n; ++i)
+				src.push_back(static_cast<int>(i));
+			int *first = src.begin(), *last = src.end();
+
+			std::cout << "-----\t vector<int>::insert of " << n << " elements" << '\n';
+			// spare capacity: the range is copied in place
+			print_row("append, contiguous", best_of(5, [&]()
+			{
+				MySTL::vector<int> dst;
+				dst.reserve(n);
+				dst.insert(dst.end(), first, last);
+				do_not_optimize(dst.back());
+			}), "ms");
+			print_row("append, random access", best_of(5, [&]()
+			{
+				MySTL::vector<int> dst;
+				dst.reserve(n);
+				dst.insert(dst.end(), wrap(first), wrap(last));
+				do_not_optimize(dst.back());
+			}), "ms");
+			// no spare capacity: reallocate, relocate the old elements, copy the range
+			print_row("front insert, contiguous", best_of(5, [&]()
+			{
+				MySTL::vector<int> dst(1024, 7);
+				dst.insert(dst.begin(), first, last);
+				do_not_optimize(dst.back());
+			}), "ms");
+			print_row("front insert, random access", best_of(5, [&]()
+			{
+				MySTL::vector<int> dst(1024, 7);
+				dst.insert(dst.begin(), wrap(first), wrap(last));
+				do_not_optimize(dst.back());
+			}), "ms");
+		}
+
+		inline void bench_algorithms(std::size_t n)
+		{
+			MySTL::vector<int> a(n, 1), b(n, 1);
+			a[n - 1] = 2;
+			int *pa = a.begin(), *pb = b.begin();
+
+			std::cout << "-----\t algorithms over " << n << " ints" << '\n';
+			print_row("copy, contiguous", best_of(5, [&]() { MySTL::copy(pa, pa + n, pb); }), "ms");
+			print_row("copy, random access", best_of(5, [&]() { MySTL::copy(wrap(pa), wrap(pa + n), wrap(pb)); }), "ms");
+			b[n - 1] = 1;
+			print_row("equal, contiguous", best_of(5, [&]() { do_not_optimize(MySTL::equal(pa, pa + n, pb)); }), "ms");
+			print_row("equal, random access", best_of(5, [&]() { do_not_optimize(MySTL::equal(wrap(pa), wrap(pa + n), wrap(pb))); }), "ms");
+			print_row("mismatch, contiguous", best_of(5, [&]() { do_not_optimize(MySTL::mismatch(pa, pa + n, pb).first); }), "ms");
+			print_row("mismatch, random access", best_of(5, [&]() { do_not_optimize(*MySTL::mismatch(wrap(pa), wrap(pa + n), wrap(pb)).first); }), "ms");
+			print_row("find, contiguous", best_of(5, [&]() { do_not_optimize(MySTL::find(pa, pa + n, 2)); }), "ms");
+			print_row("find, random access", best_of(5, [&]() { do_not_optimize(*MySTL::find(wrap(pa), wrap(pa + n), 2)); }), "ms");
+		}
+
+		inline void bench_all()
+		{
+			print_header("contiguous iterator dispatch");
+			bench_insert(1024 * 1024);
+			bench_insert(16 * 1024 * 1024);
+			bench_algorithms(16 * 1024 * 1024);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef INCLUDED_BENCH_COW_VECTOR_H
+#define INCLUDED_BENCH_COW_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>		// snprintf
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/cow_vector.h"
+
+namespace MySTL
+{
+	namespace BenchCowVector
+	{
+		using namespace MySTL::Benchmark;
+
+		typedef MySTL::vector<std::uint32_t, counting_allocator<std::uint32_t> > plain_table;
+		typedef MySTL::cow_vector<std::uint32_t, counting_allocator<std::uint32_t> > cow_table;
+
+		// one reload: the publisher changes a copy of the current table in @changes places, then every
+		// worker takes a snapshot of it. A vector is copied into each worker, a cow_vector copied once
+		template <typename Table>
+		inline void reload(Table &current, Table *workers, std::size_t n_workers, std::size_t changes, std::uint32_t version)
+		{
+			Table next(current);
+			for (std::size_t i = 0; i != changes; ++i)
+				next[(version * 7919u + i * 104729u) % next.size()] = version;
+			current = next;
+			for (std::size_t w = 0; w != n_workers; ++w)
+				workers[w] = current;
+		}
+
+		template <typename Table>
+		inline void run_reloads(const char *name, std::size_t n, std::size_t n_workers, std::size_t reloads)
+		{
+			allocation_stats::reset();
+			{
+				Table current(n, 0u);
+				Table workers[64];
+				timer t;
+				for (std::size_t r = 0; r != reloads; ++r)
+					reload(current, workers, n_workers, 16, static_cast<std::uint32_t>(r + 1));
+				const double ms = t.elapsed_ms();
+
+				// the workers read their snapshots, the same cost for both
+				std::uint64_t sum = 0;
+				t.reset();
+				for (std::size_t w = 0; w != n_workers; ++w)
+				{
+					const Table &snap = workers[w];
+					for (std::size_t i = 0; i != snap.size(); ++i)
+						sum += snap.begin()[i];
+				}
+				do_not_optimize(sum);
+				const double read_ms = t.elapsed_ms();
+
+				char label[96];
+				std::snprintf(label, sizeof(label), "reload, %s", name);
+				print_row(label, ms * 1e3 / reloads, "us");
+				std::snprintf(label, sizeof(label), "memory held, %s", name);
+				print_row(label, allocation_stats::current() / 1024.0, "KiB");
+				std::snprintf(label, sizeof(label), "read all snapshots, %s", name);
+				print_row(label, read_ms, "ms");
+			}
+		}
+
+		// a single snapshot of @n elements: the time to take it, and the bytes it adds while alive
+		template <typename Table>
+		inline void run_snapshot(const char *name, std::size_t n)
+		{
+			const Table table(n, 1u);
+			const std::size_t rounds = n >= 100000 ? 200 : 20000;
+			timer t;
+			for (std::size_t r = 0; r != rounds; ++r)
+			{
+				Table snap(table);
+				do_not_optimize(snap);
+			}
+			const double ns = t.elapsed_ms() * 1e6 / rounds;
+			const std::size_t before = allocation_stats::current();
+			Table snap(table);
+			const std::size_t added = allocation_stats::current() - before;
+
+			char label[96];
+			std::snprintf(label, sizeof(label), "snapshot, %s", name);
+			print_row(label, ns, "ns");
+			std::snprintf(label, sizeof(label), "bytes added by a snapshot, %s", name);
+			print_row(label, static_cast<double>(added), "B");
+		}
+
+		inline void bench_all()
+		{
+			print_header("cow_vector");
+			for (std::size_t n = 1000; n <= 1000 * 1000; n *= 10)
+			{
+				std::cout << "-----\t table of " << n << " elements" << '\n';
+				run_snapshot<plain_table>("vector", n);
+				run_snapshot<cow_table>("cow_vector", n);
+			}
+			const std::size_t n = 100 * 1000, n_workers = 32, reloads = 100;
+			std::cout << "-----\t " << reloads << " reloads of " << n << " elements to " << n_workers << " workers" << '\n';
+			run_reloads<plain_table>("vector", n, n_workers, reloads);
+			run_reloads<cow_table>("cow_vector", n, n_workers, reloads);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef INCLUDED_BENCH_EMPLACE_H
+#define INCLUDED_BENCH_EMPLACE_H
+
+#include <cstddef>
+#include <string>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchEmplace
+	{
+		using namespace MySTL::Benchmark;
+
+		// an ingested record, the name is too long for the small string buffer
+		struct record
+		{
+			record(const char *name, int id, double score) : name(name), id(id), score(score) {}
+
+			std::string name;
+			int id;
+			double score;
+		};
+
+		inline void bench_all()
+		{
+			print_header("emplace_back vs push_back");
+			const std::size_t n = 4 * 1000 * 1000;
+			const char *name = "a record name longer than the SSO buffer";
+
+			double push_ms, emplace_ms;
+			{
+				MySTL::vector<record> v;
+				v.reserve(n);
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					v.push_back(record(name, static_cast<int>(i), 0.5));	// temporary + copy
+				push_ms = t.elapsed_ms();
+				do_not_optimize(v.back());
+			}
+			{
+				MySTL::vector<record> v;
+				v.reserve(n);
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					v.emplace_back(name, static_cast<int>(i), 0.5);			// constructed in place
+				emplace_ms = t.elapsed_ms();
+				do_not_optimize(v.back());
+			}
+			std::cout << n << " records, capacity reserved" << '\n';
+			print_row("push_back(record(...))", n / 1e6 / (push_ms / 1000.0), "M/s");
+			print_row("emplace_back(...)", n / 1e6 / (emplace_ms / 1000.0), "M/s");
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
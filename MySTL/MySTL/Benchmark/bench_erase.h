@@ -0,0 +1,94 @@
+#ifndef INCLUDED_BENCH_ERASE_H
+#define INCLUDED_BENCH_ERASE_H
+
+#include <cstddef>
+#include <string>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchErase
+	{
+		using namespace MySTL::Benchmark;
+
+		// removing the even numbers: one erase per hit vs a single erase_if pass
+		inline void bench_erase_if(std::size_t n)
+		{
+			double loop_ms, erase_if_ms;
+			{
+				MySTL::vector<int> v;
+				for (std::size_t i = 0; i != n; ++i)
+					v.push_back(static_cast<int>(i));
+				timer t;
+				for (MySTL::vector<int>::iterator it = v.begin(); it != v.end();)
+				{
+					if (*it % 2 == 0)
+						it = v.erase(it);
+					else
+						++it;
+				}
+				loop_ms = t.elapsed_ms();
+				do_not_optimize(v.back());
+			}
+			{
+				MySTL::vector<int> v;
+				for (std::size_t i = 0; i != n; ++i)
+					v.push_back(static_cast<int>(i));
+				timer t;
+				MySTL::erase_if(v, [](int x) { return x % 2 == 0; });
+				erase_if_ms = t.elapsed_ms();
+				do_not_optimize(v.back());
+			}
+			std::cout << "-----\t remove the even numbers of " << n << " ints" << '\n';
+			print_row("erase(it) in a loop", loop_ms, "ms");
+			print_row("erase_if", erase_if_ms, "ms");
+		}
+
+		// pop_front-style erase(begin()): memmove of the tail vs element-wise move assignment
+		template <typename T>
+		inline double bench_erase_front(const char *label, std::size_t n, const T &val)
+		{
+			MySTL::vector<T> v(n, val);
+			timer t;
+			while (!v.empty())
+				v.erase(v.begin());
+			const double ms = t.elapsed_ms();
+			print_row(label, ms, "ms");
+			return ms;
+		}
+
+		// insert at the front: the tail is shifted through the same path
+		template <typename T>
+		inline double bench_insert_front(const char *label, std::size_t n, const T &val)
+		{
+			MySTL::vector<T> v;
+			v.reserve(n);
+			timer t;
+			for (std::size_t i = 0; i != n; ++i)
+				v.insert(v.begin(), val);
+			const double ms = t.elapsed_ms();
+			do_not_optimize(v.front());
+			print_row(label, ms, "ms");
+			return ms;
+		}
+
+		inline void bench_all()
+		{
+			print_header("erase / insert, shifting the tail");
+			bench_erase_if(200 * 1000);
+
+			const std::size_t n = 20 * 1000;
+			std::cout << "-----\t erase(begin()) until empty, " << n << " elements" << '\n';
+			bench_erase_front<int>("vector<int>", n, 1);
+			bench_erase_front<std::string>("vector<std::string>", n, std::string("short"));
+			std::cout << "-----\t insert(begin(), x), " << n << " elements" << '\n';
+			bench_insert_front<int>("vector<int>", n, 1);
+			bench_insert_front<std::string>("vector<std::string>", n, std::string("short"));
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
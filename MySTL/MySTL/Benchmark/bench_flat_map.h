@@ -0,0 +1,108 @@
+#ifndef INCLUDED_BENCH_FLAT_MAP_H
+#define INCLUDED_BENCH_FLAT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/flat_map.h"
+
+namespace MySTL
+{
+	namespace BenchFlatMap
+	{
+		using namespace MySTL::Benchmark;
+
+		inline std::uint64_t next(std::uint64_t &x)
+		{
+			x ^= x << 13; x ^= x >> 7; x ^= x << 17;	// xorshift
+			return x;
+		}
+
+		// @n random keys: std::map built by insert, flat_map by the bulk constructor, then the same
+		// lookups (about half of them hits) and a full scan on both
+		inline void run(std::size_t n)
+		{
+			typedef std::pair<std::uint64_t, std::uint64_t> entry;
+			MySTL::vector<entry> input;
+			input.reserve(n);
+			std::uint64_t seed = 88172645463325252ULL;
+			for (std::size_t i = 0; i != n; ++i)
+				input.push_back(entry(next(seed) % (2 * n), i));
+			std::cout << "-----\t " << n << " keys" << '\n';
+
+			std::map<std::uint64_t, std::uint64_t> tree;
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					tree.insert(input[i]);
+				print_row("build, std::map insert", t.elapsed_ms(), "ms");
+			}
+			timer t;
+			MySTL::flat_map<std::uint64_t, std::uint64_t> flat(input.begin(), input.end());
+			print_row("build, flat_map bulk", t.elapsed_ms(), "ms");
+			{
+				// the same keys again in 64 batches, almost all of them present already
+				MySTL::flat_map<std::uint64_t, std::uint64_t> copy(flat);
+				const std::size_t batch = n / 64 ? n / 64 : 1;
+				timer t;
+				for (std::size_t i = 0; i < n; i += batch)
+					copy.insert(input.begin() + i, input.begin() + (i + batch < n ? i + batch : n));
+				print_row("insert 64 batches, flat_map", t.elapsed_ms(), "ms");
+			}
+
+			const std::size_t probes = 2 * 1000 * 1000;
+			{
+				std::uint64_t s = 2463534242ULL, sum = 0;
+				timer t;
+				for (std::size_t i = 0; i != probes; ++i)
+				{
+					auto it = tree.find(next(s) % (2 * n));
+					sum += it != tree.end() ? it->second : 0;
+				}
+				do_not_optimize(sum);
+				print_row("find, std::map", t.elapsed_ms() * 1e6 / probes, "ns");
+			}
+			{
+				std::uint64_t s = 2463534242ULL, sum = 0;
+				timer t;
+				for (std::size_t i = 0; i != probes; ++i)
+				{
+					auto it = flat.find(next(s) % (2 * n));
+					sum += it != flat.end() ? it->second : 0;
+				}
+				do_not_optimize(sum);
+				print_row("find, flat_map", t.elapsed_ms() * 1e6 / probes, "ns");
+			}
+			{
+				std::uint64_t sum = 0;
+				timer t;
+				for (auto it = tree.begin(); it != tree.end(); ++it)
+					sum += it->second;
+				do_not_optimize(sum);
+				print_row("scan, std::map", t.elapsed_ms() * 1e6 / tree.size(), "ns/key");
+			}
+			{
+				std::uint64_t sum = 0;
+				timer t;
+				for (auto it = flat.begin(); it != flat.end(); ++it)
+					sum += it->second;
+				do_not_optimize(sum);
+				print_row("scan, flat_map", t.elapsed_ms() * 1e6 / flat.size(), "ns/key");
+			}
+		}
+
+		inline void bench_all()
+		{
+			print_header("flat_map");
+			for (std::size_t n = 1000; n <= 10 * 1000 * 1000; n *= 10)
+				run(n);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
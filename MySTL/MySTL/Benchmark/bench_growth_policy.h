@@ -0,0 +1,53 @@
+#ifndef INCLUDED_BENCH_GROWTH_POLICY_H
+#define INCLUDED_BENCH_GROWTH_POLICY_H
+
+#include <cstddef>
+
+#include "bench_common.h"
+#include "../Declaration/growth_policy.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchGrowthPolicy
+	{
+		using namespace MySTL::Benchmark;
+
+		template <typename GrowthPolicy>
+		inline void bench_policy(const char *name, std::size_t n)
+		{
+			allocation_stats::reset();
+			std::size_t capacity = 0;
+			timer t;
+			{
+				MySTL::vector<long long, counting_allocator<long long>, GrowthPolicy> v;
+				for (std::size_t i = 0; i != n; ++i)
+					v.push_back(static_cast<long long>(i));
+				capacity = v.capacity();
+				do_not_optimize(v.back());
+			}
+			const double ms = t.elapsed_ms();
+
+			const double mb = 1024.0 * 1024.0;
+			std::cout << "-----\t " << name << '\n';
+			print_row("push_back throughput", n / 1e6 / (ms / 1000.0), "M/s");
+			print_row("peak memory", allocation_stats::peak() / mb, "MB");
+			print_row("final slack", (capacity - n) * sizeof(long long) / mb, "MB");
+			print_row("allocations", static_cast<double>(allocation_stats::count()), "");
+		}
+
+		inline void bench_all()
+		{
+			const std::size_t n = 100 * 1000 * 1000;	// 800 MB of payload
+			print_header("vector growth policy");
+			std::cout << "push_back of " << n << " long long" << '\n';
+			bench_policy<MySTL::double_growth>("double_growth", n);
+			bench_policy<MySTL::one_and_half_growth>("one_and_half_growth", n);
+			bench_policy<MySTL::size_class_growth<> >("size_class_growth<double_growth>", n);
+			bench_policy<MySTL::capped_linear_growth<> >("capped_linear_growth<64 MB, 64 MB>", n);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
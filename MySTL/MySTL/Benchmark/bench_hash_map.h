@@ -0,0 +1,141 @@
+#ifndef INCLUDED_BENCH_HASH_MAP_H
+#define INCLUDED_BENCH_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>		// snprintf
+#include <string>
+#include <unordered_map>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/hash_map.h"
+
+namespace MySTL
+{
+	namespace BenchHashMap
+	{
+		using namespace MySTL::Benchmark;
+
+		inline std::uint64_t next(std::uint64_t &x)
+		{
+			x ^= x << 13; x ^= x >> 7; x ^= x << 17;	// xorshift
+			return x;
+		}
+
+		// per operation: insert the keys, find all of them, find as many absent ones, erase them all
+		template <typename Map>
+		inline void run_ops(const char *name, Map &m, const MySTL::vector<std::uint64_t> &keys, const MySTL::vector<std::uint64_t> &misses)
+		{
+			char label[64];
+			const std::size_t n = keys.size();
+			timer t;
+			for (std::size_t i = 0; i != n; ++i)
+				m.insert(std::make_pair(keys.begin()[i], i));
+			std::snprintf(label, sizeof(label), "insert, %s", name);
+			print_row(label, t.elapsed_ms() * 1e6 / n, "ns");
+
+			std::uint64_t sum = 0;
+			t.reset();
+			for (std::size_t i = 0; i != n; ++i)
+				sum += m.find(keys.begin()[i])->second;
+			std::snprintf(label, sizeof(label), "find hit, %s", name);
+			print_row(label, t.elapsed_ms() * 1e6 / n, "ns");
+
+			t.reset();
+			for (std::size_t i = 0; i != n; ++i)
+				sum += m.find(misses.begin()[i]) == m.end();
+			std::snprintf(label, sizeof(label), "find miss, %s", name);
+			print_row(label, t.elapsed_ms() * 1e6 / n, "ns");
+
+			t.reset();
+			for (std::size_t i = 0; i != n; ++i)
+				sum += m.erase(keys.begin()[i]);
+			std::snprintf(label, sizeof(label), "erase, %s", name);
+			print_row(label, t.elapsed_ms() * 1e6 / n, "ns");
+			do_not_optimize(sum);
+		}
+
+		// a table of 2^20 - 1 slots filled to @load; std::unordered_map reserved for the same count
+		inline void run_load(double load)
+		{
+			const std::size_t slots = (std::size_t(1) << 20) - 1;
+			const std::size_t n = static_cast<std::size_t>(slots * load);
+			MySTL::vector<std::uint64_t> keys, misses;
+			keys.reserve(n);
+			misses.reserve(n);
+			std::uint64_t seed = 88172645463325252ULL;
+			for (std::size_t i = 0; i != n; ++i)
+			{
+				const std::uint64_t x = next(seed);
+				keys.push_back(x | 1);			// the misses are even, the keys odd
+				misses.push_back(x & ~std::uint64_t(1));
+			}
+			char title[64];
+			std::snprintf(title, sizeof(title), "load %.1f%%, %zu keys", load * 100, n);
+			std::cout << "-----\t " << title << '\n';
+
+			MySTL::hash_map<std::uint64_t, std::uint64_t> swiss;
+			swiss.rehash(slots);
+			run_ops("hash_map", swiss, keys, misses);
+			std::unordered_map<std::uint64_t, std::uint64_t> node;
+			node.reserve(n);
+			run_ops("std::unordered_map", node, keys, misses);
+		}
+
+		// string keys: find by const char * on the table itself, against building a string per lookup
+		inline void run_strings(std::size_t n)
+		{
+			MySTL::vector<std::string> names;
+			names.reserve(n);
+			std::uint64_t seed = 2463534242ULL;
+			char buf[32];
+			for (std::size_t i = 0; i != n; ++i)
+			{
+				std::snprintf(buf, sizeof(buf), "user:%llu", static_cast<unsigned long long>(next(seed) % 100000000));
+				names.push_back(buf);
+			}
+			std::cout << "-----\t " << n << " string keys" << '\n';
+
+			MySTL::hash_map<std::string, std::size_t> swiss;
+			std::unordered_map<std::string, std::size_t> node;
+			for (std::size_t i = 0; i != n; ++i)
+			{
+				swiss.insert(std::make_pair(names.begin()[i], i));
+				node.insert(std::make_pair(names.begin()[i], i));
+			}
+			std::size_t sum = 0;
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					sum += swiss.find(names.begin()[i].c_str())->second;
+				print_row("find const char *, hash_map", t.elapsed_ms() * 1e6 / n, "ns");
+			}
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					sum += swiss.find(std::string(names.begin()[i].c_str()))->second;
+				print_row("find string(const char *), hash_map", t.elapsed_ms() * 1e6 / n, "ns");
+			}
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					sum += node.find(std::string(names.begin()[i].c_str()))->second;
+				print_row("find string(const char *), std::unordered_map", t.elapsed_ms() * 1e6 / n, "ns");
+			}
+			do_not_optimize(sum);
+		}
+
+		inline void bench_all()
+		{
+			print_header("hash_map");
+			const double loads[] = { 0.5, 0.75, 0.875 };
+			for (std::size_t i = 0; i != 3; ++i)
+				run_load(loads[i]);
+			run_strings(500 * 1000);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
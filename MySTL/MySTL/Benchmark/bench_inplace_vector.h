@@ -0,0 +1,66 @@
+#ifndef INCLUDED_BENCH_INPLACE_VECTOR_H
+#define INCLUDED_BENCH_INPLACE_VECTOR_H
+
+#include <cstddef>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/inplace_vector.h"
+
+namespace MySTL
+{
+	namespace BenchInplaceVector
+	{
+		using namespace MySTL::Benchmark;
+
+		typedef MySTL::vector<int, counting_allocator<int> > reserved_vector;
+		typedef MySTL::inplace_vector<int, 16> fixed_vector;
+
+		inline void reserve_for(reserved_vector &v, int k) { v.reserve(static_cast<std::size_t>(k)); }
+		inline void reserve_for(fixed_vector &, int) {}
+
+		// build, copy and destroy a container of @k elements @rounds times
+		template <typename Container, typename Append>
+		inline void bench_workload(const char *label, int k, int rounds, Append append)
+		{
+			allocation_stats::reset();
+			timer t;
+			long long sum = 0;
+			for (int r = 0; r < rounds; ++r)
+			{
+				Container c;
+				reserve_for(c, k);
+				for (int i = 0; i < k; ++i)
+					append(c, r + i);
+				Container copy(c);
+				for (auto it = copy.begin(); it != copy.end(); ++it)
+					sum += *it;
+			}
+			const double ns = t.elapsed_ms() * 1e6 / rounds;
+			do_not_optimize(sum);
+
+			std::cout << "-----\t " << label << ", " << k << " elements" << '\n';
+			print_row("latency", ns, "ns/op");
+			print_row("allocations", static_cast<double>(allocation_stats::count()) / rounds, "per op");
+		}
+
+		inline void bench_all()
+		{
+			print_header("inplace_vector");
+			const int rounds = 1000000;
+			const int sizes[] = { 1, 4, 8, 16 };
+			for (int k : sizes)
+			{
+				bench_workload<reserved_vector>("vector<int> + reserve", k, rounds,
+					[](reserved_vector &v, int x) { v.push_back(x); });
+				bench_workload<fixed_vector>("inplace_vector<int, 16>", k, rounds,
+					[](fixed_vector &v, int x) { v.push_back(x); });
+				bench_workload<fixed_vector>("inplace_vector<int, 16>, try_push_back", k, rounds,
+					[](fixed_vector &v, int x) { do_not_optimize(v.try_push_back(x)); });
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef INCLUDED_BENCH_MMAP_VECTOR_H
+#define INCLUDED_BENCH_MMAP_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>		// remove
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/mmap_vector.h"
+
+namespace MySTL
+{
+	namespace BenchMmapVector
+	{
+		using namespace MySTL::Benchmark;
+
+		const char bench_file[] = "mmap_vector_bench.bin";
+
+		template <typename Container>
+		inline double scan(Container &c)
+		{
+			timer t;
+			std::uint64_t sum = 0;
+			for (auto it = c.begin(); it != c.end(); ++it)
+				sum += *it;
+			do_not_optimize(sum);
+			return t.elapsed_ms();
+		}
+
+		// @reads loads spread over the whole container
+		template <typename Container>
+		inline double probe(Container &c, std::size_t reads)
+		{
+			timer t;
+			std::uint64_t sum = 0, x = 88172645463325252ULL;
+			for (std::size_t i = 0; i != reads; ++i)
+			{
+				x ^= x << 13; x ^= x >> 7; x ^= x << 17;	// xorshift
+				sum += c[static_cast<std::size_t>(x % c.size())];
+			}
+			do_not_optimize(sum);
+			return t.elapsed_ms();
+		}
+
+		inline void bench_all()
+		{
+			print_header("mmap_vector vs vector");
+			// The sandbox has more RAM than this file, so "larger than the page cache" is emulated:
+			// advise(dontneed) writes the file back and drops its pages before every cold run.
+			const std::size_t n = 128 * 1024 * 1024;	// 1 GB of uint64_t
+			const std::size_t reads = 200 * 1000;
+			const double gb = n * sizeof(std::uint64_t) / (1024.0 * 1024 * 1024);
+
+			MySTL::vector<std::uint64_t> ram;
+			ram.reserve(n);
+			MySTL::mmap_vector<std::uint64_t> disk(bench_file, MySTL::mmap_vector<std::uint64_t>::truncate);
+			disk.reserve(n);
+			double fill_ram, fill_disk;
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					ram.push_back(i);
+				fill_ram = t.elapsed_ms();
+			}
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					disk.push_back(i);
+				disk.flush();
+				fill_disk = t.elapsed_ms();
+			}
+			std::cout << "-----\t fill " << n << " uint64_t" << '\n';
+			print_row("vector", gb / (fill_ram / 1000.0), "GB/s");
+			print_row("mmap_vector + flush", gb / (fill_disk / 1000.0), "GB/s");
+
+			std::cout << "-----\t sequential scan" << '\n';
+			print_row("vector", gb / (scan(ram) / 1000.0), "GB/s");
+			print_row("mmap_vector, cached", gb / (scan(disk) / 1000.0), "GB/s");
+			disk.advise(MySTL::mapped_file::dontneed);
+			print_row("mmap_vector, cold", gb / (scan(disk) / 1000.0), "GB/s");
+			disk.advise(MySTL::mapped_file::dontneed);
+			disk.advise(MySTL::mapped_file::sequential);
+			print_row("mmap_vector, cold, sequential", gb / (scan(disk) / 1000.0), "GB/s");
+
+			std::cout << "-----\t " << reads << " random reads" << '\n';
+			print_row("vector", probe(ram, reads) * 1e6 / reads, "ns/read");
+			disk.advise(MySTL::mapped_file::dontneed);
+			disk.advise(MySTL::mapped_file::normal);
+			print_row("mmap_vector, cold", probe(disk, reads) * 1e6 / reads, "ns/read");
+			disk.advise(MySTL::mapped_file::dontneed);
+			disk.advise(MySTL::mapped_file::random);
+			print_row("mmap_vector, cold, random", probe(disk, reads) * 1e6 / reads, "ns/read");
+			disk.advise(MySTL::mapped_file::willneed);
+			print_row("mmap_vector, willneed", probe(disk, reads) * 1e6 / reads, "ns/read");
+
+			disk.close();
+			std::remove(bench_file);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef INCLUDED_BENCH_MOVE_INSERT_H
+#define INCLUDED_BENCH_MOVE_INSERT_H
+
+#include <cstddef>
+#include <utility>
+
+#include "bench_common.h"
+#include "../Declaration/string.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/move_iterator.h"
+
+namespace MySTL
+{
+	namespace BenchMoveInsert
+	{
+		using namespace MySTL::Benchmark;
+
+		const char payload[] = "a payload of sixty four characters, well past any inline buffer";
+
+		inline MySTL::vector<MySTL::string> make_strings(std::size_t n)
+		{
+			MySTL::vector<MySTL::string> v;
+			v.reserve(n);
+			for (std::size_t i = 0; i != n; ++i)
+				v.push_back(MySTL::string(payload, sizeof(payload) - 1));
+			return v;
+		}
+
+		inline void bench_push_back(std::size_t n)
+		{
+			double copy_ms, move_ms;
+			{
+				MySTL::vector<MySTL::string> src = make_strings(n), dst;
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					dst.push_back(static_cast<const MySTL::string&>(src[i]));	// deep copy
+				copy_ms = t.elapsed_ms();
+			}
+			{
+				MySTL::vector<MySTL::string> src = make_strings(n), dst;
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					dst.push_back(std::move(src[i]));							// steals the buffer
+				move_ms = t.elapsed_ms();
+			}
+			std::cout << "-----\t push_back of " << n << " strings" << '\n';
+			print_row("push_back(const string&)", copy_ms, "ms");
+			print_row("push_back(string&&)", move_ms, "ms");
+		}
+
+		inline void bench_range_insert(std::size_t n)
+		{
+			double copy_ms, move_ms;
+			{
+				MySTL::vector<MySTL::string> src = make_strings(n), dst = make_strings(16);
+				timer t;
+				dst.insert(dst.begin() + 8, src.begin(), src.end());
+				copy_ms = t.elapsed_ms();
+			}
+			{
+				MySTL::vector<MySTL::string> src = make_strings(n), dst = make_strings(16);
+				timer t;
+				dst.insert(dst.begin() + 8, MySTL::make_move_iterator(src.begin()), MySTL::make_move_iterator(src.end()));
+				move_ms = t.elapsed_ms();
+			}
+			std::cout << "-----\t range insert of " << n << " strings" << '\n';
+			print_row("insert(pos, first, last)", copy_ms, "ms");
+			print_row("insert(pos, move_iterator...)", move_ms, "ms");
+		}
+
+		inline void bench_all()
+		{
+			print_header("move insert, vector<MySTL::string>");
+			bench_push_back(1000 * 1000);
+			bench_range_insert(1000 * 1000);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
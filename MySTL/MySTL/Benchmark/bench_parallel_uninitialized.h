@@ -0,0 +1,65 @@
+#ifndef INCLUDED_BENCH_PARALLEL_UNINITIALIZED_H
+#define INCLUDED_BENCH_PARALLEL_UNINITIALIZED_H
+
+#include <atomic>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchParallelUninitialized
+	{
+		using namespace MySTL::Benchmark;
+
+		// a parallel scan with the construction partition, pages are local to the scanning threads
+		inline long long parallel_sum(const MySTL::vector<long long> &v)
+		{
+			std::atomic<long long> total(0);
+			MySTL::parallel_for(v.size(), [&](std::size_t b, std::size_t e)
+			{
+				long long s = 0;
+				for (std::size_t i = b; i != e; ++i)
+					s += v.begin()[i];
+				total += s;
+			});
+			return total;
+		}
+
+		inline void bench_all()
+		{
+			print_header("parallel uninitialized functions");
+			const std::size_t n = 128 * 1024 * 1024;	// 1 GB of long long
+			std::cout << "threads: " << MySTL::thread_pool::instance().size() << '\n';
+
+			timer t;
+			{
+				MySTL::vector<long long> v(n, 1);
+				print_row("fill construct, sequential", t.elapsed_ms(), "ms");
+				t.reset();
+				do_not_optimize(parallel_sum(v));
+				print_row("parallel scan of sequential fill", t.elapsed_ms(), "ms");
+
+				t.reset();
+				MySTL::vector<long long> c(v);
+				print_row("copy construct, sequential", t.elapsed_ms(), "ms");
+			}
+
+			t.reset();
+			{
+				MySTL::vector<long long> v(MySTL::par, n, 1);
+				print_row("fill construct, parallel", t.elapsed_ms(), "ms");
+				t.reset();
+				do_not_optimize(parallel_sum(v));
+				print_row("parallel scan of parallel fill", t.elapsed_ms(), "ms");
+
+				t.reset();
+				MySTL::vector<long long> c(MySTL::par, v);
+				print_row("copy construct, parallel", t.elapsed_ms(), "ms");
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
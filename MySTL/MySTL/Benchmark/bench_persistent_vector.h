@@ -0,0 +1,189 @@
+#ifndef INCLUDED_BENCH_PERSISTENT_VECTOR_H
+#define INCLUDED_BENCH_PERSISTENT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>		// snprintf
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/persistent_vector.h"
+
+namespace MySTL
+{
+	namespace BenchPersistentVector
+	{
+		using namespace MySTL::Benchmark;
+
+		typedef MySTL::vector<std::uint32_t, counting_allocator<std::uint32_t> > plain_table;
+		typedef MySTL::persistent_vector<std::uint32_t, counting_allocator<std::uint32_t> > persistent_table;
+
+		inline std::uint64_t next(std::uint64_t &x)
+		{
+			x ^= x << 13; x ^= x >> 7; x ^= x << 17;	// xorshift
+			return x;
+		}
+
+		inline void fill(plain_table &table, std::size_t n)
+		{
+			for (std::size_t i = 0; i != n; ++i)
+				table.push_back(static_cast<std::uint32_t>(i));
+		}
+
+		inline void fill(persistent_table &table, std::size_t n)
+		{
+			persistent_table::transient_type batch = table.transient();
+			for (std::size_t i = 0; i != n; ++i)
+				batch.push_back(static_cast<std::uint32_t>(i));
+			table = batch.persistent();
+		}
+
+		// one version from the previous one: the full copy of a vector, or a persistent update
+		inline plain_table set_version(const plain_table &prev, std::uint64_t r)
+		{
+			plain_table next(prev);
+			next[r % next.size()] = static_cast<std::uint32_t>(r);
+			return next;
+		}
+
+		inline persistent_table set_version(const persistent_table &prev, std::uint64_t r)
+		{
+			return prev.set(r % prev.size(), static_cast<std::uint32_t>(r));
+		}
+
+		inline plain_table push_version(const plain_table &prev, std::uint64_t r)
+		{
+			plain_table next(prev);
+			next.push_back(static_cast<std::uint32_t>(r));
+			return next;
+		}
+
+		inline persistent_table push_version(const persistent_table &prev, std::uint64_t r)
+		{
+			return prev.push_back(static_cast<std::uint32_t>(r));
+		}
+
+		inline plain_table concat_version(const plain_table &prev, const plain_table &x)
+		{
+			plain_table next(prev);
+			next.insert(next.end(), x.begin(), x.end());
+			return next;
+		}
+
+		inline persistent_table concat_version(const persistent_table &prev, const persistent_table &x)
+		{
+			return prev.concat(x);
+		}
+
+		// an undo history: every version is kept while the next is made from it. The bytes per
+		// version are those the history holds beyond the first version
+		template <typename Table>
+		inline void run_history(const char *what, const char *name, std::size_t n, std::size_t versions,
+			Table (*edit)(const Table &, std::uint64_t))
+		{
+			Table base;
+			fill(base, n);
+			MySTL::vector<Table> history;
+			history.reserve(versions + 1);
+			history.push_back(base);
+			std::uint64_t seed = 88172645463325252ULL;
+			const std::size_t before = allocation_stats::current();
+			timer t;
+			for (std::size_t v = 0; v != versions; ++v)
+				history.push_back(edit(history.back(), next(seed)));
+			const double ms = t.elapsed_ms();
+			const std::size_t added = allocation_stats::current() - before;
+
+			char label[96];
+			std::snprintf(label, sizeof(label), "%s, %s", what, name);
+			print_row(label, versions * 1e3 / ms, "versions/s");
+			std::snprintf(label, sizeof(label), "memory per version, %s", name);
+			print_row(label, static_cast<double>(added) / versions, "B");
+		}
+
+		// concat of two halves, each result kept
+		template <typename Table>
+		inline void run_concat(const char *name, std::size_t n, std::size_t versions)
+		{
+			Table left, right;
+			fill(left, n / 2);
+			fill(right, n / 2);
+			MySTL::vector<Table> results;
+			results.reserve(versions);
+			const std::size_t before = allocation_stats::current();
+			timer t;
+			for (std::size_t v = 0; v != versions; ++v)
+				results.push_back(concat_version(left, right));
+			const double ms = t.elapsed_ms();
+			const std::size_t added = allocation_stats::current() - before;
+
+			char label[96];
+			std::snprintf(label, sizeof(label), "concat, %s", name);
+			print_row(label, versions * 1e3 / ms, "versions/s");
+			std::snprintf(label, sizeof(label), "memory per version, %s", name);
+			print_row(label, static_cast<double>(added) / versions, "B");
+		}
+
+		// building n elements when only the last version is wanted
+		inline void run_build(std::size_t n)
+		{
+			std::uint64_t sum = 0;
+			{
+				timer t;
+				persistent_table v;
+				for (std::size_t i = 0; i != n; ++i)
+					v = v.push_back(static_cast<std::uint32_t>(i));
+				print_row("build, persistent_vector::push_back", t.elapsed_ms() * 1e6 / n, "ns");
+				sum += v.back();
+			}
+			{
+				timer t;
+				persistent_table empty;
+				MySTL::transient_vector<std::uint32_t, counting_allocator<std::uint32_t> > batch = empty.transient();
+				for (std::size_t i = 0; i != n; ++i)
+					batch.push_back(static_cast<std::uint32_t>(i));
+				const persistent_table v = batch.persistent();
+				print_row("build, transient_vector::push_back", t.elapsed_ms() * 1e6 / n, "ns");
+
+				t.reset();
+				for (auto it = v.begin(); it != v.end(); ++it)
+					sum += *it;
+				print_row("read by iterator, persistent_vector", t.elapsed_ms() * 1e6 / n, "ns");
+				t.reset();
+				for (std::size_t i = 0; i != n; ++i)
+					sum += v[i];
+				print_row("read by index, persistent_vector", t.elapsed_ms() * 1e6 / n, "ns");
+			}
+			{
+				timer t;
+				plain_table v;
+				for (std::size_t i = 0; i != n; ++i)
+					v.push_back(static_cast<std::uint32_t>(i));
+				print_row("build, vector::push_back", t.elapsed_ms() * 1e6 / n, "ns");
+				t.reset();
+				for (std::size_t i = 0; i != n; ++i)
+					sum += v[i];
+				print_row("read by index, vector", t.elapsed_ms() * 1e6 / n, "ns");
+			}
+			do_not_optimize(sum);
+		}
+
+		inline void bench_all()
+		{
+			print_header("persistent_vector");
+			const std::size_t n = 100 * 1000;
+			std::cout << "-----\t history of a " << n << " element table" << '\n';
+			run_history<plain_table>("set", "vector copy", n, 200, set_version);
+			run_history<persistent_table>("set", "persistent_vector", n, 100 * 1000, set_version);
+			run_history<plain_table>("push_back", "vector copy", n, 200, push_version);
+			run_history<persistent_table>("push_back", "persistent_vector", n, 100 * 1000, push_version);
+			run_concat<plain_table>("vector copy", n, 200);
+			run_concat<persistent_table>("persistent_vector", n, 100 * 1000);
+			std::cout << "-----\t one table of " << 1000 * 1000 << " elements" << '\n';
+			run_build(1000 * 1000);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
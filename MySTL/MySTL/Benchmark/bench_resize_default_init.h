@@ -0,0 +1,85 @@
+#ifndef INCLUDED_BENCH_RESIZE_DEFAULT_INIT_H
+#define INCLUDED_BENCH_RESIZE_DEFAULT_INIT_H
+
+#include <cstddef>
+#include <cstring>
+
+#include "bench_common.h"
+#include "../Declaration/string.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchResizeDefaultInit
+	{
+		using namespace MySTL::Benchmark;
+
+		// stands in for read(fd, p, n): every byte of the buffer gets overwritten
+		inline std::size_t produce(char *p, std::size_t n)
+		{
+			std::memset(p, 0x5a, n);
+			return n;
+		}
+
+		template <typename Buffer>
+		inline void report(const char *label, Buffer &buf, double ms)
+		{
+			do_not_optimize(buf[buf.size() / 2]);
+			print_row(label, buf.size() / (1024.0 * 1024 * 1024) / (ms / 1000.0), "GB/s");
+		}
+
+		inline void bench_vector(std::size_t n)
+		{
+			std::cout << "-----\t vector<char>, fill " << (n >> 20) << " MB" << '\n';
+			{
+				MySTL::vector<char> buf;
+				timer t;
+				buf.resize(n);									// zeroes every byte first
+				produce(&buf[0], n);
+				report("resize + overwrite", buf, t.elapsed_ms());
+			}
+			{
+				MySTL::vector<char> buf;
+				timer t;
+				buf.resize_default_init(n);
+				produce(&buf[0], n);
+				report("resize_default_init + overwrite", buf, t.elapsed_ms());
+			}
+			{
+				MySTL::vector<char> buf;
+				timer t;
+				buf.resize_and_overwrite(n, produce);
+				report("resize_and_overwrite", buf, t.elapsed_ms());
+			}
+		}
+
+		inline void bench_string(std::size_t n)
+		{
+			std::cout << "-----\t string, fill " << (n >> 20) << " MB" << '\n';
+			{
+				MySTL::string buf;
+				timer t;
+				buf.resize(n);
+				produce(&buf[0], n);
+				report("resize + overwrite", buf, t.elapsed_ms());
+			}
+			{
+				MySTL::string buf;
+				timer t;
+				buf.resize_and_overwrite(n, produce);
+				report("resize_and_overwrite", buf, t.elapsed_ms());
+			}
+		}
+
+		inline void bench_all()
+		{
+			print_header("resize_default_init / resize_and_overwrite");
+			const std::size_t n = std::size_t(1) << 30;	// 1 GB
+			bench_vector(n);
+			bench_string(n);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef INCLUDED_BENCH_SEGMENTED_VECTOR_H
+#define INCLUDED_BENCH_SEGMENTED_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/segmented_vector.h"
+
+namespace MySTL
+{
+	namespace BenchSegmentedVector
+	{
+		using namespace MySTL::Benchmark;
+
+		template <typename Container>
+		inline void bench_container(const char *label, std::size_t n)
+		{
+			allocation_stats::reset();
+			Container c;
+			double grow_ms, scan_ms, random_ms;
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					c.push_back(static_cast<std::int64_t>(i));
+				grow_ms = t.elapsed_ms();
+			}
+			std::int64_t sum = 0;
+			{
+				timer t;
+				for (auto it = c.begin(); it != c.end(); ++it)
+					sum += *it;
+				scan_ms = t.elapsed_ms();
+			}
+			{
+				timer t;
+				std::size_t j = 0;
+				for (std::size_t i = 0; i != n; ++i, j = (j + 7919) % n)
+					sum += c[j];
+				random_ms = t.elapsed_ms();
+			}
+			do_not_optimize(sum);
+
+			std::cout << "-----\t " << label << ", " << n << " push_back" << '\n';
+			print_row("grow", grow_ms, "ms");
+			print_row("peak memory", allocation_stats::peak() / (1024.0 * 1024), "MB");
+			print_row("allocations", static_cast<double>(allocation_stats::count()), "");
+			print_row("iterate", scan_ms, "ms");
+			print_row("operator[] (strided)", random_ms, "ms");
+		}
+
+		inline void bench_all()
+		{
+			print_header("segmented_vector vs vector");
+			const std::size_t n = 24 * 1024 * 1024;	// 24M int64, 192 MB
+			bench_container<MySTL::vector<std::int64_t, counting_allocator<std::int64_t> > >("vector<int64_t>", n);
+			bench_container<MySTL::segmented_vector<std::int64_t, 1024, counting_allocator<std::int64_t> > >("segmented_vector<int64_t, 1024>", n);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
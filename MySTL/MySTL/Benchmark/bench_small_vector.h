@@ -0,0 +1,54 @@
+#ifndef INCLUDED_BENCH_SMALL_VECTOR_H
+#define INCLUDED_BENCH_SMALL_VECTOR_H
+
+#include <cstddef>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/small_vector.h"
+
+namespace MySTL
+{
+	namespace BenchSmallVector
+	{
+		using namespace MySTL::Benchmark;
+
+		// build and destroy a container of @k elements @rounds times, the shape of a per-request vector
+		template <typename Container>
+		inline void bench_workload(const char *label, int k, int rounds)
+		{
+			allocation_stats::reset();
+			timer t;
+			long long sum = 0;
+			for (int r = 0; r < rounds; ++r)
+			{
+				Container c;
+				for (int i = 0; i < k; ++i)
+					c.push_back(r + i);
+				for (auto it = c.begin(); it != c.end(); ++it)
+					sum += *it;
+			}
+			const double ns = t.elapsed_ms() * 1e6 / rounds;
+			do_not_optimize(sum);
+
+			std::cout << "-----\t " << label << ", " << k << " elements" << '\n';
+			print_row("latency", ns, "ns/op");
+			print_row("allocations", static_cast<double>(allocation_stats::count()) / rounds, "per op");
+		}
+
+		inline void bench_all()
+		{
+			print_header("small_vector");
+			const int rounds = 1000000;
+			const int sizes[] = { 0, 1, 4, 8, 12, 16 };
+			for (int k : sizes)
+			{
+				bench_workload<MySTL::vector<int, counting_allocator<int> > >("vector<int>", k, rounds);
+				bench_workload<MySTL::small_vector<int, 8, counting_allocator<int> > >("small_vector<int, 8>", k, rounds);
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef INCLUDED_BENCH_SOA_VECTOR_H
+#define INCLUDED_BENCH_SOA_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+#include "../Declaration/soa_vector.h"
+
+namespace MySTL
+{
+	namespace BenchSoaVector
+	{
+		using namespace MySTL::Benchmark;
+
+		// a 48-byte trade record; the kernels below read one or two of its fields
+		struct trade
+		{
+			std::int64_t id;
+			std::int64_t timestamp;
+			double price;
+			double quantity;
+			std::int32_t venue;
+			std::int32_t flags;
+			double fee;
+		};
+
+		typedef MySTL::soa_vector<std::int64_t, std::int64_t, double, double, std::int32_t, std::int32_t, double> trade_columns;
+
+		inline void bench_all()
+		{
+			print_header("soa_vector vs vector<struct>");
+			const std::size_t n = 4 * 1000 * 1000;
+			const int rounds = 20;
+
+			MySTL::vector<trade> aos;
+			trade_columns soa;
+			aos.reserve(n);
+			soa.reserve(n);
+			double build_aos, build_soa;
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+				{
+					trade r = { static_cast<std::int64_t>(i), static_cast<std::int64_t>(i * 10), 100.0 + i % 7, 1.0 + i % 3,
+						static_cast<std::int32_t>(i % 5), 0, 0.01 };
+					aos.push_back(r);
+				}
+				build_aos = t.elapsed_ms();
+			}
+			{
+				timer t;
+				for (std::size_t i = 0; i != n; ++i)
+					soa.emplace_back(static_cast<std::int64_t>(i), static_cast<std::int64_t>(i * 10), 100.0 + i % 7, 1.0 + i % 3,
+						static_cast<std::int32_t>(i % 5), 0, 0.01);
+				build_soa = t.elapsed_ms();
+			}
+			std::cout << "-----\t build " << n << " rows" << '\n';
+			print_row("vector<trade>::push_back", build_aos, "ms");
+			print_row("soa_vector::emplace_back", build_soa, "ms");
+
+			// one field: sum(price)
+			double aos_ms, soa_ms, sum = 0;
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+					for (std::size_t i = 0; i != n; ++i)
+						sum += aos[i].price;
+				aos_ms = t.elapsed_ms();
+			}
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+					for (double p : soa.column<2>())
+						sum += p;
+				soa_ms = t.elapsed_ms();
+			}
+			do_not_optimize(sum);
+			std::cout << "-----\t sum(price) x " << rounds << '\n';
+			print_row("vector<trade>", n * rounds / 1e6 / (aos_ms / 1000.0), "M rows/s");
+			print_row("soa_vector column", n * rounds / 1e6 / (soa_ms / 1000.0), "M rows/s");
+
+			// two fields: notional = sum(price * quantity)
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+					for (std::size_t i = 0; i != n; ++i)
+						sum += aos[i].price * aos[i].quantity;
+				aos_ms = t.elapsed_ms();
+			}
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+				{
+					MySTL::span<double> price = soa.column<2>(), quantity = soa.column<3>();
+					for (std::size_t i = 0; i != price.size(); ++i)
+						sum += price.data()[i] * quantity.data()[i];
+				}
+				soa_ms = t.elapsed_ms();
+			}
+			do_not_optimize(sum);
+			std::cout << "-----\t sum(price * quantity) x " << rounds << '\n';
+			print_row("vector<trade>", n * rounds / 1e6 / (aos_ms / 1000.0), "M rows/s");
+			print_row("soa_vector columns", n * rounds / 1e6 / (soa_ms / 1000.0), "M rows/s");
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
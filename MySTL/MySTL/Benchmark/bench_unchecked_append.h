@@ -0,0 +1,87 @@
+#ifndef INCLUDED_BENCH_UNCHECKED_APPEND_H
+#define INCLUDED_BENCH_UNCHECKED_APPEND_H
+
+#include <cstddef>
+#include <new>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchUncheckedAppend
+	{
+		using namespace MySTL::Benchmark;
+
+		struct point
+		{
+			point() {}
+			point(float x, float y, float z, int id) : x(x), y(y), z(z), id(id) {}
+			float x, y, z;
+			int id;
+		};
+
+		inline int make(std::size_t i, int) { return static_cast<int>(i * 3 + 1); }
+		inline point make(std::size_t i, point) { return point(i * 0.5f, i * 0.25f, 1.0f, static_cast<int>(i)); }
+
+		// append @n elements @rounds times into a vector whose capacity is already reserved,
+		// so only the per-element cost is measured
+		template <typename T>
+		inline void bench_type(const char *label, std::size_t n, int rounds)
+		{
+			MySTL::vector<T> v;
+			v.reserve(n);
+			double push_ms, unchecked_ms, window_ms;
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+				{
+					v.clear();
+					for (std::size_t i = 0; i != n; ++i)
+						v.push_back(make(i, T()));
+					do_not_optimize(v.back());
+				}
+				push_ms = t.elapsed_ms();
+			}
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+				{
+					v.clear();
+					for (std::size_t i = 0; i != n; ++i)
+						v.unchecked_push_back(make(i, T()));
+					do_not_optimize(v.back());
+				}
+				unchecked_ms = t.elapsed_ms();
+			}
+			{
+				timer t;
+				for (int r = 0; r < rounds; ++r)
+				{
+					v.clear();
+					T *w = v.reserve_back(n);
+					for (std::size_t i = 0; i != n; ++i)
+						::new (static_cast<void*>(w + i)) T(make(i, T()));
+					v.commit_back(n);
+					do_not_optimize(v.back());
+				}
+				window_ms = t.elapsed_ms();
+			}
+			const double total = static_cast<double>(n) * rounds / 1e6;
+			std::cout << "-----\t " << label << ", " << n << " elements x " << rounds << '\n';
+			print_row("push_back", total / (push_ms / 1000.0), "M/s");
+			print_row("unchecked_push_back", total / (unchecked_ms / 1000.0), "M/s");
+			print_row("reserve_back + commit_back", total / (window_ms / 1000.0), "M/s");
+		}
+
+		inline void bench_all()
+		{
+			print_header("unchecked append");
+			bench_type<int>("vector<int>", 1 << 16, 2000);
+			bench_type<point>("vector<point>, 16 bytes", 1 << 16, 1000);
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
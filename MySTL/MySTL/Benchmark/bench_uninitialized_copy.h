@@ -0,0 +1,116 @@
+#ifndef INCLUDED_BENCH_UNINITIALIZED_COPY_H
+#define INCLUDED_BENCH_UNINITIALIZED_COPY_H
+
+#include <thread>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "bench_common.h"
+#include "../Declaration/uninitialized_functions.h"
+
+namespace MySTL
+{
+	namespace BenchUninitializedCopy
+	{
+		using namespace MySTL::Benchmark;
+
+		// copy bandwidth of @bytes under @policy, best of @rounds
+		template <typename CopyPolicy>
+		inline double copy_bandwidth(std::size_t bytes, int rounds, CopyPolicy policy)
+		{
+			char *src = static_cast<char*>(std::malloc(bytes));
+			char *dst = static_cast<char*>(std::malloc(bytes));
+			std::memset(src, 1, bytes);
+			std::memset(dst, 0, bytes);		// fault the pages in before timing
+
+			double best = 1e300;
+			for (int r = 0; r < rounds; ++r)
+			{
+				timer t;
+				MySTL::uninitialized_copy(src, src + bytes, dst, policy);
+				double ms = t.elapsed_ms();
+				if (ms < best)
+					best = ms;
+			}
+			do_not_optimize(dst[bytes - 1]);
+			std::free(src);
+			std::free(dst);
+			return (bytes / (1024.0 * 1024.0 * 1024.0)) / (best / 1000.0);	// GB/s
+		}
+
+		// a second thread keeps re-reading a small hot working set while we copy @bytes over and
+		// over under @policy; returns the hot loop throughput (M reads/s)
+		template <typename CopyPolicy>
+		inline double hot_loop_throughput(std::size_t bytes, int copies, CopyPolicy policy)
+		{
+			const std::size_t hot_size = 512 * 1024 / sizeof(int);	// fits in L2/L3
+			int *hot = new int[hot_size];
+			for (std::size_t i = 0; i != hot_size; ++i)
+				hot[i] = static_cast<int>(i);
+
+			char *src = static_cast<char*>(std::malloc(bytes));
+			char *dst = static_cast<char*>(std::malloc(bytes));
+			std::memset(src, 1, bytes);
+			std::memset(dst, 0, bytes);
+
+			std::atomic<bool> stop(false);
+			std::atomic<long long> reads(0);
+			std::thread reader([&]()
+			{
+				long long n = 0, sum = 0;
+				// stride over cache lines so every read is a potential miss
+				while (!stop.load(std::memory_order_relaxed))
+				{
+					for (std::size_t i = 0; i < hot_size; i += 16)
+						sum += hot[i];
+					n += hot_size / 16;
+				}
+				reads = n;
+				do_not_optimize(sum);
+			});
+
+			timer t;
+			for (int c = 0; c < copies; ++c)
+				MySTL::uninitialized_copy(src, src + bytes, dst, policy);
+			stop = true;
+			reader.join();
+			double ms = t.elapsed_ms();
+
+			std::free(src);
+			std::free(dst);
+			delete[] hot;
+			return reads / 1e6 / (ms / 1000.0);
+		}
+
+		inline void bench_bandwidth()
+		{
+			const std::size_t sizes[] = { 64 * 1024, 1024 * 1024, 8 * 1024 * 1024, 64 * 1024 * 1024, 256 * 1024 * 1024 };
+			for (std::size_t bytes : sizes)
+			{
+				std::cout << "-----\t " << bytes / 1024 << " KB" << '\n';
+				print_row("temporal (memcpy)", copy_bandwidth(bytes, 5, temporal_copy_tag()), "GB/s");
+				print_row("streaming (non-temporal)", copy_bandwidth(bytes, 5, streaming_copy_tag()), "GB/s");
+				print_row("adaptive", copy_bandwidth(bytes, 5, adaptive_copy_tag()), "GB/s");
+			}
+		}
+
+		inline void bench_cache_pollution()
+		{
+			const std::size_t bytes = 64 * 1024 * 1024;
+			std::cout << "-----\t hot loop while copying " << bytes / (1024 * 1024) << " MB" << '\n';
+			print_row("hot loop, temporal copy", hot_loop_throughput(bytes, 10, temporal_copy_tag()), "M reads/s");
+			print_row("hot loop, streaming copy", hot_loop_throughput(bytes, 10, streaming_copy_tag()), "M reads/s");
+		}
+
+		inline void bench_all()
+		{
+			print_header("uninitialized_copy");
+			bench_bandwidth();
+			bench_cache_pollution();
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
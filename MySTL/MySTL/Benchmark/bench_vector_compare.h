@@ -0,0 +1,92 @@
+#ifndef INCLUDED_BENCH_VECTOR_COMPARE_H
+#define INCLUDED_BENCH_VECTOR_COMPARE_H
+
+#include <cstddef>
+
+#include "bench_common.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace BenchVectorCompare
+	{
+		using namespace MySTL::Benchmark;
+
+		// the element-by-element loops the operators used to run, as the baseline
+		template <typename T>
+		inline bool loop_equal(const MySTL::vector<T> &lhs, const MySTL::vector<T> &rhs)
+		{
+			if (lhs.size() != rhs.size())
+				return false;
+			for (auto p = lhs.begin(), q = rhs.begin(); p != lhs.end(); ++p, ++q)
+				if (!(*p == *q))
+					return false;
+			return true;
+		}
+
+		template <typename T>
+		inline bool loop_less(const MySTL::vector<T> &lhs, const MySTL::vector<T> &rhs)
+		{
+			auto p = lhs.begin(), q = rhs.begin();
+			for (; p != lhs.end() && q != rhs.end(); ++p, ++q)
+			{
+				if (*p < *q) return true;
+				if (*q < *p) return false;
+			}
+			return p == lhs.end() && q != rhs.end();
+		}
+
+		// two vectors that differ in the last element only: both comparisons read everything
+		template <typename T>
+		inline void bench_size(const char *label, std::size_t n)
+		{
+			MySTL::vector<T> a(n, T(7)), b(n, T(7));
+			b[n - 1] = T(8);
+			const int rounds = static_cast<int>(200 * 1000 * 1000 / n) + 1;
+			bool r = false;
+			double ms[4];
+
+			timer t0;
+			for (int i = 0; i < rounds; ++i) { r ^= loop_equal(a, b); do_not_optimize(r); }
+			ms[0] = t0.elapsed_ms();
+			timer t1;
+			for (int i = 0; i < rounds; ++i) { r ^= (a == b); do_not_optimize(r); }
+			ms[1] = t1.elapsed_ms();
+			timer t2;
+			for (int i = 0; i < rounds; ++i) { r ^= loop_less(a, b); do_not_optimize(r); }
+			ms[2] = t2.elapsed_ms();
+			timer t3;
+			for (int i = 0; i < rounds; ++i) { r ^= (a < b); do_not_optimize(r); }
+			ms[3] = t3.elapsed_ms();
+
+			const double gb = static_cast<double>(n) * sizeof(T) * 2 * rounds / (1024.0 * 1024 * 1024);
+			std::cout << "-----\t " << label << ", " << n << " elements" << '\n';
+			print_row("== element loop", gb / (ms[0] / 1000.0), "GB/s");
+			print_row("== (memcmp)", gb / (ms[1] / 1000.0), "GB/s");
+			print_row("<  element loop", gb / (ms[2] / 1000.0), "GB/s");
+			print_row("<  (mismatch kernel)", gb / (ms[3] / 1000.0), "GB/s");
+		}
+
+		inline void bench_all()
+		{
+			print_header("vector relational operators");
+			const std::size_t sizes[] = { 1000, 100 * 1000, 10 * 1000 * 1000 };
+			for (std::size_t n : sizes)
+			{
+				bench_size<int>("vector<int>", n);
+				bench_size<char>("vector<char>", n);
+			}
+
+			// different sizes: equality answers without looking at the elements
+			MySTL::vector<int> a(10 * 1000 * 1000, 1), b(10 * 1000 * 1000 - 1, 1);
+			timer t;
+			bool r = false;
+			for (int i = 0; i < 1000; ++i) { r ^= (a == b); do_not_optimize(r); }
+			std::cout << "-----\t == on different sizes, 10M elements" << '\n';
+			print_row("== (size mismatch)", t.elapsed_ms() * 1e6 / 1000, "ns/op");
+			std::cout << std::endl;
+		}
+	}
+}
+
+#endif
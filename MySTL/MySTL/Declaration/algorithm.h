@@ -0,0 +1,448 @@
+#ifndef INCLUDED_ALGORITHM_H
+#define INCLUDED_ALGORITHM_H
+
+// implementation of
+// copy, copy_backward, move, move_backward, fill, fill_n, equal, mismatch, lexicographical_compare,
+// find, find_if, search, remove_if
+//
+// When the iterators are contiguous (see contiguous_iterator_tag) and the elements are trivial,
+// the algorithms lower to memmove / memset / memcmp and the kernels of simd_kernels.h; every
+// other combination takes the element-wise loop.
+#include <cstring>          // function:    memmove, memset, memcmp
+#include <cstddef>          // size_t
+#include <cstdint>          // uint32_t
+#include <utility>          // struct:      std::pair, function: std::move
+#include <type_traits>      // struct:      is_same, remove_cv, integral_constant, is_integral ...
+#include "iterator.h"       // struct:      iterator_traits, contiguous_iterator_tag
+#include "type_traits.h"    // struct:      _type_traits
+#include "simd_kernels.h"   // function:    _mismatch_bytes, _find_byte, _find_u32
+
+
+namespace MySTL
+{
+    //////////////////////////////////////////////
+    // dispatch traits
+    template <typename Iterator>
+    struct _iterator_value
+    {
+        typedef typename std::remove_cv<typename iterator_traits<Iterator>::value_type>::type type;
+    };
+
+    // both sides contiguous and holding the same type
+    template <typename Iterator1, typename Iterator2>
+    struct _contiguous_same_type
+        : std::integral_constant<bool,
+            _is_contiguous_iterator<Iterator1>::value && _is_contiguous_iterator<Iterator2>::value &&
+            std::is_same<typename _iterator_value<Iterator1>::type, typename _iterator_value<Iterator2>::type>::value> {};
+
+    // assignment may be replaced by memmove
+    template <typename InputIterator, typename OutputIterator>
+    struct _is_memmove_copyable
+        : std::integral_constant<bool,
+            _contiguous_same_type<InputIterator, OutputIterator>::value &&
+            std::is_same<typename _type_traits<typename _iterator_value<InputIterator>::type>::has_trivial_assignment_operator, _true_type>::value> {};
+
+    // move assignment may be replaced by memmove as well
+    template <typename InputIterator, typename OutputIterator>
+    struct _is_memmove_movable
+        : std::integral_constant<bool,
+            _is_memmove_copyable<InputIterator, OutputIterator>::value &&
+            std::is_trivially_move_assignable<typename _iterator_value<InputIterator>::type>::value> {};
+
+    // operator== is bitwise equality and operator< follows from the first differing element
+    // (integers, enums and pointers; not floating point: -0.0 == 0.0, NaN != NaN)
+    template <typename T>
+    struct _is_trivially_comparable
+        : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+    template <typename Iterator1, typename Iterator2>
+    struct _is_memcmp_comparable
+        : std::integral_constant<bool,
+            _contiguous_same_type<Iterator1, Iterator2>::value &&
+            _is_trivially_comparable<typename _iterator_value<Iterator1>::type>::value> {};
+
+
+    //////////////////////////////////////////////
+    // copy
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator _copy_dispatch(InputIterator first, InputIterator last, OutputIterator result, std::false_type)
+    {
+        for (; first != last; ++first, ++result)
+            *result = *first;
+        return result;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator _copy_dispatch(InputIterator first, InputIterator last, OutputIterator result, std::true_type)
+    {
+        typedef typename _iterator_value<InputIterator>::type T;
+        const std::ptrdiff_t n = last - first;
+        if (n > 0)  // ranges may overlap
+            std::memmove(_to_address(result), _to_address(first), sizeof(T) * static_cast<std::size_t>(n));
+        return result + n;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result)
+    {
+        typedef typename _is_memmove_copyable<InputIterator, OutputIterator>::type MEMMOVE;
+        return _copy_dispatch(first, last, result, MEMMOVE());
+    }
+
+
+    //////////////////////////////////////////////
+    // copy_backward
+    template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+    inline BidirectionalIterator2 _copy_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result, std::false_type)
+    {
+        while (first != last)
+            *--result = *--last;
+        return result;
+    }
+
+    template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+    inline BidirectionalIterator2 _copy_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result, std::true_type)
+    {
+        typedef typename _iterator_value<BidirectionalIterator1>::type T;
+        const std::ptrdiff_t n = last - first;
+        if (n > 0)
+            std::memmove(_to_address(result - n), _to_address(first), sizeof(T) * static_cast<std::size_t>(n));
+        return result - n;
+    }
+
+    template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+    inline BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result)
+    {
+        typedef typename _is_memmove_copyable<BidirectionalIterator1, BidirectionalIterator2>::type MEMMOVE;
+        return _copy_backward_dispatch(first, last, result, MEMMOVE());
+    }
+
+
+    //////////////////////////////////////////////
+    // move: as copy, but the elements are move assigned
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator _move_dispatch(InputIterator first, InputIterator last, OutputIterator result, std::false_type)
+    {
+        for (; first != last; ++first, ++result)
+            *result = std::move(*first);
+        return result;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator _move_dispatch(InputIterator first, InputIterator last, OutputIterator result, std::true_type)
+    {
+        return _copy_dispatch(first, last, result, std::true_type());
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    inline OutputIterator move(InputIterator first, InputIterator last, OutputIterator result)
+    {
+        typedef typename _is_memmove_movable<InputIterator, OutputIterator>::type MEMMOVE;
+        return _move_dispatch(first, last, result, MEMMOVE());
+    }
+
+
+    //////////////////////////////////////////////
+    // move_backward
+    template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+    inline BidirectionalIterator2 _move_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result, std::false_type)
+    {
+        while (first != last)
+            *--result = std::move(*--last);
+        return result;
+    }
+
+    template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+    inline BidirectionalIterator2 _move_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result, std::true_type)
+    {
+        return _copy_backward_dispatch(first, last, result, std::true_type());
+    }
+
+    template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+    inline BidirectionalIterator2 move_backward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result)
+    {
+        typedef typename _is_memmove_movable<BidirectionalIterator1, BidirectionalIterator2>::type MEMMOVE;
+        return _move_backward_dispatch(first, last, result, MEMMOVE());
+    }
+
+
+    //////////////////////////////////////////////
+    // fill_n
+    template <typename OutputIterator, typename Size, typename T>
+    inline OutputIterator _fill_n_dispatch(OutputIterator first, Size n, const T &x, std::false_type)
+    {
+        for (; n > 0; --n, ++first)
+            *first = x;
+        return first;
+    }
+
+    // one byte objects: memset
+    template <typename OutputIterator, typename Size, typename T>
+    inline OutputIterator _fill_n_dispatch(OutputIterator first, Size n, const T &x, std::true_type)
+    {
+        if (n <= 0)
+            return first;
+        const typename _iterator_value<OutputIterator>::type value = x;
+        unsigned char byte;
+        std::memcpy(&byte, &value, 1);
+        std::memset(_to_address(first), byte, static_cast<std::size_t>(n));
+        return first + n;
+    }
+
+    template <typename OutputIterator, typename Size, typename T>
+    inline OutputIterator fill_n(OutputIterator first, Size n, const T &x)
+    {
+        typedef typename _iterator_value<OutputIterator>::type V;
+        typedef std::integral_constant<bool, _is_contiguous_iterator<OutputIterator>::value && sizeof(V) == 1 &&
+            std::is_same<typename _type_traits<V>::has_trivial_assignment_operator, _true_type>::value> MEMSET;
+        return _fill_n_dispatch(first, n, x, MEMSET());
+    }
+
+
+    //////////////////////////////////////////////
+    // fill
+    template <typename ForwardIterator, typename T>
+    inline void _fill_dispatch(ForwardIterator first, ForwardIterator last, const T &x, std::false_type)
+    {
+        for (; first != last; ++first)
+            *first = x;
+    }
+
+    template <typename ForwardIterator, typename T>
+    inline void _fill_dispatch(ForwardIterator first, ForwardIterator last, const T &x, std::true_type)
+    {
+        MySTL::fill_n(first, last - first, x);
+    }
+
+    template <typename ForwardIterator, typename T>
+    inline void fill(ForwardIterator first, ForwardIterator last, const T &x)
+    {
+        typedef typename _is_contiguous_iterator<ForwardIterator>::type CONTIGUOUS;
+        _fill_dispatch(first, last, x, CONTIGUOUS());
+    }
+
+
+    //////////////////////////////////////////////
+    // mismatch
+    template <typename InputIterator1, typename InputIterator2>
+    inline std::pair<InputIterator1, InputIterator2> _mismatch_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, std::false_type)
+    {
+        for (; first1 != last1 && *first1 == *first2; ++first1, ++first2);
+        return std::pair<InputIterator1, InputIterator2>(first1, first2);
+    }
+
+    template <typename InputIterator1, typename InputIterator2>
+    inline std::pair<InputIterator1, InputIterator2> _mismatch_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, std::true_type)
+    {
+        typedef typename _iterator_value<InputIterator1>::type T;
+        const std::ptrdiff_t n = last1 - first1;
+        if (n <= 0)
+            return std::pair<InputIterator1, InputIterator2>(first1, first2);
+        const std::ptrdiff_t i = static_cast<std::ptrdiff_t>(
+            _mismatch_bytes(_to_address(first1), _to_address(first2), sizeof(T) * static_cast<std::size_t>(n)) / sizeof(T));
+        return std::pair<InputIterator1, InputIterator2>(first1 + i, first2 + i);
+    }
+
+    template <typename InputIterator1, typename InputIterator2>
+    inline std::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+    {
+        typedef typename _is_memcmp_comparable<InputIterator1, InputIterator2>::type MEMCMP;
+        return _mismatch_dispatch(first1, last1, first2, MEMCMP());
+    }
+
+
+    //////////////////////////////////////////////
+    // equal
+    template <typename InputIterator1, typename InputIterator2>
+    inline bool _equal_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, std::false_type)
+    {
+        for (; first1 != last1; ++first1, ++first2)
+        {
+            if (!(*first1 == *first2))
+                return false;
+        }
+        return true;
+    }
+
+    template <typename InputIterator1, typename InputIterator2>
+    inline bool _equal_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, std::true_type)
+    {
+        typedef typename _iterator_value<InputIterator1>::type T;
+        const std::ptrdiff_t n = last1 - first1;
+        return n <= 0 || std::memcmp(_to_address(first1), _to_address(first2), sizeof(T) * static_cast<std::size_t>(n)) == 0;
+    }
+
+    template <typename InputIterator1, typename InputIterator2>
+    inline bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+    {
+        typedef typename _is_memcmp_comparable<InputIterator1, InputIterator2>::type MEMCMP;
+        return _equal_dispatch(first1, last1, first2, MEMCMP());
+    }
+
+
+    //////////////////////////////////////////////
+    // lexicographical_compare
+    template <typename InputIterator1, typename InputIterator2>
+    inline bool _lexicographical_compare_dispatch(InputIterator1 first1, InputIterator1 last1,
+        InputIterator2 first2, InputIterator2 last2, std::false_type)
+    {
+        for (; first1 != last1 && first2 != last2; ++first1, ++first2)
+        {
+            if (*first1 < *first2)
+                return true;
+            if (*first2 < *first1)
+                return false;
+        }
+        return first1 == last1 && first2 != last2;
+    }
+
+    // the first differing element decides, the SIMD mismatch kernel finds it
+    template <typename InputIterator1, typename InputIterator2>
+    inline bool _lexicographical_compare_dispatch(InputIterator1 first1, InputIterator1 last1,
+        InputIterator2 first2, InputIterator2 last2, std::true_type)
+    {
+        const std::ptrdiff_t len1 = last1 - first1, len2 = last2 - first2;
+        const std::ptrdiff_t n = len1 < len2 ? len1 : len2;
+        std::pair<InputIterator1, InputIterator2> m = _mismatch_dispatch(first1, first1 + n, first2, std::true_type());
+        if (m.first != first1 + n)
+            return *m.first < *m.second;
+        return len1 < len2;
+    }
+
+    template <typename InputIterator1, typename InputIterator2>
+    inline bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+    {
+        typedef typename _is_memcmp_comparable<InputIterator1, InputIterator2>::type MEMCMP;
+        return _lexicographical_compare_dispatch(first1, last1, first2, last2, MEMCMP());
+    }
+
+
+    //////////////////////////////////////////////
+    // find
+    template <typename InputIterator, typename T>
+    inline InputIterator _find_dispatch(InputIterator first, InputIterator last, const T &value, std::integral_constant<int, 0>)
+    {
+        for (; first != last && !(*first == value); ++first);
+        return first;
+    }
+
+    // one byte integers: memchr
+    template <typename InputIterator, typename T>
+    inline InputIterator _find_dispatch(InputIterator first, InputIterator last, const T &value, std::integral_constant<int, 1>)
+    {
+        typedef typename _iterator_value<InputIterator>::type V;
+        if (first == last || static_cast<V>(value) != value)    // value not representable: not found
+            return last;
+        const V v = static_cast<V>(value);
+        unsigned char byte;
+        std::memcpy(&byte, &v, 1);
+        return first + _find_byte(_to_address(first), static_cast<std::size_t>(last - first), byte);
+    }
+
+    // four byte integers: SSE2 compare
+    template <typename InputIterator, typename T>
+    inline InputIterator _find_dispatch(InputIterator first, InputIterator last, const T &value, std::integral_constant<int, 4>)
+    {
+        typedef typename _iterator_value<InputIterator>::type V;
+        if (first == last || static_cast<V>(value) != value)
+            return last;
+        const V v = static_cast<V>(value);
+        std::uint32_t word;
+        std::memcpy(&word, &v, 4);
+        return first + _find_u32(reinterpret_cast<const std::uint32_t*>(_to_address(first)), static_cast<std::size_t>(last - first), word);
+    }
+
+    template <typename InputIterator, typename T>
+    inline InputIterator find(InputIterator first, InputIterator last, const T &value)
+    {
+        typedef typename _iterator_value<InputIterator>::type V;
+        const bool lowered = _is_contiguous_iterator<InputIterator>::value && std::is_integral<V>::value
+            && std::is_integral<T>::value && !std::is_same<V, bool>::value;
+        typedef std::integral_constant<int, lowered && (sizeof(V) == 1 || sizeof(V) == 4) ? static_cast<int>(sizeof(V)) : 0> KERNEL;
+        return _find_dispatch(first, last, value, KERNEL());
+    }
+
+
+    //////////////////////////////////////////////
+    // find_if
+    template <typename InputIterator, typename UnaryPredicate>
+    inline InputIterator find_if(InputIterator first, InputIterator last, UnaryPredicate pred)
+    {
+        for (; first != last && !pred(*first); ++first);
+        return first;
+    }
+
+
+    //////////////////////////////////////////////
+    // search
+    template <typename ForwardIterator1, typename ForwardIterator2>
+    inline ForwardIterator1 _search_dispatch(ForwardIterator1 first1, ForwardIterator1 last1,
+        ForwardIterator2 first2, ForwardIterator2 last2, std::false_type)
+    {
+        for (;; ++first1)
+        {
+            ForwardIterator1 it1 = first1;
+            for (ForwardIterator2 it2 = first2;; ++it1, ++it2)
+            {
+                if (it2 == last2)
+                    return first1;
+                if (it1 == last1)
+                    return last1;
+                if (!(*it1 == *it2))
+                    break;
+            }
+        }
+    }
+
+    // jump between candidates with find (memchr / SSE2), verify them with memcmp
+    template <typename ForwardIterator1, typename ForwardIterator2>
+    inline ForwardIterator1 _search_dispatch(ForwardIterator1 first1, ForwardIterator1 last1,
+        ForwardIterator2 first2, ForwardIterator2 last2, std::true_type)
+    {
+        typedef typename _iterator_value<ForwardIterator1>::type T;
+        const std::ptrdiff_t m = last2 - first2;
+        if (m <= 0)
+            return first1;
+        const T head = *first2;
+        for (ForwardIterator1 stop = last1 - (m - 1); first1 < stop; ++first1)
+        {
+            first1 = MySTL::find(first1, stop, head);
+            if (first1 == stop)
+                break;
+            if (std::memcmp(_to_address(first1), _to_address(first2), sizeof(T) * static_cast<std::size_t>(m)) == 0)
+                return first1;
+        }
+        return last1;
+    }
+
+    template <typename ForwardIterator1, typename ForwardIterator2>
+    inline ForwardIterator1 search(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2)
+    {
+        typedef typename _is_memcmp_comparable<ForwardIterator1, ForwardIterator2>::type MEMCMP;
+        return _search_dispatch(first1, last1, first2, last2, MEMCMP());
+    }
+
+
+    //////////////////////////////////////////////
+    // remove_if: one pass, every kept element is moved at most once; returns the new end.
+    // The elements in [new end, last) are left valid but unspecified.
+    template <typename ForwardIterator, typename UnaryPredicate>
+    inline ForwardIterator remove_if(ForwardIterator first, ForwardIterator last, UnaryPredicate pred)
+    {
+        first = MySTL::find_if(first, last, pred);
+        if (first == last)
+            return first;
+        ForwardIterator result = first;
+        for (++first; first != last; ++first)
+        {
+            if (!pred(*first))
+            {
+                *result = std::move(*first);
+                ++result;
+            }
+        }
+        return result;
+    }
+}
+
+#endif
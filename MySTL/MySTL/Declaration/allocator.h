@@ -5,8 +5,11 @@
 
 #include <cstddef>	// ptrdiff_t
 #include <new>	// placement new
+#include <utility>	// std::forward
 #include <algorithm>	// std::max
+#include <climits>	// UINT_MAX
 #include "alloc.h"
+#include "type_traits.h"
 
 namespace MySTL
 {
@@ -46,14 +49,15 @@ namespace MySTL
 		}
 
 
-		static void construct(pointer p) { new (p) T(); }
-		static void construct(pointer p, const_reference v) { new (p) T(v); }
+		// construct a T at @p from @args, forwarded as they were passed
+		template <typename... Args>
+		static void construct(pointer p, Args&&... args) { new (p) T(std::forward<Args>(args)...); }
 
 		static void destroy(pointer p) { p->~T(); }
 		static void destroy(pointer first, pointer last)
 		{
-			for (; first != last; ++first)
-				first->~T();
+			typedef typename _type_traits<T>::has_trivial_destructor TRIVIAL_DESTRUCTOR;
+			_destroy(first, last, TRIVIAL_DESTRUCTOR());
 		}
 
 		
@@ -66,6 +70,15 @@ namespace MySTL
 			return max(size_type(1), size_type(UINT_MAX / sizeof(value_type))); 
 		}
 
+	private:
+		// nothing to do for trivially destructible objects, the loop compiles away
+		static void _destroy(pointer, pointer, _true_type) {}
+		static void _destroy(pointer first, pointer last, _false_type)
+		{
+			for (; first != last; ++first)
+				first->~T();
+		}
+
 	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef INCLUDED_BINARY_IO_H
+#define INCLUDED_BINARY_IO_H
+
+// Binary format for containers: a 32-byte header, then the raw payload.
+//	magic "MSTL", version, kind, endianness, element size, alignment, count, payload bytes
+// The payload starts at the first offset >= 32 aligned for the element type.
+//	kind array			count elements of T, their bytes as they are in memory (vector<T>, T trivially copyable)
+//	kind string			count chars (string)
+//	kind string_table	uint64_t offsets[count + 1], then the characters of every string back to back (vector<string>)
+//
+// save_binary / load_binary copy through a stream in one write / read of the payload.
+// The view_binary_* functions read nothing: they check the header and return views into the
+// buffer, e.g. a file mapped with mapped_file, so loading costs no more than mapping it.
+// A blob is only read back on a machine with the same endianness; a mismatch throws
+// std::runtime_error like any other malformed header.
+#include <cstddef>		// size_t
+#include <cstdint>		// uint8_t, uint32_t, uint64_t
+#include <iosfwd>		// istream, ostream
+
+#include "vector.h"
+#include "string.h"
+#include "span.h"
+
+namespace MySTL
+{
+	struct binary_header
+	{
+		enum kind_type { array_kind = 1, string_kind = 2, string_table_kind = 3 };
+		enum endian_type { little_endian = 1, big_endian = 2 };
+
+		char magic[4];				// "MSTL"
+		std::uint8_t version;
+		std::uint8_t kind;			// kind_type
+		std::uint8_t endian;		// endian_type of the writer
+		std::uint8_t reserved;
+		std::uint32_t element_size;	// sizeof(T); 1 for strings
+		std::uint32_t alignment;	// alignof(T), the payload offset is a multiple of it
+		std::uint64_t count;		// elements, characters or strings
+		std::uint64_t payload_bytes;
+
+		static const std::uint8_t current_version = 1;
+
+		static binary_header make(kind_type kind, std::size_t element_size, std::size_t alignment, std::size_t count, std::size_t payload_bytes);
+		static std::uint8_t native_endian();
+		std::size_t payload_offset() const;	// where the payload starts, from the start of the header
+		std::size_t total_bytes() const { return payload_offset() + static_cast<std::size_t>(payload_bytes); }
+		// throw std::runtime_error unless this header is one of @kind for elements of @element_size / @alignment
+		void check(kind_type kind, std::size_t element_size, std::size_t alignment) const;
+	};
+
+
+	// the strings of a string_table blob, without copying them
+	class string_table_view
+	{
+	public:
+		typedef std::size_t size_type;
+
+	public:
+		string_table_view() : offsets(nullptr), chars(nullptr), count(0) {}
+		string_table_view(const std::uint64_t *offsets, const char *chars, size_type count) : offsets(offsets), chars(chars), count(count) {}
+
+		size_type size() const { return count; }
+		bool empty() const { return count == 0; }
+		span<const char> operator[](size_type i) const
+		{
+			return span<const char>(chars + offsets[i], static_cast<size_type>(offsets[i + 1] - offsets[i]));
+		}
+
+	private:
+		const std::uint64_t *offsets;	// count + 1 offsets into chars
+		const char *chars;
+		size_type count;
+	};
+
+
+	// write: header + payload
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void save_binary(std::ostream &os, const vector<T, Alloc, GrowthPolicy> &v);
+	void save_binary(std::ostream &os, const string &s);
+	template <typename Alloc, typename GrowthPolicy>
+	void save_binary(std::ostream &os, const vector<string, Alloc, GrowthPolicy> &v);
+
+	// read: the container is replaced by the contents of the blob
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void load_binary(std::istream &is, vector<T, Alloc, GrowthPolicy> &v);
+	void load_binary(std::istream &is, string &s);
+	template <typename Alloc, typename GrowthPolicy>
+	void load_binary(std::istream &is, vector<string, Alloc, GrowthPolicy> &v);
+
+	// zero-copy read of a blob at @data (@size bytes); the views live as long as the buffer
+	template <typename T>
+	span<const T> view_binary_array(const void *data, std::size_t size);
+	span<const char> view_binary_string(const void *data, std::size_t size);
+	string_table_view view_binary_string_table(const void *data, std::size_t size);
+}
+
+#include "../Implementation/binary_io_impl.h"
+
+#endif // INCLUDED_BINARY_IO_H
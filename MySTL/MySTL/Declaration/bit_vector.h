@@ -0,0 +1,276 @@
+#ifndef INCLUDED_BIT_VECTOR_H
+#define INCLUDED_BIT_VECTOR_H
+
+// vector<bool>: one bit per element, packed into 64-bit words.
+// Element i is bit (i % 64) of word i / 64; the bits of the last word past size() are kept 0,
+// so count(), find_first() and operator== can work on whole words without masking.
+// operator[] returns a proxy (_bit_reference) and the iterators are bit iterators, so there is
+// no bool& and no data(); words() gives the packed storage instead.
+// The words come from allocator<uint64_t>, Alloc is only kept for the vector<T, Alloc> signature.
+// On top of the vector interface:
+//	count / any / none					popcnt over the words
+//	find_first / find_next				word scans, npos when there is no set bit
+//	set / reset / flip					all bits, or a range of bits a word at a time
+//	&= |= ^= and & | ^					word-wise, SSE2 where available; both sides must have the same size
+#include <initializer_list>
+#include <cstddef>		// size_t, ptrdiff_t
+#include <cstdint>		// uint64_t
+#include <type_traits>	// is_integral
+
+#include "vector.h"
+#include "allocator.h"
+#include "iterator.h"
+#include "growth_policy.h"
+#include "simd_kernels.h"	// _popcount_words, _bitwise_words, _count_trailing_zeros64
+
+namespace MySTL
+{
+	typedef std::uint64_t _bit_word;
+	const std::size_t _bits_per_word = 64;
+
+
+	// proxy for one bit: a word and the mask of the bit in it
+	class _bit_reference
+	{
+	public:
+		_bit_reference(_bit_word *p, _bit_word mask) : p(p), mask(mask) {}
+
+		operator bool() const { return (*p & mask) != 0; }
+		_bit_reference& operator=(bool x)
+		{
+			if (x) *p |= mask;
+			else *p &= ~mask;
+			return *this;
+		}
+		_bit_reference& operator=(const _bit_reference &x) { return *this = static_cast<bool>(x); }
+		bool operator~() const { return !static_cast<bool>(*this); }
+		void flip() { *p ^= mask; }
+
+	private:
+		_bit_word *p;
+		_bit_word mask;
+	};
+
+	inline void swap(_bit_reference x, _bit_reference y)
+	{
+		bool tmp = x;
+		x = y;
+		y = tmp;
+	}
+
+
+	// Ref / WordPtr select the iterator (_bit_reference, _bit_word*) or the const_iterator (bool, const _bit_word*)
+	template <typename Ref, typename WordPtr>
+	class _bit_iterator
+	{
+	public:
+		typedef random_access_iterator_tag iterator_category;
+		typedef bool value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef void pointer;
+		typedef Ref reference;
+		typedef _bit_iterator self;
+
+	public:
+		_bit_iterator() : p(nullptr), offset(0) {}
+		_bit_iterator(WordPtr p, unsigned offset) : p(p), offset(offset) {}
+		// iterator -> const_iterator
+		template <typename R, typename P>
+		_bit_iterator(const _bit_iterator<R, P> &it) : p(it.p), offset(it.offset) {}
+
+		reference operator*() const { return _deref(p, _bit_word(1) << offset); }
+		reference operator[](difference_type n) const { return *(*this + n); }
+
+		self& operator++()
+		{
+			if (++offset == _bits_per_word) { offset = 0; ++p; }
+			return *this;
+		}
+		self operator++(int) { self tmp = *this; ++*this; return tmp; }
+		self& operator--()
+		{
+			if (offset-- == 0) { offset = _bits_per_word - 1; --p; }
+			return *this;
+		}
+		self operator--(int) { self tmp = *this; --*this; return tmp; }
+		self& operator+=(difference_type n)
+		{
+			difference_type bit = static_cast<difference_type>(offset) + n;
+			difference_type words = bit / static_cast<difference_type>(_bits_per_word);
+			bit %= static_cast<difference_type>(_bits_per_word);
+			if (bit < 0) { bit += _bits_per_word; --words; }
+			p += words;
+			offset = static_cast<unsigned>(bit);
+			return *this;
+		}
+		self& operator-=(difference_type n) { return *this += -n; }
+		self operator+(difference_type n) const { self tmp = *this; return tmp += n; }
+		self operator-(difference_type n) const { self tmp = *this; return tmp -= n; }
+		difference_type operator-(const self &it) const
+		{
+			return (p - it.p) * static_cast<difference_type>(_bits_per_word) + static_cast<difference_type>(offset) - static_cast<difference_type>(it.offset);
+		}
+
+		bool operator==(const self &it) const { return p == it.p && offset == it.offset; }
+		bool operator!=(const self &it) const { return !(*this == it); }
+		bool operator< (const self &it) const { return p < it.p || (p == it.p && offset < it.offset); }
+		bool operator> (const self &it) const { return it < *this; }
+		bool operator<=(const self &it) const { return !(it < *this); }
+		bool operator>=(const self &it) const { return !(*this < it); }
+
+	private:
+		template <typename, typename> friend class _bit_iterator;
+		template <typename, typename, typename> friend class vector;
+
+		static _bit_reference _deref(_bit_word *p, _bit_word mask) { return _bit_reference(p, mask); }
+		static bool _deref(const _bit_word *p, _bit_word mask) { return (*p & mask) != 0; }
+
+	private:
+		WordPtr p;			// the word of the bit
+		unsigned offset;	// the bit in it, 0 ~ 63
+	};
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	class vector<bool, Alloc, GrowthPolicy>
+	{
+	public:
+		using size_type              = std::size_t;
+		using value_type             = bool;
+		using reference              = _bit_reference;
+		using const_reference        = bool;
+		using iterator               = _bit_iterator<_bit_reference, _bit_word*>;
+		using const_iterator         = _bit_iterator<bool, const _bit_word*>;
+		using difference_type        = std::ptrdiff_t;
+		using word_type              = _bit_word;
+		using allocator_type         = Alloc;
+		using growth_policy          = GrowthPolicy;
+
+		static const size_type bits_per_word = _bits_per_word;
+		static const size_type npos = static_cast<size_type>(-1);	// find_first / find_next: no set bit
+
+	protected:
+		using data_allocator         = allocator<word_type>;
+
+	public:
+		vector() : words_start(nullptr), bits(0), word_capacity(0) {}	// constructor: default
+		vector(const vector &v);										// constructor: copy
+		vector(vector &&v) noexcept;									// constructor: move
+		explicit vector(size_type n, bool val = false);					// constructor: fill
+		vector(std::initializer_list<bool> il);							// constructor: initializer_list
+		template <typename InputIterator>
+		vector(InputIterator first, InputIterator last);				// constructor: range
+
+		vector& operator=(const vector &rhs);							// assign content: copy
+		vector& operator=(vector &&rhs) noexcept;						// assign content: move
+		vector& operator=(std::initializer_list<bool> il);				// assign content: initializer list
+		~vector();														// destructor
+
+		// Element Access
+		reference operator[](size_type n) { return reference(words_start + n / bits_per_word, _mask(n)); }
+		const_reference operator[](size_type n) const { return test(n); }
+		reference at(size_type n);										// access element, range checked
+		const_reference at(size_type n) const;
+		reference front() { return (*this)[0]; }						// access first element
+		const_reference front() const { return test(0); }
+		reference back() { return (*this)[bits - 1]; }					// access last element
+		const_reference back() const { return test(bits - 1); }
+		bool test(size_type n) const { return (words_start[n / bits_per_word] & _mask(n)) != 0; }
+		word_type* words() { return words_start; }						// the packed storage, word_count() words
+		const word_type* words() const { return words_start; }
+		size_type word_count() const { return _words_for(bits); }
+
+		// Iterators
+		iterator begin() { return iterator(words_start, 0); }
+		iterator end() { return begin() + static_cast<difference_type>(bits); }
+		const_iterator begin() const { return const_iterator(words_start, 0); }
+		const_iterator end() const { return begin() + static_cast<difference_type>(bits); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		// Modifiers
+		void push_back(bool val);										// add element at the end
+		void pop_back();												// delete last element
+		iterator insert(const_iterator position, bool val);				// insert elements: single element
+		iterator insert(const_iterator position, size_type n, bool val);// insert elements: fill
+		iterator erase(const_iterator position);						// erase elements: single element
+		iterator erase(const_iterator first, const_iterator last);		// erase elements: range
+		void clear() { bits = 0; }										// clear content
+		void swap(vector &v) noexcept;									// swap content
+
+		// Bit operations, a word at a time
+		vector& set();													// every bit to 1
+		vector& set(size_type first, size_type last);					// bits [first, last) to 1
+		vector& reset();												// every bit to 0
+		vector& reset(size_type first, size_type last);					// bits [first, last) to 0
+		vector& flip();													// invert every bit
+		void flip(size_type n) { words_start[n / bits_per_word] ^= _mask(n); }
+		size_type count() const { return _popcount_words(words_start, word_count()); }	// number of set bits
+		bool any() const;												// any bit set
+		bool none() const { return !any(); }							// no bit set
+		size_type find_first() const;									// first set bit, or npos
+		size_type find_next(size_type pos) const;						// first set bit after @pos, or npos
+		vector& operator&=(const vector &rhs);
+		vector& operator|=(const vector &rhs);
+		vector& operator^=(const vector &rhs);
+
+		// Capacity
+		size_type size() const { return bits; }						// return size
+		static size_type max_size() { return static_cast<size_type>(-1) / 2; }	// return maximum size
+		size_type capacity() const { return word_capacity * bits_per_word; }	// return bits the storage holds
+		bool empty() const { return bits == 0; }						// test whether vector is empty
+		void resize(size_type n, bool val = false);						// change size
+		void reserve(size_type n);										// request a change in capacity, in bits
+		void shrink_to_fit();											// shrink to fit
+
+	private:
+		static size_type _words_for(size_type bits) { return (bits + bits_per_word - 1) / bits_per_word; }
+		static word_type _mask(size_type n) { return word_type(1) << (n % bits_per_word); }
+		size_type _index(const_iterator it) const { return static_cast<size_type>(it - begin()); }
+
+		void _reallocate(size_type words);								// move the used words into a block of @words
+		void _grow_to(size_type n);										// size n, the new bits are left 0
+		void _fill(size_type first, size_type last, bool val);			// bits [first, last) to @val, inside the size
+		void _clear_tail();												// zero the bits of the last word past size()
+
+		template <typename InputIterator>
+		void _vector(InputIterator first, InputIterator last, std::false_type);
+		void _vector(size_type n, bool val, std::true_type);
+
+	private:
+		word_type *words_start;		// packed bits
+		size_type bits;				// bits in use
+		size_type word_capacity;	// allocated words
+	};
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator==(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator!=(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator< (const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator<=(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator> (const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator>=(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy> operator&(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy> operator|(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy> operator^(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs);
+}
+
+#include "../Implementation/bit_vector_impl.h"
+
+#endif // INCLUDED_BIT_VECTOR_H
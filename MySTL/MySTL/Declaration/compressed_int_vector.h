@@ -0,0 +1,142 @@
+#ifndef INCLUDED_COMPRESSED_INT_VECTOR_H
+#define INCLUDED_COMPRESSED_INT_VECTOR_H
+
+// compressed_int_vector<T>: an append-only sequence of uint32_t / uint64_t, compressed in blocks
+// of 128 values. Meant for long sorted ID lists, which shrink to a few bits per value.
+// Every full block is encoded on its own:
+//	delta		non-decreasing blocks: the gaps between neighbours, from the first value
+//	frame		other blocks: the distance of every value from the smallest one
+//	raw			the 128 values as they are, when packing would not save anything
+// The gaps / distances are bit-packed at the width that makes the block smallest; the few that
+// don't fit it (outliers) are stored after the packed words as (position, varint value) pairs.
+// The packed words interleave 4 lanes, see _unpack_lanes_u32, so decoding unpacks four values per
+// SSE2 instruction and the delta blocks are summed up four at a time as well.
+// The last, partial block stays uncompressed until it fills up.
+// One skip entry per block (value of the first element / the frame, where its words start) makes
+// operator[] one block decode, and lower_bound a binary search over the blocks plus one decode.
+// Scan with for_each() or the iterators: both decode a block at a time into a buffer.
+#include <cstddef>		// size_t, ptrdiff_t
+#include <cstdint>		// uint8_t, uint16_t, uint32_t, uint64_t
+#include <type_traits>	// is_same
+
+#include "vector.h"
+#include "iterator.h"
+#include "simd_kernels.h"	// _unpack_lanes_u32, _prefix_sum_u32
+
+namespace MySTL
+{
+	template <typename T>
+	class compressed_int_vector
+	{
+		static_assert(std::is_same<T, std::uint32_t>::value || std::is_same<T, std::uint64_t>::value,
+			"compressed_int_vector holds uint32_t or uint64_t");
+
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using const_reference        = T;
+		using difference_type        = std::ptrdiff_t;
+
+		static const size_type block_size = 128;
+
+		// forward iterator over the values, with the decoded block inside
+		class const_iterator
+		{
+		public:
+			typedef forward_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const T* pointer;
+			typedef const T& reference;
+
+		public:
+			const_iterator() : owner(nullptr), index(0) {}
+			const_iterator(const compressed_int_vector *owner, size_type index) : owner(owner), index(index)
+			{
+				if (index < owner->size())
+					owner->decode_block(index / block_size, buffer);
+			}
+
+			reference operator*() const { return buffer[index % block_size]; }
+			pointer operator->() const { return buffer + index % block_size; }
+			const_iterator& operator++()
+			{
+				if (++index % block_size == 0 && index < owner->size())
+					owner->decode_block(index / block_size, buffer);
+				return *this;
+			}
+			const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+			bool operator==(const const_iterator &it) const { return index == it.index; }
+			bool operator!=(const const_iterator &it) const { return index != it.index; }
+
+		private:
+			const compressed_int_vector *owner;
+			size_type index;
+			T buffer[block_size];	// the block of index
+		};
+		using iterator = const_iterator;
+
+	public:
+		compressed_int_vector() : tail_size(0) {}						// constructor: default
+		template <typename InputIterator>
+		compressed_int_vector(InputIterator first, InputIterator last);	// constructor: range
+
+		// Element Access, read only: the values are encoded
+		value_type operator[](size_type n) const;						// decodes the block of @n
+		value_type at(size_type n) const;								// access element, range checked
+		value_type front() const { return (*this)[0]; }
+		value_type back() const { return (*this)[size() - 1]; }
+		// first position whose value is >= @val, size() if none; the contents must be sorted
+		size_type lower_bound(value_type val) const;
+
+		// Iterators
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, size()); }
+
+		// Bulk decoding
+		template <typename Function>
+		void for_each(Function f) const;								// f(value) for every value, in order
+		void decode(value_type *out) const;								// all size() values to @out
+		size_type block_count() const { return blocks.size() + (tail_size ? 1 : 0); }
+		size_type decode_block(size_type b, value_type *out) const;	// the values of block @b to @out, returns how many
+
+		// Modifiers
+		void push_back(value_type val);									// add element at the end
+		void clear();													// clear content
+		void swap(compressed_int_vector &v);							// swap content
+		void shrink_to_fit();											// release the spare capacity of the encoded data
+
+		// Capacity
+		size_type size() const { return blocks.size() * block_size + tail_size; }
+		bool empty() const { return size() == 0; }
+		size_type memory_bytes() const;									// bytes of the encoded data, skip entries and tail
+
+	private:
+		enum block_mode { delta_mode, frame_mode, raw_mode };
+
+		// skip entry of a full block
+		struct block_info
+		{
+			std::size_t offset;		// first word of the block in words
+			T base;					// delta / raw: the first value; frame: the smallest value
+			std::uint8_t mode;		// block_mode
+			std::uint8_t width;		// bits per packed value, 0 ~ 32
+			std::uint16_t outliers;	// (position, varint) pairs after the 4 * width packed words
+		};
+
+		void _encode_block();											// tail -> a new block
+		static unsigned _bit_length(T x);
+		static unsigned _varint_length(T x);
+
+	private:
+		vector<block_info> blocks;
+		vector<std::uint32_t> words;	// the encoded blocks one after another
+		T tail[block_size];				// the values of the partial block
+		size_type tail_size;
+	};
+}
+
+#include "../Implementation/compressed_int_vector_impl.h"
+
+#endif // INCLUDED_COMPRESSED_INT_VECTOR_H
@@ -0,0 +1,129 @@
+#ifndef INCLUDED_CONCURRENT_VECTOR_H
+#define INCLUDED_CONCURRENT_VECTOR_H
+
+// concurrent_vector<T, FirstSegment>: an append-only sequence that many threads push into at once.
+// Storage is laid out like segmented_vector (segment k holds FirstSegment << k elements), so
+// elements never move and a reference stays valid while other threads keep appending.
+//	push_back / grow_by	claim their slots with one atomic fetch-add, construct the elements in
+//						place, then set their bits in the ready bitmap of the segment
+//	size / end			the published prefix: the longest run of ready slots from the front.
+//						Whoever asks advances a shared cursor over the bitmap, so writers never
+//						wait on each other, and readers may iterate [begin(), end()) while
+//						writers are still appending
+// The only lock is taken when a segment is added, about once per doubling. Alloc is called under
+// it, the pool allocator behind allocator<T> is not thread-safe. The constructor adds the first
+// segment, so an iterator taken before the first push is still good.
+// An element whose constructor throws stays a hole: the published prefix stops in front of it,
+// as the slot holds no object a reader could step over. The elements pushed after it are still
+// built; pending_size() counts the slots past the prefix and is_ready(n) tells which hold one.
+// clear(), reserve() and destruction must not overlap with any other call.
+#include <cstddef>		// size_t, ptrdiff_t
+#include <cstdint>		// uint64_t
+#include <atomic>
+#include <mutex>
+
+#include "allocator.h"
+#include "iterator.h"
+#include "segmented_vector.h"	// _segmented_iterator
+#include "simd_kernels.h"		// _floor_log2, _count_trailing_zeros64
+
+namespace MySTL
+{
+	template <typename T, std::size_t FirstSegment = 16, typename Alloc = allocator<T> >
+	class concurrent_vector
+	{
+		static_assert(FirstSegment > 0 && (FirstSegment & (FirstSegment - 1)) == 0, "FirstSegment must be a power of two");
+
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using difference_type        = std::ptrdiff_t;
+		using iterator               = _segmented_iterator<T, T&, T*, FirstSegment, std::atomic<T*> >;
+		using const_iterator         = _segmented_iterator<T, const T&, const T*, FirstSegment, std::atomic<T*> >;
+		using allocator_type         = Alloc;
+
+		static const size_type first_segment = FirstSegment;
+		static const size_type max_segments  = sizeof(size_type) * 8;
+
+	protected:
+		using data_allocator         = Alloc;
+		using word_allocator         = allocator<std::atomic<std::uint64_t> >;
+
+	public:
+		concurrent_vector();											// constructor: default
+		~concurrent_vector();											// destructor
+
+		concurrent_vector(const concurrent_vector &) = delete;
+		concurrent_vector& operator=(const concurrent_vector &) = delete;
+
+		// Element Access: @n must be published, pushed by the calling thread, or seen by is_ready(n)
+		reference operator[](size_type n) { return *_address(n); }		// access element
+		const_reference operator[](size_type n) const { return *_address(n); }
+		reference at(size_type n);										// access element, checked against size()
+		bool is_ready(size_type n) const;								// test whether slot @n holds a constructed element
+
+		// Iterators: [begin(), end()) is the prefix published when end() was called
+		iterator begin() { return iterator(table, 0); }
+		iterator end() { return iterator(table, size()); }
+		const_iterator begin() const { return const_iterator(table, 0); }
+		const_iterator end() const { return const_iterator(table, size()); }
+
+		// Modifiers, safe to call from any number of threads at once
+		void push_back(const_reference val);							// add element at the end
+		void push_back(value_type &&val);								// add element at the end: move
+		template <typename... Args>
+		reference emplace_back(Args&&... args);							// construct element at the end
+		size_type grow_by(size_type n);									// add @n value initialized elements, returns the index of the first
+		size_type grow_by(size_type n, const_reference val);			// add @n copies of @val, returns the index of the first
+		template <typename InputIterator>
+		size_type grow_by(InputIterator first, InputIterator last);	// add a copy of a range, returns the index of the first
+
+		// Modifiers, not to be called concurrently
+		void clear();													// destroy the elements, keep the segments
+		void reserve(size_type n);										// allocate segments up to @n elements
+
+		// Capacity
+		size_type size() const;											// return the published prefix, advances it first
+		size_type claimed_size() const { return claimed.load(std::memory_order_acquire); }// return slots handed out, published or not
+		size_type pending_size() const;									// return slots handed out past the published prefix
+		size_type capacity() const { return _segment_start(segments.load(std::memory_order_acquire)); }// return elements the allocated segments hold
+		bool empty() const { return size() == 0; }						// test whether nothing is published
+
+	private:
+		// element i lives in segment _segment_of(i), at offset i - _segment_start(k)
+		static size_type _segment_of(size_type i) { return _floor_log2(i / FirstSegment + 1); }
+		static size_type _segment_start(size_type k) { return FirstSegment * ((size_type(1) << k) - 1); }
+		static size_type _segment_size(size_type k) { return FirstSegment << k; }
+		static size_type _word_count(size_type k) { return (_segment_size(k) + 63) / 64; }
+
+		pointer _address(size_type i) const
+		{
+			const size_type k = _segment_of(i);
+			return table[k].load(std::memory_order_acquire) + (i - _segment_start(k));
+		}
+		size_type _claim(size_type n);					// fetch-add @n slots, makes sure their segments exist
+		template <typename Construct>
+		size_type _grow(size_type n, Construct construct);	// claim @n slots, construct(p) each, publish them
+		void _add_segments(size_type k);				// allocate segments up to and including @k
+		void _publish(size_type first, size_type last);	// set the ready bits of [first, last)
+		void _free();
+
+		// one lock for every concurrent_vector: allocate / deallocate may reach the pool allocator
+		static std::mutex& _segment_mutex() { static std::mutex m; return m; }
+
+	private:
+		std::atomic<size_type> claimed;							// slots handed out
+		mutable std::atomic<size_type> published;				// every slot below is constructed
+		std::atomic<size_type> segments;						// segments allocated
+		std::atomic<T*> table[max_segments];					// segment k has _segment_size(k) elements
+		std::atomic<std::atomic<std::uint64_t>*> ready[max_segments];	// bit i: slot i of the segment is constructed
+	};
+}
+
+#include "../Implementation/concurrent_vector_impl.h"
+
+#endif // INCLUDED_CONCURRENT_VECTOR_H
@@ -2,6 +2,7 @@
 #define INCLUDED_CONSTRUCT_H
 
 #include <new>
+#include <utility>  // std::forward
 #include "type_traits.h"
 #include "iterator.h"
 
@@ -11,9 +12,9 @@ namespace MySTL
 	static void construct(T1 *p) { new (p) T2(); }
 
     template <typename T1, typename T2>
-    inline void construct(T1 *p, const T2 &value)
+    inline void construct(T1 *p, T2 &&value)
     {
-        new (p) T1(value);  // placement new; invoke T1:T1(value)
+        new (p) T1(std::forward<T2>(value));  // placement new; invoke T1:T1(value), or T1:T1(T1&&) for rvalues
     }
 
     //////////////////////////////////////////////
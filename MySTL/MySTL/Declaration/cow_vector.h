@@ -0,0 +1,156 @@
+#ifndef INCLUDED_COW_VECTOR_H
+#define INCLUDED_COW_VECTOR_H
+
+// cow_vector<T>: a vector whose copies share one buffer, for tables that are published once and
+// read by many. The buffer carries an atomic reference count:
+//	copy			bumps the count, O(1) whatever the size; nothing is allocated
+//	const access	reads the shared buffer, never copies
+//	mutation		any non-const access (operator[], begin(), data(), push_back, ...) first makes
+//					the buffer private: copied when others share it, used as is when they do not
+// Distinct cow_vectors may be used from different threads at once even when they share a buffer;
+// one cow_vector is no more thread-safe than a vector. A reference, pointer or iterator obtained
+// through non-const access must not be written through once the vector has been copied again:
+// the copy shares what it points into.
+// The count sits in front of the elements in one block from Alloc. Blocks are allocated and
+// freed under one lock for every cow_vector, the last owner may release a buffer from any
+// thread and the pool allocator behind allocator<T> is not thread-safe.
+#include <initializer_list>
+#include <cstddef>		// size_t, ptrdiff_t
+#include <atomic>
+#include <mutex>
+#include <type_traits>	// true_type, false_type
+
+#include "allocator.h"
+#include "vector.h"
+
+namespace MySTL
+{
+	// one lock for every cow_vector: a buffer may be freed by whichever thread drops it last
+	inline std::mutex& _cow_alloc_mutex() { static std::mutex m; return m; }
+
+
+	template <typename T, typename Alloc = allocator<T> >
+	class cow_vector
+	{
+	public:
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using iterator               = T*;
+		using const_iterator         = T const *;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using difference_type        = std::ptrdiff_t;
+		using size_type              = std::size_t;
+		using allocator_type         = Alloc;
+
+	protected:
+		using data_allocator         = Alloc;
+
+		// the head of a buffer, in the first header_slots elements of the block
+		struct _rep
+		{
+			std::atomic<size_type> refs;
+			size_type size;
+			size_type capacity;
+		};
+		static const size_type header_slots = (sizeof(_rep) + sizeof(T) - 1) / sizeof(T);
+
+	public:
+		cow_vector() : rep(nullptr) {}									// constructor: default
+		explicit cow_vector(size_type n);								// constructor: fill
+		cow_vector(size_type n, const_reference val);					// constructor: fill
+		template <typename ForwardIterator>
+		cow_vector(ForwardIterator first, ForwardIterator last);		// constructor: range
+		cow_vector(std::initializer_list<value_type> il);				// constructor: initializer_list
+		explicit cow_vector(const vector<T> &v);						// constructor: copy of a vector
+		cow_vector(const cow_vector &x) : rep(x.rep) { _retain(); }		// constructor: copy, shares the buffer
+		cow_vector(cow_vector &&x) noexcept : rep(x.rep) { x.rep = nullptr; }	// constructor: move
+		cow_vector& operator=(const cow_vector &x);						// assign content: share
+		cow_vector& operator=(cow_vector &&x) noexcept;					// assign content: move
+		~cow_vector() { _release(rep); }								// destructor
+
+		// Element Access, const: reads the shared buffer
+		const_reference operator[](size_type n) const { return _data()[n]; }	// access element
+		const_reference at(size_type n) const;							// access element, throws out_of_range
+		const_reference front() const { return *_data(); }				// access first element
+		const_reference back() const { return _data()[size() - 1]; }	// access last element
+		const_pointer data() const { return _data(); }					// get pointer to data
+
+		// Element Access, non-const: makes the buffer private first
+		reference operator[](size_type n) { return _mutable_data()[n]; }
+		reference at(size_type n);
+		reference front() { return *_mutable_data(); }
+		reference back() { return _mutable_data()[size() - 1]; }
+		pointer data() { return _mutable_data(); }
+
+		// Iterators
+		iterator begin() { return _mutable_data(); }					// makes the buffer private
+		iterator end() { return _mutable_data() + size(); }
+		const_iterator begin() const { return _data(); }
+		const_iterator end() const { return _data() + size(); }
+		const_iterator cbegin() const { return _data(); }
+		const_iterator cend() const { return _data() + size(); }
+
+		// Capacity
+		size_type size() const { return rep ? rep->size : 0; }			// return size
+		bool empty() const { return size() == 0; }						// test whether vector is empty
+		size_type capacity() const { return rep ? rep->capacity : 0; }	// return size of allocated storage capacity
+		void reserve(size_type n);										// request a change in capacity, the buffer becomes private
+
+		// Sharing
+		size_type use_count() const { return rep ? rep->refs.load(std::memory_order_acquire) : 0; }// return cow_vectors sharing the buffer
+		bool unique() const { return use_count() == 1; }				// test whether the buffer is private
+
+		// Modifiers
+		void push_back(const_reference val) { emplace_back(val); }		// add element at the end
+		void push_back(value_type &&val) { emplace_back(std::move(val)); }
+		template <typename... Args>
+		void emplace_back(Args&&... args);								// construct and insert element at the end
+		void pop_back();												// delete last element
+		iterator insert(const_iterator position, const_reference val);	// insert element
+		iterator erase(const_iterator position) { return erase(position, position + 1); }// erase element
+		iterator erase(const_iterator first, const_iterator last);		// erase elements: range
+		void resize(size_type n) { resize(n, value_type()); }			// change size
+		void resize(size_type n, const_reference val);
+		void clear();													// clear content, a shared buffer is only let go
+		void swap(cow_vector &x) { _rep *tmp = rep; rep = x.rep; x.rep = tmp; }// swap content
+
+	protected:
+		static T* _elements(_rep *r) { return reinterpret_cast<T*>(r) + header_slots; }
+		T* _data() const { return rep ? _elements(rep) : nullptr; }
+		T* _mutable_data() { if (rep && !_unique()) _make_unique(rep->capacity); return _data(); }
+		bool _unique() const { return rep->refs.load(std::memory_order_acquire) == 1; }
+
+		void _retain() const { if (rep) rep->refs.fetch_add(1, std::memory_order_relaxed); }
+		static void _release(_rep *r);									// drop one reference, free on the last
+		static _rep* _allocate(size_type capacity);						// count 1, size 0
+		static void _deallocate(_rep *r);
+
+		void _make_unique(size_type capacity);							// private buffer of at least @capacity
+		template <typename... Args>
+		void _emplace_back_aux(Args&&... args);							// emplace_back into a new buffer
+		void _fill_initialize(size_type n, const_reference val);
+		template <typename Integer>
+		void _range_initialize(Integer n, Integer val, std::true_type);	// (n, val) that matched the range constructor
+		template <typename ForwardIterator>
+		void _range_initialize(ForwardIterator first, ForwardIterator last, std::false_type);
+		size_type _grown_capacity(size_type n) const { size_type c = capacity() * 2; return c < n ? n : c; }
+
+	protected:
+		_rep *rep;		// nullptr when empty and never allocated
+	};
+
+	template <typename T, typename Alloc>
+	bool operator==(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs);
+	template <typename T, typename Alloc>
+	bool operator!=(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs) { return !(lhs == rhs); }
+	template <typename T, typename Alloc>
+	bool operator<(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs);
+	template <typename T, typename Alloc>
+	void swap(cow_vector<T, Alloc>& x, cow_vector<T, Alloc>& y) { x.swap(y); }
+}
+
+#include "../Implementation/cow_vector_impl.h"
+
+#endif // INCLUDED_COW_VECTOR_H
@@ -0,0 +1,98 @@
+#ifndef INCLUDED_FLAT_MAP_H
+#define INCLUDED_FLAT_MAP_H
+
+// flat_map<Key, T, Compare>: the interface of map on a sorted vector of pair<Key, T>, see
+// flat_tree.h. Lookups binary search one contiguous array instead of chasing tree nodes, which
+// is what read-heavy tables want; build them in bulk (range constructor, range insert) rather
+// than one insert at a time. The key of a value must not be changed through an iterator.
+// Iterators and references are invalidated by every insert and erase, as with vector.
+#include <initializer_list>
+#include <functional>	// less
+#include <utility>		// pair
+#include <stdexcept>	// out_of_range
+
+#include "flat_tree.h"
+
+namespace MySTL
+{
+	template <typename Key, typename T, typename Compare = std::less<Key> >
+	class flat_map : public _flat_tree<Key, std::pair<Key, T>, _select1st, Compare, true>
+	{
+		using base = _flat_tree<Key, std::pair<Key, T>, _select1st, Compare, true>;
+
+	public:
+		using mapped_type            = T;
+		using typename base::key_type;
+		using typename base::value_type;
+		using typename base::size_type;
+		using typename base::iterator;
+		using typename base::const_iterator;
+
+	public:
+		flat_map() {}													// constructor: default
+		explicit flat_map(const Compare &comp) : base(comp) {}
+		template <typename InputIterator>
+		flat_map(InputIterator first, InputIterator last, const Compare &comp = Compare())// constructor: range, sorted and deduplicated
+			: base(first, last, comp) {}
+		template <typename InputIterator>
+		flat_map(sorted_unique_t, InputIterator first, InputIterator last, const Compare &comp = Compare())// constructor: range, already sorted and unique
+			: base(sorted_unique, first, last, comp) {}
+		flat_map(std::initializer_list<value_type> il, const Compare &comp = Compare())// constructor: initializer_list
+			: base(il.begin(), il.end(), comp) {}
+
+		// Element Access
+		T& operator[](const key_type &k) { return this->_try_emplace(k).first->second; }	// access element, inserted if missing
+		T& operator[](key_type &&k) { return this->_try_emplace(std::move(k)).first->second; }
+		T& at(const key_type &k);										// access element, throws out_of_range if missing
+		const T& at(const key_type &k) const;
+
+		// Modifiers
+		template <typename M>
+		std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj);	// insert, or assign to the mapped value
+	};
+
+	template <typename Key, typename T, typename Compare>
+	bool operator==(const flat_map<Key, T, Compare>& lhs, const flat_map<Key, T, Compare>& rhs) { return lhs.container() == rhs.container(); }
+
+	template <typename Key, typename T, typename Compare>
+	bool operator!=(const flat_map<Key, T, Compare>& lhs, const flat_map<Key, T, Compare>& rhs) { return !(lhs == rhs); }
+
+	template <typename Key, typename T, typename Compare>
+	void swap(flat_map<Key, T, Compare>& x, flat_map<Key, T, Compare>& y) { x.swap(y); }
+
+
+	template <typename Key, typename T, typename Compare>
+	T& flat_map<Key, T, Compare>::at(const key_type &k)
+	{
+		iterator it = this->_find(k);
+		if (it == this->end())
+			throw std::out_of_range("flat_map::at");
+		return it->second;
+	}
+
+
+	template <typename Key, typename T, typename Compare>
+	const T& flat_map<Key, T, Compare>::at(const key_type &k) const
+	{
+		const_iterator it = this->_find(k);
+		if (it == this->end())
+			throw std::out_of_range("flat_map::at");
+		return it->second;
+	}
+
+
+	template <typename Key, typename T, typename Compare>
+	template <typename M>
+	std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::insert_or_assign(const key_type &k, M &&obj)
+	{
+		iterator it = this->_find(k);
+		if (it != this->end())
+		{
+			it->second = std::forward<M>(obj);
+			return std::pair<iterator, bool>(it, false);
+		}
+		return this->_insert_unique(value_type(k, std::forward<M>(obj)));
+	}
+}
+
+#endif // INCLUDED_FLAT_MAP_H
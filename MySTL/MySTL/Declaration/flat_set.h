@@ -0,0 +1,45 @@
+#ifndef INCLUDED_FLAT_SET_H
+#define INCLUDED_FLAT_SET_H
+
+// flat_set<Key, Compare>: the interface of set on a sorted vector of keys, see flat_tree.h.
+// The iterators are const, as for set. Iterators and references are invalidated by every
+// insert and erase, as with vector.
+#include <initializer_list>
+#include <functional>	// less
+
+#include "flat_tree.h"
+
+namespace MySTL
+{
+	template <typename Key, typename Compare = std::less<Key> >
+	class flat_set : public _flat_tree<Key, Key, _identity, Compare, false>
+	{
+		using base = _flat_tree<Key, Key, _identity, Compare, false>;
+
+	public:
+		using typename base::value_type;
+
+	public:
+		flat_set() {}													// constructor: default
+		explicit flat_set(const Compare &comp) : base(comp) {}
+		template <typename InputIterator>
+		flat_set(InputIterator first, InputIterator last, const Compare &comp = Compare())// constructor: range, sorted and deduplicated
+			: base(first, last, comp) {}
+		template <typename InputIterator>
+		flat_set(sorted_unique_t, InputIterator first, InputIterator last, const Compare &comp = Compare())// constructor: range, already sorted and unique
+			: base(sorted_unique, first, last, comp) {}
+		flat_set(std::initializer_list<value_type> il, const Compare &comp = Compare())// constructor: initializer_list
+			: base(il.begin(), il.end(), comp) {}
+	};
+
+	template <typename Key, typename Compare>
+	bool operator==(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) { return lhs.container() == rhs.container(); }
+
+	template <typename Key, typename Compare>
+	bool operator!=(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) { return !(lhs == rhs); }
+
+	template <typename Key, typename Compare>
+	void swap(flat_set<Key, Compare>& x, flat_set<Key, Compare>& y) { x.swap(y); }
+}
+
+#endif // INCLUDED_FLAT_SET_H
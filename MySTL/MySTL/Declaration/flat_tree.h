@@ -0,0 +1,146 @@
+#ifndef INCLUDED_FLAT_TREE_H
+#define INCLUDED_FLAT_TREE_H
+
+// _flat_tree: the sorted vector behind flat_map and flat_set, the way rb_tree is behind map / set.
+// The values sit in one MySTL::vector ordered by key, with unique keys:
+//	lookup			a branch-free binary search, the compiler turns the step into a cmov
+//	range insert	the new values are sorted and deduplicated on their own, then merged into
+//					the vector from the back in one pass, no element moves twice
+//	construction	from unsorted input: sort + one deduplicating pass; from input known to be
+//					sorted and unique (sorted_unique): a copy
+// Among values of equal keys in one batch, which one is kept is unspecified; a key that is in
+// the tree already keeps its value, as with map::insert.
+// Single inserts and erases shift the tail like vector::insert, fine for read-mostly tables.
+// Mutable is false for flat_set: its iterators are const, a value is its key.
+// With a transparent Compare (one that defines is_transparent, e.g. transparent_less) the lookups
+// take any type Compare can order against the key, a const char * for a string key, say.
+#include <initializer_list>
+#include <cstddef>		// size_t, ptrdiff_t
+#include <functional>	// less
+#include <utility>		// pair
+#include <type_traits>	// conditional
+
+#include "vector.h"
+#include "functional.h"	// transparent_less, _identity, _select1st
+#include "type_traits.h"	// _if_transparent
+
+namespace MySTL
+{
+	// tag: the input is sorted by key and has no duplicate keys
+	struct sorted_unique_t {};
+	const sorted_unique_t sorted_unique = sorted_unique_t();
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	class _flat_tree
+	{
+	public:
+		using key_type               = Key;
+		using value_type             = Value;
+		using key_compare            = Compare;
+		using size_type              = std::size_t;
+		using difference_type        = std::ptrdiff_t;
+		using reference              = Value&;
+		using const_reference        = Value const &;
+		using pointer                = Value*;
+		using const_pointer          = Value const *;
+		using iterator               = typename std::conditional<Mutable, Value*, Value const *>::type;
+		using const_iterator         = Value const *;
+		using container_type         = vector<Value>;
+
+	public:
+		_flat_tree() {}
+		explicit _flat_tree(const Compare &comp) : comp(comp) {}
+		template <typename InputIterator>
+		_flat_tree(InputIterator first, InputIterator last, const Compare &comp);			// sort + deduplicate
+		template <typename InputIterator>
+		_flat_tree(sorted_unique_t, InputIterator first, InputIterator last, const Compare &comp);
+
+		// Iterators
+		iterator begin() { return values.begin(); }
+		iterator end() { return values.end(); }
+		const_iterator begin() const { return values.begin(); }
+		const_iterator end() const { return values.end(); }
+
+		// Capacity
+		size_type size() const { return values.size(); }
+		bool empty() const { return values.empty(); }
+		size_type capacity() const { return values.capacity(); }
+		void reserve(size_type n) { values.reserve(n); }
+		void shrink_to_fit() { values.shrink_to_fit(); }
+
+		// Lookup
+		iterator lower_bound(const key_type &k) { return _lower_bound(k); }
+		const_iterator lower_bound(const key_type &k) const { return _lower_bound(k); }
+		iterator upper_bound(const key_type &k) { return _upper_bound(k); }
+		const_iterator upper_bound(const key_type &k) const { return _upper_bound(k); }
+		iterator find(const key_type &k) { return _find(k); }
+		const_iterator find(const key_type &k) const { return _find(k); }
+		size_type count(const key_type &k) const { return _find(k) != end(); }
+		bool contains(const key_type &k) const { return _find(k) != end(); }
+
+		// Lookup, heterogeneous
+		template <typename K>
+		typename _if_transparent<Compare, iterator, K>::type lower_bound(const K &k) { return _lower_bound(k); }
+		template <typename K>
+		typename _if_transparent<Compare, const_iterator, K>::type lower_bound(const K &k) const { return _lower_bound(k); }
+		template <typename K>
+		typename _if_transparent<Compare, iterator, K>::type upper_bound(const K &k) { return _upper_bound(k); }
+		template <typename K>
+		typename _if_transparent<Compare, const_iterator, K>::type upper_bound(const K &k) const { return _upper_bound(k); }
+		template <typename K>
+		typename _if_transparent<Compare, iterator, K>::type find(const K &k) { return _find(k); }
+		template <typename K>
+		typename _if_transparent<Compare, const_iterator, K>::type find(const K &k) const { return _find(k); }
+		template <typename K>
+		typename _if_transparent<Compare, size_type, K>::type count(const K &k) const { return _find(k) != end(); }
+		template <typename K>
+		typename _if_transparent<Compare, bool, K>::type contains(const K &k) const { return _find(k) != end(); }
+
+		// Modifiers
+		std::pair<iterator, bool> insert(const value_type &val) { return _insert_unique(val); }
+		std::pair<iterator, bool> insert(value_type &&val) { return _insert_unique(std::move(val)); }
+		template <typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args) { return _insert_unique(value_type(std::forward<Args>(args)...)); }
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last);							// sort + deduplicate + merge
+		template <typename InputIterator>
+		void insert(sorted_unique_t, InputIterator first, InputIterator last);			// merge
+		void insert(std::initializer_list<value_type> il) { insert(il.begin(), il.end()); }
+
+		iterator erase(const_iterator position) { return values.erase(_mutable(position)); }
+		iterator erase(const_iterator first, const_iterator last) { return values.erase(_mutable(first), _mutable(last)); }
+		size_type erase(const key_type &k);
+		void clear() { values.clear(); }
+		void swap(_flat_tree &t);
+
+		key_compare key_comp() const { return comp; }
+		const container_type& container() const { return values; }	// the sorted values
+
+	protected:
+		template <typename K>
+		pointer _lower_bound(const K &k) const;
+		template <typename K>
+		pointer _upper_bound(const K &k) const;
+		template <typename K>
+		pointer _find(const K &k) const;
+		pointer _mutable(const_iterator it) const { return values.begin() + (it - values.begin()); }
+
+		template <typename V>
+		std::pair<iterator, bool> _insert_unique(V &&val);
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> _try_emplace(K &&k, Args&&... args);	// value_type(piecewise_construct, k, args), when k is absent
+		void _sort_unique(pointer first);			// sort and deduplicate [first, end())
+		void _merge_tail(size_type n);				// the sorted unique values from n on join [0, n)
+
+		bool _less(const value_type &a, const value_type &b) const { return comp(KeyOfValue()(a), KeyOfValue()(b)); }
+
+	protected:
+		vector<Value> values;
+		Compare comp;
+	};
+}
+
+#include "../Implementation/flat_tree_impl.h"
+
+#endif // INCLUDED_FLAT_TREE_H
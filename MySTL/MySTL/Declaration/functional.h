@@ -0,0 +1,33 @@
+#ifndef INCLUDED_FUNCTIONAL_H
+#define INCLUDED_FUNCTIONAL_H
+
+// function objects shared by the associative containers:
+//	transparent_less	operator< across types, the Compare of a flat_map with heterogeneous lookup
+//	_identity			key of a value that is its own key (flat_set, hash_set)
+//	_select1st			key of a pair<Key, T> (flat_map, hash_map)
+// hash and equal_to, the defaults of hash_map / hash_set, are in hash.h.
+
+namespace MySTL
+{
+	// operator< across types, for heterogeneous lookup
+	struct transparent_less
+	{
+		typedef void is_transparent;
+		template <typename A, typename B>
+		bool operator()(const A &a, const B &b) const { return a < b; }
+	};
+
+	// key of a value: the value itself (flat_set), or its first member (flat_map)
+	struct _identity
+	{
+		template <typename T>
+		const T& operator()(const T &x) const { return x; }
+	};
+	struct _select1st
+	{
+		template <typename Pair>
+		const typename Pair::first_type& operator()(const Pair &x) const { return x.first; }
+	};
+}
+
+#endif // INCLUDED_FUNCTIONAL_H
@@ -0,0 +1,84 @@
+#ifndef INCLUDED_GROWTH_POLICY_H
+#define INCLUDED_GROWTH_POLICY_H
+
+// growth policies for vector (the third template parameter).
+// A policy answers one question: the vector holds @size elements of @elem_size bytes and has
+// to make room for @n more, what is the new capacity (in elements)?
+//
+//	static std::size_t next_capacity(std::size_t size, std::size_t n, std::size_t elem_size);
+//
+// The result is never less than @size + @n.
+//
+//	double_growth			size + max(size, n), i.e. 2x (default)
+//	one_and_half_growth		size + max(size / 2, n), i.e. 1.5x
+//	size_class_growth<P>	P, rounded up to an allocator size class so freed blocks get reused
+//	capped_linear_growth<T, S>	2x below T bytes, then S more bytes at a time
+#include <cstddef>	// size_t
+
+namespace MySTL
+{
+	struct double_growth
+	{
+		static std::size_t next_capacity(std::size_t size, std::size_t n, std::size_t)
+		{
+			return size + (size > n ? size : n);
+		}
+	};
+
+
+	// a factor below the golden ratio lets a block be carved out of the blocks freed before it
+	struct one_and_half_growth
+	{
+		static std::size_t next_capacity(std::size_t size, std::size_t n, std::size_t)
+		{
+			return size + (size / 2 > n ? size / 2 : n);
+		}
+	};
+
+
+	// Round the request of Policy up to a block size the allocator hands out anyway:
+	// multiples of 8 bytes up to 128 bytes (the free lists of alloc), powers of two up to a page,
+	// whole pages above that. The slack becomes capacity instead of being wasted.
+	template <typename Policy = double_growth>
+	struct size_class_growth
+	{
+		enum { SMALL_ALIGN = 8, SMALL_BYTES = 128, PAGE_BYTES = 4096 };
+
+		static std::size_t round_up(std::size_t bytes)
+		{
+			if (bytes <= static_cast<std::size_t>(SMALL_BYTES))
+				return (bytes + SMALL_ALIGN - 1) & ~static_cast<std::size_t>(SMALL_ALIGN - 1);
+			if (bytes <= static_cast<std::size_t>(PAGE_BYTES))
+			{
+				std::size_t block = SMALL_BYTES;
+				while (block < bytes)
+					block <<= 1;
+				return block;
+			}
+			return (bytes + PAGE_BYTES - 1) & ~static_cast<std::size_t>(PAGE_BYTES - 1);
+		}
+
+		static std::size_t next_capacity(std::size_t size, std::size_t n, std::size_t elem_size)
+		{
+			const std::size_t capacity = Policy::next_capacity(size, n, elem_size);
+			return round_up(capacity * elem_size) / elem_size;
+		}
+	};
+
+
+	// Geometric growth wastes up to half of a multi-GB buffer; past @ThresholdBytes grow by
+	// @StepBytes at a time instead (amortized O(n) per push_back there, bounded slack).
+	template <std::size_t ThresholdBytes = 64 * 1024 * 1024, std::size_t StepBytes = 64 * 1024 * 1024>
+	struct capped_linear_growth
+	{
+		static std::size_t next_capacity(std::size_t size, std::size_t n, std::size_t elem_size)
+		{
+			if (size * elem_size < ThresholdBytes)
+				return double_growth::next_capacity(size, n, elem_size);
+			const std::size_t step = StepBytes / elem_size ? StepBytes / elem_size : 1;
+			return size + (step > n ? step : n);
+		}
+	};
+}
+
+#endif
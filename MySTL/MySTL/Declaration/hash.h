@@ -0,0 +1,150 @@
+#ifndef INCLUDED_HASH_H
+#define INCLUDED_HASH_H
+
+// hash<T> and equal_to<T>: the default Hash and KeyEqual of hash_map / hash_set.
+// The swiss table takes 7 bits of the hash for the control byte and the rest for the start of
+// the probe, so every bit has to depend on every bit of the key; std::hash of an integer is the
+// identity on most libraries, these are not:
+//	integers, enums, pointers	the 64-bit finalizer of MurmurHash3
+//	strings						8 bytes per multiply over two lanes, the tail in overlapping loads, then
+//								the same finalizer
+// hash and equal_to of string (MySTL::string or std::string) are transparent: they take a
+// string, a const char * or a span<const char> alike and agree across them, so a table keyed
+// by string is searched with a literal or a slice of a buffer without building a string.
+#include <cstddef>		// size_t
+#include <cstdint>		// uint32_t, uint64_t, uintptr_t
+#include <cstring>		// memcpy, memcmp, strlen
+#include <string>
+#include <type_traits>	// is_integral, is_enum
+
+#include "string.h"
+#include "span.h"
+
+namespace MySTL
+{
+	inline std::uint64_t _hash_mix(std::uint64_t x)
+	{
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return x;
+	}
+
+
+	inline std::uint64_t _hash_load64(const unsigned char *p)
+	{
+		std::uint64_t w;
+		std::memcpy(&w, p, sizeof(w));
+		return w;
+	}
+
+
+	inline std::uint64_t _hash_load32(const unsigned char *p)
+	{
+		std::uint32_t w;
+		std::memcpy(&w, p, sizeof(w));
+		return w;
+	}
+
+
+	inline std::uint64_t _hash_round(std::uint64_t h, std::uint64_t w, std::uint64_t k, unsigned r)
+	{
+		h = (h ^ w) * k;
+		return (h << r) | (h >> (64 - r));
+	}
+
+
+	// the last bytes are read with fixed size loads that may overlap the ones before them, not a
+	// byte loop: the length is in the seed, so the overlap cannot make two keys collide
+	inline std::size_t _hash_bytes(const void *data, std::size_t n)
+	{
+		const std::uint64_t k1 = 0x9e3779b97f4a7c15ULL, k2 = 0xc2b2ae3d27d4eb4fULL;
+		const unsigned char *p = static_cast<const unsigned char*>(data), *last = p + n;
+		std::uint64_t a = k2 ^ n, b = k1;
+		if (n > 16)
+		{
+			for (; last - p > 16; p += 16)
+			{
+				// two independent chains, so the multiplies overlap
+				a = _hash_round(a, _hash_load64(p), k1, 31);
+				b = _hash_round(b, _hash_load64(p + 8), k2, 27);
+			}
+			a = _hash_round(a, _hash_load64(last - 16), k1, 31);
+			b = _hash_round(b, _hash_load64(last - 8), k2, 27);
+		}
+		else if (n >= 8)
+		{
+			a = _hash_round(a, _hash_load64(p), k1, 31);
+			b = _hash_round(b, _hash_load64(last - 8), k2, 27);
+		}
+		else if (n >= 4)
+			b = _hash_round(b, (_hash_load32(p) << 32) | _hash_load32(last - 4), k2, 27);
+		else if (n != 0)
+			b = _hash_round(b, (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[n / 2]) << 8) | p[n - 1], k2, 27);
+		return static_cast<std::size_t>(_hash_mix(a ^ (b * k1)));
+	}
+
+
+	// the characters of a string-like argument (string::data() builds a copy, begin() does not)
+	inline span<const char> _as_chars(const string &s) { return span<const char>(s.begin(), s.size()); }
+	inline span<const char> _as_chars(const std::string &s) { return span<const char>(s.data(), s.size()); }
+	inline span<const char> _as_chars(const char *s) { return span<const char>(s, std::strlen(s)); }
+	inline span<const char> _as_chars(span<const char> s) { return s; }
+
+
+	template <typename T>
+	struct hash
+	{
+		static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "MySTL::hash<T>: no hash for T");
+		std::size_t operator()(T x) const { return static_cast<std::size_t>(_hash_mix(static_cast<std::uint64_t>(x))); }
+	};
+
+	template <typename T>
+	struct hash<T*>
+	{
+		std::size_t operator()(T *p) const { return static_cast<std::size_t>(_hash_mix(reinterpret_cast<std::uintptr_t>(p))); }
+	};
+
+	struct _string_hash
+	{
+		typedef void is_transparent;
+		template <typename S>
+		std::size_t operator()(const S &s) const
+		{
+			const span<const char> c = _as_chars(s);
+			return _hash_bytes(c.data(), c.size());
+		}
+	};
+
+	template <>
+	struct hash<string> : _string_hash {};
+	template <>
+	struct hash<std::string> : _string_hash {};
+
+
+	template <typename T>
+	struct equal_to
+	{
+		bool operator()(const T &a, const T &b) const { return a == b; }
+	};
+
+	struct _string_equal
+	{
+		typedef void is_transparent;
+		template <typename A, typename B>
+		bool operator()(const A &a, const B &b) const
+		{
+			const span<const char> x = _as_chars(a), y = _as_chars(b);
+			return x.size() == y.size() && (x.size() == 0 || std::memcmp(x.data(), y.data(), x.size()) == 0);
+		}
+	};
+
+	template <>
+	struct equal_to<string> : _string_equal {};
+	template <>
+	struct equal_to<std::string> : _string_equal {};
+}
+
+#endif // INCLUDED_HASH_H
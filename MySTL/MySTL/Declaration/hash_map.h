@@ -0,0 +1,108 @@
+#ifndef INCLUDED_HASH_MAP_H
+#define INCLUDED_HASH_MAP_H
+
+// hash_map<Key, T, Hash, KeyEqual>: an unordered map on the open addressing swiss table, see
+// swiss_table.h. The pairs sit in the slots of one flat array, so a hit costs one group of
+// control bytes and one key comparison, and nothing is allocated per element. The key of a value
+// must not be changed through an iterator. A hash_map<string, T> is searched with a const char *
+// or a span<const char> directly.
+#include <initializer_list>
+#include <utility>		// pair
+#include <stdexcept>	// out_of_range
+
+#include "swiss_table.h"
+
+namespace MySTL
+{
+	template <typename Key, typename T, typename Hash = hash<Key>, typename KeyEqual = equal_to<Key> >
+	class hash_map : public _swiss_table<Key, std::pair<Key, T>, _select1st, Hash, KeyEqual, true>
+	{
+		using base = _swiss_table<Key, std::pair<Key, T>, _select1st, Hash, KeyEqual, true>;
+
+	public:
+		using mapped_type            = T;
+		using typename base::key_type;
+		using typename base::value_type;
+		using typename base::size_type;
+		using typename base::iterator;
+		using typename base::const_iterator;
+
+	public:
+		hash_map() {}													// constructor: default
+		explicit hash_map(size_type bucket_count, const Hash &hf = Hash(), const KeyEqual &eq = KeyEqual())
+			: base(bucket_count, hf, eq) {}
+		template <typename InputIterator>
+		hash_map(InputIterator first, InputIterator last, size_type bucket_count = 0, const Hash &hf = Hash(), const KeyEqual &eq = KeyEqual())
+			: base(first, last, bucket_count, hf, eq) {}				// constructor: range, the first of equal keys is kept
+		hash_map(std::initializer_list<value_type> il, size_type bucket_count = 0, const Hash &hf = Hash(), const KeyEqual &eq = KeyEqual())
+			: base(il.begin(), il.end(), bucket_count, hf, eq) {}		// constructor: initializer_list
+
+		// Element Access
+		T& operator[](const key_type &k) { return this->_try_emplace(k).first->second; }	// access element, inserted if missing
+		T& operator[](key_type &&k) { return this->_try_emplace(std::move(k)).first->second; }
+		T& at(const key_type &k);										// access element, throws out_of_range if missing
+		const T& at(const key_type &k) const;
+
+		// Modifiers
+		template <typename... Args>
+		std::pair<iterator, bool> try_emplace(const key_type &k, Args&&... args) { return this->_try_emplace(k, std::forward<Args>(args)...); }	// builds the value only if k is missing
+		template <typename... Args>
+		std::pair<iterator, bool> try_emplace(key_type &&k, Args&&... args) { return this->_try_emplace(std::move(k), std::forward<Args>(args)...); }
+		template <typename M>
+		std::pair<iterator, bool> insert_or_assign(const key_type &k, M &&obj);	// insert, or assign to the mapped value
+	};
+
+	// equal elements, in any order
+	template <typename Key, typename T, typename Hash, typename KeyEqual>
+	bool operator==(const hash_map<Key, T, Hash, KeyEqual>& lhs, const hash_map<Key, T, Hash, KeyEqual>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return false;
+		for (auto it = lhs.begin(); it != lhs.end(); ++it)
+		{
+			auto other = rhs.find(it->first);
+			if (other == rhs.end() || !(other->second == it->second))
+				return false;
+		}
+		return true;
+	}
+
+	template <typename Key, typename T, typename Hash, typename KeyEqual>
+	bool operator!=(const hash_map<Key, T, Hash, KeyEqual>& lhs, const hash_map<Key, T, Hash, KeyEqual>& rhs) { return !(lhs == rhs); }
+
+	template <typename Key, typename T, typename Hash, typename KeyEqual>
+	void swap(hash_map<Key, T, Hash, KeyEqual>& x, hash_map<Key, T, Hash, KeyEqual>& y) { x.swap(y); }
+
+
+	template <typename Key, typename T, typename Hash, typename KeyEqual>
+	T& hash_map<Key, T, Hash, KeyEqual>::at(const key_type &k)
+	{
+		iterator it = this->find(k);
+		if (it == this->end())
+			throw std::out_of_range("hash_map::at");
+		return it->second;
+	}
+
+
+	template <typename Key, typename T, typename Hash, typename KeyEqual>
+	const T& hash_map<Key, T, Hash, KeyEqual>::at(const key_type &k) const
+	{
+		const_iterator it = this->find(k);
+		if (it == this->end())
+			throw std::out_of_range("hash_map::at");
+		return it->second;
+	}
+
+
+	template <typename Key, typename T, typename Hash, typename KeyEqual>
+	template <typename M>
+	std::pair<typename hash_map<Key, T, Hash, KeyEqual>::iterator, bool> hash_map<Key, T, Hash, KeyEqual>::insert_or_assign(const key_type &k, M &&obj)
+	{
+		std::pair<iterator, bool> r = this->_try_emplace(k, std::forward<M>(obj));
+		if (!r.second)
+			r.first->second = std::forward<M>(obj);	// not consumed: the value was not built
+		return r;
+	}
+}
+
+#endif // INCLUDED_HASH_MAP_H
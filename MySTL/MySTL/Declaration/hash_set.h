@@ -0,0 +1,51 @@
+#ifndef INCLUDED_HASH_SET_H
+#define INCLUDED_HASH_SET_H
+
+// hash_set<Key, Hash, KeyEqual>: an unordered set on the open addressing swiss table, see
+// swiss_table.h. The iterators are const, a value is its key.
+#include <initializer_list>
+
+#include "swiss_table.h"
+
+namespace MySTL
+{
+	template <typename Key, typename Hash = hash<Key>, typename KeyEqual = equal_to<Key> >
+	class hash_set : public _swiss_table<Key, Key, _identity, Hash, KeyEqual, false>
+	{
+		using base = _swiss_table<Key, Key, _identity, Hash, KeyEqual, false>;
+
+	public:
+		using typename base::value_type;
+		using typename base::size_type;
+
+	public:
+		hash_set() {}													// constructor: default
+		explicit hash_set(size_type bucket_count, const Hash &hf = Hash(), const KeyEqual &eq = KeyEqual())
+			: base(bucket_count, hf, eq) {}
+		template <typename InputIterator>
+		hash_set(InputIterator first, InputIterator last, size_type bucket_count = 0, const Hash &hf = Hash(), const KeyEqual &eq = KeyEqual())
+			: base(first, last, bucket_count, hf, eq) {}				// constructor: range
+		hash_set(std::initializer_list<value_type> il, size_type bucket_count = 0, const Hash &hf = Hash(), const KeyEqual &eq = KeyEqual())
+			: base(il.begin(), il.end(), bucket_count, hf, eq) {}		// constructor: initializer_list
+	};
+
+	// equal elements, in any order
+	template <typename Key, typename Hash, typename KeyEqual>
+	bool operator==(const hash_set<Key, Hash, KeyEqual>& lhs, const hash_set<Key, Hash, KeyEqual>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return false;
+		for (auto it = lhs.begin(); it != lhs.end(); ++it)
+			if (!rhs.contains(*it))
+				return false;
+		return true;
+	}
+
+	template <typename Key, typename Hash, typename KeyEqual>
+	bool operator!=(const hash_set<Key, Hash, KeyEqual>& lhs, const hash_set<Key, Hash, KeyEqual>& rhs) { return !(lhs == rhs); }
+
+	template <typename Key, typename Hash, typename KeyEqual>
+	void swap(hash_set<Key, Hash, KeyEqual>& x, hash_set<Key, Hash, KeyEqual>& y) { x.swap(y); }
+}
+
+#endif // INCLUDED_HASH_SET_H
@@ -0,0 +1,191 @@
+#ifndef INCLUDED_INPLACE_VECTOR_H
+#define INCLUDED_INPLACE_VECTOR_H
+
+// inplace_vector<T, N>: the interface of vector on a buffer of N elements inside the object.
+// It never allocates: capacity() is N for good, and growing past it throws std::bad_alloc from
+// the vector style calls, while try_push_back / try_emplace_back return nullptr and leave the
+// content alone. Meant for paths where no allocation is allowed, and for small fixed-size lists
+// that should not carry a heap pointer around.
+// When T is trivially copyable so is inplace_vector<T, N>: it copies with one memcpy and can be
+// written out as raw bytes. The size is kept in the smallest unsigned type that holds N.
+#include <initializer_list>
+#include <cstddef>		// ptrdiff_t, size_t
+#include <climits>		// UCHAR_MAX, USHRT_MAX
+#include <type_traits>	// aligned_storage, alignment_of, conditional, is_trivially_copyable
+
+#include "construct.h"
+#include "uninitialized_functions.h"
+
+namespace MySTL
+{
+	// the smallest unsigned type that holds 0 ~ N
+	template <std::size_t N>
+	struct _inplace_size_type
+	{
+		typedef typename std::conditional<N <= UCHAR_MAX, unsigned char,
+			typename std::conditional<N <= USHRT_MAX, unsigned short, std::size_t>::type>::type type;
+	};
+
+	// the buffer and the size, with the copy / move / destructor for T
+	template <typename T, std::size_t N, bool = std::is_trivially_copyable<T>::value>
+	class _inplace_storage
+	{
+	public:
+		_inplace_storage() noexcept : count(0) {}
+		_inplace_storage(const _inplace_storage &s);
+		_inplace_storage(_inplace_storage &&s) noexcept(std::is_nothrow_move_constructible<T>::value);
+		_inplace_storage& operator=(const _inplace_storage &rhs);
+		_inplace_storage& operator=(_inplace_storage &&rhs) noexcept(std::is_nothrow_move_assignable<T>::value && std::is_nothrow_move_constructible<T>::value);
+		~_inplace_storage() { MySTL::destory(_data(), _data() + count); }
+
+	protected:
+		T* _data() { return reinterpret_cast<T*>(buffer); }
+		const T* _data() const { return reinterpret_cast<const T*>(buffer); }
+
+		typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type buffer[N];
+		typename _inplace_size_type<N>::type count;
+	};
+
+	// trivially copyable T: the implicit members copy the bytes, and the object stays trivially copyable
+	template <typename T, std::size_t N>
+	class _inplace_storage<T, N, true>
+	{
+	public:
+		_inplace_storage() noexcept : count(0) {}
+
+	protected:
+		T* _data() { return reinterpret_cast<T*>(buffer); }
+		const T* _data() const { return reinterpret_cast<const T*>(buffer); }
+
+		typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type buffer[N];
+		typename _inplace_size_type<N>::type count;
+	};
+
+
+	template <typename T, std::size_t N>
+	class inplace_vector : private _inplace_storage<T, N>
+	{
+		static_assert(N > 0, "inplace_vector needs room for at least one element");
+
+		using base = _inplace_storage<T, N>;
+
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using iterator               = T*;
+		using const_iterator         = T const *;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using difference_type        = std::ptrdiff_t;
+
+	public:
+		// copy / move / destructor come from _inplace_storage
+		inplace_vector() noexcept {}									// constructor: default
+		explicit inplace_vector(const size_type n);						// constructor: fill
+		inplace_vector(const size_type n, const_reference val);			// constructor: fill
+		inplace_vector(std::initializer_list<value_type> il);			// constructor: initializer_list
+		template<typename InputIterator>
+		inplace_vector(InputIterator first, InputIterator second);		// constructor: range
+
+		inplace_vector& operator=(std::initializer_list<value_type> il);// assign content: initializer list
+
+		// Element Access
+		reference operator[](size_type n) { return begin()[n]; }		// access element
+		const_reference operator[](size_type n) const { return begin()[n]; }
+		reference front() { return *begin(); }							// access first element
+		const_reference front() const { return *begin(); }
+		reference back() { return *(end() - 1); }						// access last element
+		const_reference back() const { return *(end() - 1); }
+		pointer data() { return this->_data(); }						// access data
+		const_pointer data() const { return this->_data(); }
+		reference at(size_type n);										// access element
+
+		// Modifiers: growing past N throws std::bad_alloc, the content is left as it was
+		void assign(size_type n, const_reference val);					// assign content: fill
+		void assign(std::initializer_list<value_type> il);				// assign content: initializer list
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last);			// assign content: range
+
+		void push_back(const_reference val);							// add element at the end
+		void push_back(value_type &&val);								// add element at the end: move
+		template <typename... Args>
+		reference emplace_back(Args&&... args);							// construct element at the end
+		pointer try_push_back(const_reference val);						// push_back, nullptr instead of throwing when full
+		pointer try_push_back(value_type &&val);
+		template <typename... Args>
+		pointer try_emplace_back(Args&&... args);						// emplace_back, nullptr instead of throwing when full
+		void unchecked_push_back(const_reference val);					// push_back that assumes size() < capacity()
+		void unchecked_push_back(value_type &&val);
+		template <typename... Args>
+		reference unchecked_emplace_back(Args&&... args);				// emplace_back that assumes size() < capacity()
+		void pop_back();												// delete last element
+
+		iterator insert(iterator position, const_reference val);		// insert elements: single element
+		iterator insert(iterator position, value_type &&val);			// insert elements: move
+		iterator insert(iterator position, size_type n, const_reference val);// insert elements: fill
+		template<typename InputIterator>
+		iterator insert(iterator position, InputIterator first, InputIterator second);// insert elements: range
+		iterator insert(iterator position, std::initializer_list<value_type> il);// insert elements: initializer list
+		template <typename... Args>
+		iterator emplace(iterator position, Args&&... args);			// construct element in position
+
+		iterator erase(iterator position);								// erase elements: single element
+		iterator erase(iterator first, iterator second);				// erase elements: range
+
+		void clear() noexcept;											// clear content
+		void swap(inplace_vector &x);									// swap content
+
+		// Capacity
+		size_type size() const { return this->count; }					// return size
+		static constexpr size_type max_size() { return N; }			// return maximum size
+		static constexpr size_type capacity() { return N; }			// return size of storage capacity, always N
+		bool empty() const { return this->count == 0; }				// test whether inplace_vector is empty
+		bool full() const { return this->count == N; }					// test whether there is no room left
+		void resize(size_type n, const_reference val = value_type());	// change size
+		void reserve(size_type n);										// throws std::bad_alloc when n > N, else nothing
+		void shrink_to_fit() {}										// nothing to release
+
+		// Iterators
+		iterator begin() { return this->_data(); }						// return iterator to begining
+		iterator end() { return this->_data() + this->count; }			// return iterator to end
+		const_iterator begin() const { return this->_data(); }
+		const_iterator end() const { return this->_data() + this->count; }
+		const_iterator cbegin() const { return begin(); }				// return const_iterator to begining
+		const_iterator cend() const { return end(); }					// return const_iterator to end
+
+	private:
+		void _set_size(size_type n) { this->count = static_cast<typename _inplace_size_type<N>::type>(n); }
+		void _check_room(size_type n) const;							// throws std::bad_alloc when n more elements don't fit
+
+		// opens n slots at position, returns where the raw (not constructed) slots begin
+		iterator _open_gap(iterator position, size_type n, std::true_type);
+		iterator _open_gap(iterator position, size_type n, std::false_type);
+
+		// auxiliary functions for overloads
+		template <typename InputIterator>
+		void _assign(InputIterator first, InputIterator last, std::false_type);
+		void _assign(size_type n, const_reference val, std::true_type);
+
+		template <typename InputIterator>
+		iterator _insert(iterator position, InputIterator first, InputIterator second, std::false_type);
+		iterator _insert(iterator position, size_type n, const_reference val, std::true_type);
+	};
+
+	template <typename T, std::size_t N>
+	bool operator==(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs);
+
+	template <typename T, std::size_t N>
+	bool operator!=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs);
+
+	template <typename T, std::size_t N>
+	bool operator< (const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs);
+
+	template <typename T, std::size_t N>
+	void swap(inplace_vector<T, N>& x, inplace_vector<T, N>& y);
+}
+
+#include "../Implementation/inplace_vector_impl.h"
+
+#endif // INCLUDED_INPLACE_VECTOR_H
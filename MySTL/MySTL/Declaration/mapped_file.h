@@ -0,0 +1,67 @@
+#ifndef INCLUDED_MAPPED_FILE_H
+#define INCLUDED_MAPPED_FILE_H
+
+#include <cstddef>	// size_t
+
+namespace MySTL
+{
+	// A file mapped read-write into memory as a whole, the storage of mmap_vector.
+	// POSIX: open + ftruncate + mmap(MAP_SHARED); resize() grows the file and remaps it, with
+	// mremap where it exists (Linux), munmap + mmap otherwise. Windows: CreateFileMapping +
+	// MapViewOfFile, resize() unmaps, extends the file and maps it again.
+	// The address of the mapping may change on resize(). Errors throw std::runtime_error.
+	class mapped_file
+	{
+	public:
+		typedef std::size_t size_type;
+
+		// access pattern hints, madvise on POSIX
+		enum advice
+		{
+			normal,			// default read-ahead
+			sequential,		// read ahead aggressively, drop pages behind
+			random,			// no read-ahead
+			willneed,		// start reading the whole mapping in now
+			dontneed		// write back and drop the cached pages, the next access reads the disk
+		};
+
+	public:
+		mapped_file();
+		~mapped_file();
+
+		mapped_file(const mapped_file &) = delete;
+		mapped_file& operator=(const mapped_file &) = delete;
+		mapped_file(mapped_file &&f) noexcept;
+		mapped_file& operator=(mapped_file &&f) noexcept;
+
+		// open @path, creating it if needed; @truncate empties an existing file
+		void open(const char *path, bool truncate);
+		void close();
+		bool is_open() const;
+
+		void* data() const { return addr; }
+		size_type size() const { return bytes; }		// file size, all of it is mapped
+
+		void resize(size_type n);						// change the file size to @n bytes and remap
+		void flush(bool async = false);					// write the dirty pages back to the file
+		void advise(advice a);
+
+		void swap(mapped_file &f) noexcept;
+
+	private:
+		void _map();
+		void _unmap();
+
+	private:
+		void *addr;			// start of the mapping, nullptr while the file is empty
+		size_type bytes;	// file size
+#ifdef _WIN32
+		void *file;			// HANDLE of the file
+		void *mapping;		// HANDLE of the file mapping object
+#else
+		int fd;
+#endif
+	};
+}
+
+#endif // INCLUDED_MAPPED_FILE_H
@@ -0,0 +1,124 @@
+#ifndef INCLUDED_MMAP_VECTOR_H
+#define INCLUDED_MMAP_VECTOR_H
+
+// mmap_vector<T>: the interface of vector over a memory-mapped file, for data sets larger than
+// RAM. The kernel pages the elements in and out; the file survives the object:
+//	mmap_vector<double> v("prices.bin");	// opens (or creates) the file
+//	v.push_back(1.5);
+//	v.flush();								// on disk now, and size() with it
+// File layout: a 64-byte header (magic, element size, size) followed by capacity() elements.
+// The size is written to the header by flush(), close() and the destructor.
+// Only for trivially copyable T: the bytes in the file are the objects.
+// Growing may move the mapping, which invalidates pointers like a vector reallocation does.
+#include <cstddef>		// size_t, ptrdiff_t
+#include <cstdint>		// uint64_t
+#include <type_traits>	// is_trivially_copyable
+
+#include "mapped_file.h"
+#include "growth_policy.h"
+
+namespace MySTL
+{
+	template <typename T, typename GrowthPolicy = double_growth>
+	class mmap_vector
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "mmap_vector stores the bytes of T, T must be trivially copyable");
+		static_assert(std::alignment_of<T>::value <= 64, "the elements start 64 bytes into a page aligned mapping");
+
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using iterator               = T*;
+		using const_iterator         = T const *;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using difference_type        = std::ptrdiff_t;
+		using growth_policy          = GrowthPolicy;
+		using advice                 = mapped_file::advice;
+
+		enum open_mode
+		{
+			open_or_create,		// keep the elements of an existing file
+			truncate			// start empty
+		};
+
+	public:
+		mmap_vector() : count(0) {}										// constructor: no file yet
+		explicit mmap_vector(const char *path, open_mode mode = open_or_create);// constructor: open a file
+		mmap_vector(mmap_vector &&v) noexcept;							// constructor: move
+		mmap_vector& operator=(mmap_vector &&v) noexcept;				// assign: move
+		~mmap_vector();													// destructor: writes the size, unmaps
+
+		mmap_vector(const mmap_vector &) = delete;						// one object per file
+		mmap_vector& operator=(const mmap_vector &) = delete;
+
+		// File
+		void open(const char *path, open_mode mode = open_or_create);	// map a file, closing the current one
+		void close();													// write the size back and unmap
+		bool is_open() const { return file.is_open(); }
+		void flush(bool async = false);									// write elements and size to the file
+		void advise(advice a) { file.advise(a); }						// access pattern hint for the whole mapping
+
+		// Element Access
+		reference operator[](size_type n) { return _data()[n]; }		// access element
+		const_reference operator[](size_type n) const { return _data()[n]; }
+		reference at(size_type n);										// access element, range checked
+		reference front() { return _data()[0]; }						// access first element
+		reference back() { return _data()[count - 1]; }					// access last element
+		pointer data() { return _data(); }								// access data
+		const_pointer data() const { return _data(); }
+
+		// Iterators
+		iterator begin() { return _data(); }
+		iterator end() { return _data() + count; }
+		const_iterator begin() const { return _data(); }
+		const_iterator end() const { return _data() + count; }
+
+		// Modifiers
+		void push_back(const_reference val);							// add element at the end
+		template <typename... Args>
+		void emplace_back(Args&&... args);								// construct and insert element at the end
+		void pop_back() { --count; }									// delete last element
+		iterator insert(iterator position, const_reference val);		// insert element, memmove of the tail
+		iterator erase(iterator position);								// erase element
+		iterator erase(iterator first, iterator last);					// erase elements: range
+		void clear() { count = 0; }										// clear content, the file keeps its size
+
+		// Capacity
+		size_type size() const { return count; }						// return size
+		size_type capacity() const;										// return elements the file has room for
+		bool empty() const { return count == 0; }						// test whether empty
+		void resize(size_type n, const_reference val = value_type());	// change size
+		void reserve(size_type n);										// grow the file to hold @n elements
+		void shrink_to_fit();											// cut the file after the last element
+
+	private:
+		// the part of the file in front of the elements
+		struct header
+		{
+			std::uint64_t magic;
+			std::uint64_t element_size;
+			std::uint64_t size;
+			unsigned char padding[40];
+		};
+		static const std::uint64_t header_magic = 0x5254434556504d4dULL;	// "MMPVECTR"
+
+		pointer _data() const
+		{
+			return file.data() ? reinterpret_cast<pointer>(static_cast<unsigned char*>(file.data()) + sizeof(header)) : nullptr;
+		}
+		header* _header() const { return static_cast<header*>(file.data()); }
+		void _resize_file(size_type n);
+		void _write_size();
+
+	private:
+		mapped_file file;
+		size_type count;	// elements in use, the header copy is updated on flush() / close()
+	};
+}
+
+#include "../Implementation/mmap_vector_impl.h"
+
+#endif // INCLUDED_MMAP_VECTOR_H
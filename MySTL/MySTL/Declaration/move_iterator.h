@@ -0,0 +1,75 @@
+#ifndef INCLUDED_MOVE_ITERATOR_H
+#define INCLUDED_MOVE_ITERATOR_H
+
+// move_iterator: dereferencing yields an rvalue reference, so that the range functions
+// (vector::insert, the range constructors, uninitialized_copy ...) move the elements instead
+// of copying them:
+//	v.insert(v.end(), make_move_iterator(w.begin()), make_move_iterator(w.end()));
+#include <type_traits>	// conditional, is_base_of, remove_reference
+#include <utility>		// std::move
+#include "iterator.h"
+
+namespace MySTL
+{
+	template <typename Iterator>
+	class move_iterator
+	{
+	protected:
+		Iterator current;
+
+	public:
+		// the address of an rvalue can't be taken, so never contiguous
+		typedef typename std::conditional<
+			std::is_base_of<contiguous_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value,
+			random_access_iterator_tag,
+			typename iterator_traits<Iterator>::iterator_category>::type iterator_category;
+		typedef typename iterator_traits<Iterator>::value_type value_type;
+		typedef typename iterator_traits<Iterator>::difference_type difference_type;
+		typedef Iterator pointer;
+		typedef typename std::remove_reference<typename iterator_traits<Iterator>::reference>::type&& reference;
+
+		typedef Iterator iterator_type;
+		typedef move_iterator<Iterator> self;
+
+	public:
+		move_iterator() : current() {}
+		explicit move_iterator(iterator_type x) : current(x) {}
+
+		iterator_type base() const { return current; }
+		reference operator*() const { return std::move(*current); }
+		pointer operator->() const { return current; }
+
+		self& operator++() { ++current; return *this; }
+		self operator++(int) { self tmp = *this; ++current; return tmp; }
+		self& operator--() { --current; return *this; }
+		self operator--(int) { self tmp = *this; --current; return tmp; }
+
+		self  operator+ (difference_type n) const { return self(current + n); }
+		self  operator- (difference_type n) const { return self(current - n); }
+		self& operator+=(difference_type n) { current += n; return *this; }
+		self& operator-=(difference_type n) { current -= n; return *this; }
+		reference operator[](difference_type n) const { return std::move(current[n]); }
+	};
+
+	template <typename Iterator>
+	inline bool operator==(const move_iterator<Iterator> &lhs, const move_iterator<Iterator> &rhs) { return lhs.base() == rhs.base(); }
+
+	template <typename Iterator>
+	inline bool operator!=(const move_iterator<Iterator> &lhs, const move_iterator<Iterator> &rhs) { return lhs.base() != rhs.base(); }
+
+	template <typename Iterator>
+	inline bool operator<(const move_iterator<Iterator> &lhs, const move_iterator<Iterator> &rhs) { return lhs.base() < rhs.base(); }
+
+	template <typename Iterator>
+	inline typename move_iterator<Iterator>::difference_type operator-(const move_iterator<Iterator> &lhs, const move_iterator<Iterator> &rhs)
+	{
+		return lhs.base() - rhs.base();
+	}
+
+	template <typename Iterator>
+	inline move_iterator<Iterator> make_move_iterator(Iterator it)
+	{
+		return move_iterator<Iterator>(it);
+	}
+}
+#endif
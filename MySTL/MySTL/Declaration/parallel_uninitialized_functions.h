@@ -0,0 +1,122 @@
+#ifndef INCLUDED_PARALLEL_UNINITIALIZED_FUNCTIONS_H
+#define INCLUDED_PARALLEL_UNINITIALIZED_FUNCTIONS_H
+
+// implementation of the parallel overloads
+// uninitialized_copy(par, ...), uninitialized_fill(par, ...), uninitialized_fill_n(par, ...)
+//
+// The range is split into thread_pool::size() chunks, chunk i is constructed by worker i.
+// Freshly allocated memory is only backed by physical pages when it is first written, so
+// the pages of chunk i end up on the NUMA node of worker i; use parallel_for() on the same
+// pool to process the range with the same partition.
+//
+// Only trivially copyable elements are built on the pool: anything else may allocate through
+// MySTL::allocator (string, vector, ...), whose pool is not thread-safe, and is built in the
+// calling thread. The overloads taking a thread_pool run on that pool instead of instance().
+//
+// Exception safety: every chunk rolls back its own partial work (see uninitialized_functions.h),
+// if any chunk throws, the chunks that completed are destroyed and the first exception is
+// rethrown. The whole range is left uninitialized, as with the sequential versions.
+#include <cstddef>                      // size_t
+#include <memory>                       // unique_ptr
+#include <type_traits>                  // is_trivially_copyable
+#include "thread_pool.h"                // class:       thread_pool
+#include "uninitialized_functions.h"    // function:    uninitialized_copy, uninitialized_fill, uninitialized_fill_n
+#include "construct.h"                  // function:    destory
+#include "iterator.h"                   // struct:      iterator_traits
+
+
+namespace MySTL
+{
+    // ranges smaller than this (in bytes) are not worth waking the pool for
+    enum { PARALLEL_THRESHOLD = 1024 * 1024 };
+
+    // @Source is what the elements are built from, the same as the destination for a fill
+    template <typename ForwardIterator, typename Source = ForwardIterator>
+    inline bool _run_in_parallel(const thread_pool &pool, std::size_t n)
+    {
+        typedef typename iterator_traits<ForwardIterator>::value_type T;
+        typedef typename iterator_traits<Source>::value_type S;
+        return std::is_trivially_copyable<T>::value && std::is_trivially_copyable<S>::value
+            && pool.size() > 1 && n * sizeof(T) >= static_cast<std::size_t>(PARALLEL_THRESHOLD);
+    }
+
+    // construct [result, result + n) chunk by chunk on @pool.
+    // construct_chunk(b, e) constructs [result + b, result + e) or throws having constructed nothing.
+    template <typename RandomAccessIterator, typename Function>
+    inline void _parallel_construct(thread_pool &pool, RandomAccessIterator result, std::size_t n, Function construct_chunk)
+    {
+        const std::size_t chunks = pool.size();
+        std::unique_ptr<bool[]> done(new bool[chunks]());    // chunk i is fully constructed
+        try
+        {
+            pool.run(chunks, [&](std::size_t i)
+            {
+                construct_chunk(_chunk_begin(n, i, chunks), _chunk_begin(n, i + 1, chunks));
+                done[i] = true;
+            });
+        }
+        catch (...)
+        {
+            for (std::size_t i = 0; i != chunks; ++i)
+            {
+                if (done[i])
+                    destory(result + _chunk_begin(n, i, chunks), result + _chunk_begin(n, i + 1, chunks));
+            }
+            throw;
+        }
+    }
+
+
+    //////////////////////////////////////////////
+    template <typename RandomAccessIterator, typename ForwardIterator>
+    inline ForwardIterator uninitialized_copy(const parallel_policy &, thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, ForwardIterator result)
+    {
+        const std::size_t n = static_cast<std::size_t>(last - first);
+        if (!_run_in_parallel<ForwardIterator, RandomAccessIterator>(pool, n))
+            return MySTL::uninitialized_copy(first, last, result);
+
+        _parallel_construct(pool, result, n, [&](std::size_t b, std::size_t e)
+        {
+            MySTL::uninitialized_copy(first + b, first + e, result + b);
+        });
+        return result + n;
+    }
+
+    template <typename RandomAccessIterator, typename ForwardIterator>
+    inline ForwardIterator uninitialized_copy(const parallel_policy &policy, RandomAccessIterator first, RandomAccessIterator last, ForwardIterator result)
+    {
+        return MySTL::uninitialized_copy(policy, thread_pool::instance(), first, last, result);
+    }
+
+
+    //////////////////////////////////////////////
+    template <typename ForwardIterator, typename Size, typename T>
+    inline ForwardIterator uninitialized_fill_n(const parallel_policy &, thread_pool &pool, ForwardIterator first, Size n, const T &x)
+    {
+        const std::size_t len = static_cast<std::size_t>(n);
+        if (!_run_in_parallel<ForwardIterator>(pool, len))
+            return MySTL::uninitialized_fill_n(first, n, x);
+
+        _parallel_construct(pool, first, len, [&](std::size_t b, std::size_t e)
+        {
+            MySTL::uninitialized_fill_n(first + b, e - b, x);
+        });
+        return first + len;
+    }
+
+    template <typename ForwardIterator, typename Size, typename T>
+    inline ForwardIterator uninitialized_fill_n(const parallel_policy &policy, ForwardIterator first, Size n, const T &x)
+    {
+        return MySTL::uninitialized_fill_n(policy, thread_pool::instance(), first, n, x);
+    }
+
+
+    //////////////////////////////////////////////
+    template <typename ForwardIterator, typename T>
+    inline void uninitialized_fill(const parallel_policy &policy, ForwardIterator first, ForwardIterator last, const T &x)
+    {
+        MySTL::uninitialized_fill_n(policy, first, last - first, x);
+    }
+}
+
+#endif
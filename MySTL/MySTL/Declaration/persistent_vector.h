@@ -0,0 +1,273 @@
+#ifndef INCLUDED_PERSISTENT_VECTOR_H
+#define INCLUDED_PERSISTENT_VECTOR_H
+
+// persistent_vector<T>: an immutable vector whose versions share structure, for undo histories and
+// versioned state. The elements sit in a 32-way radix trie of leaves plus a tail leaf:
+//	push_back	writes the tail, every 32nd push moves the full tail into the trie
+//	set			copies the path from the root to one leaf, O(log32 n) nodes
+//	concat		merges the right spine of one trie with the left spine of the other and rebalances
+//				the nodes along the seam (RRB tree), O(log32 n) nodes
+// A new version shares every other node with the old one. After a concat a node may hold less
+// than full children, it then keeps a table of its children's sizes and lookup scans it from the
+// radix guess; nodes built by push_back alone stay radix only.
+// transient() gives a transient_vector that changes nodes in place while it is their only owner:
+// a batch of edits copies each shared node once instead of once per edit. persistent() hands the
+// result back as a persistent_vector.
+// Nodes are reference counted, not atomically, and come from Alloc: versions that share nodes
+// belong to one thread, as the pool allocator behind allocator<T> does.
+#include <initializer_list>
+#include <cstddef>		// size_t, ptrdiff_t
+#include <type_traits>	// true_type, false_type
+
+#include "allocator.h"
+#include "iterator.h"
+
+namespace MySTL
+{
+	template <typename T, typename Alloc>
+	class persistent_vector;
+	template <typename T, typename Alloc>
+	class transient_vector;
+
+
+	// the trie behind persistent_vector and transient_vector. Every operation changes the tree in
+	// place, copying first the nodes it shares with other trees: a persistent version is a copy of
+	// the tree changed in place
+	template <typename T, typename Alloc>
+	struct _pvec_tree
+	{
+		typedef std::size_t size_type;
+		typedef Alloc data_allocator;
+
+		// the head of a node; a leaf's elements or an inner node's children follow it
+		struct _node
+		{
+			size_type refs;
+			size_type *sizes;	// relaxed inner node: elements in children [0, i], else nullptr
+			size_type count;	// children, or elements of a leaf
+		};
+
+		static const unsigned bits = 5;
+		static const size_type width = size_type(1) << bits;
+		static const size_type extras = 2;		// concat leaves at most this many nodes above the optimum on a level
+		static const size_type header_slots = (sizeof(_node) + sizeof(T) - 1) / sizeof(T);
+		static const size_type leaf_slots = header_slots + width;
+		static const size_type inner_slots = (sizeof(_node) + width * sizeof(_node*) + sizeof(T) - 1) / sizeof(T);
+		static const size_type table_slots = (width * sizeof(size_type) + sizeof(T) - 1) / sizeof(T);
+
+		_pvec_tree() : root(nullptr), tail(nullptr), count(0), shift(bits) {}
+		_pvec_tree(const _pvec_tree &x);				// shares every node
+		_pvec_tree(_pvec_tree &&x) noexcept;
+		_pvec_tree& operator=(const _pvec_tree &x);
+		_pvec_tree& operator=(_pvec_tree &&x) noexcept;
+		~_pvec_tree() { clear(); }
+
+		const T& operator[](size_type i) const;
+		_node* _leaf_for(size_type i, size_type &first) const;	// leaf of element i, first is the index of its first element
+		size_type tail_offset() const { return count - tail->count; }
+
+		template <typename V>
+		void push_back(V &&val);
+		template <typename V>
+		void set(size_type i, V &&val);
+		void append(const _pvec_tree &x);				// concat x to the end
+		void clear();
+		void swap(_pvec_tree &x);
+
+		static T* _elements(_node *n) { return reinterpret_cast<T*>(n) + header_slots; }
+		static _node** _children(_node *n) { return reinterpret_cast<_node**>(n + 1); }
+		static _node* _allocate(size_type slots);		// refs 1, empty
+		static void _deallocate(_node *n, unsigned s);	// s: 0 for a leaf
+		static void _retain(_node *n) { ++n->refs; }
+		static void _release(_node *n, unsigned s);		// drop one reference, free the node and its subtree on the last
+		static void _release_all(_node **first, size_type k, unsigned s);
+		static _node* _clone(_node *n, unsigned s);	// copy with refs 1, sharing the children
+		static _node* _unique(_node *n, unsigned s);	// n when only the caller owns it, else its clone
+		static size_type _child_index(const _node *n, unsigned s, size_type &i);	// child holding i, made relative to it
+
+		static size_type _size_of(_node *n, unsigned s);
+		static bool _has_room(_node *n, unsigned s);	// can take one more leaf
+		static _node* _new_path(_node *leaf, unsigned s);	// leaf under single child nodes up to shift s
+		static void _relax(_node *n, unsigned s);		// size table when the children are not full but the last
+		static void _append_child(_node *n, unsigned s, _node *c);
+		static _node* _make_inner(_node **first, size_type k, unsigned s);
+		static void _push_tail(_node *&n, unsigned s, _node *leaf);
+		void _push_leaf(_node *leaf);
+		static size_type _merge(_node *l, _node *r, unsigned s, _node **out);
+		static size_type _rebalance(_node **all, size_type k, unsigned s);
+
+		_node *root;		// inner node at shift, nullptr while every element is in the tail
+		_node *tail;		// the last 1..32 elements, nullptr when empty
+		size_type count;
+		unsigned shift;		// root picks child i >> shift, leaves are at shift 0
+	};
+
+
+	template <typename T, typename Alloc>
+	class _pvec_iterator
+	{
+	public:
+		typedef random_access_iterator_tag iterator_category;
+		typedef T value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const T* pointer;
+		typedef const T& reference;
+		typedef std::size_t size_type;
+		typedef _pvec_iterator self;
+		typedef _pvec_tree<T, Alloc> tree_type;
+
+	public:
+		_pvec_iterator() : tree(nullptr), index(0), cur(nullptr), leaf_end(nullptr) {}
+		_pvec_iterator(const tree_type *tree, size_type index) : tree(tree), index(index) { _reseat(); }
+
+		reference operator*() const { return *cur; }
+		pointer operator->() const { return cur; }
+		reference operator[](difference_type n) const { return *(*this + n); }
+
+		self& operator++() { ++index; if (++cur == leaf_end) _reseat(); return *this; }
+		self operator++(int) { self tmp = *this; ++*this; return tmp; }
+		self& operator--() { --index; _reseat(); return *this; }
+		self operator--(int) { self tmp = *this; --*this; return tmp; }
+		self& operator+=(difference_type n) { index += n; _reseat(); return *this; }
+		self& operator-=(difference_type n) { index -= n; _reseat(); return *this; }
+		self operator+(difference_type n) const { self tmp = *this; return tmp += n; }
+		self operator-(difference_type n) const { self tmp = *this; return tmp -= n; }
+		difference_type operator-(const self &it) const { return static_cast<difference_type>(index) - static_cast<difference_type>(it.index); }
+
+		bool operator==(const self &it) const { return index == it.index; }
+		bool operator!=(const self &it) const { return index != it.index; }
+		bool operator< (const self &it) const { return index < it.index; }
+		bool operator> (const self &it) const { return index > it.index; }
+		bool operator<=(const self &it) const { return index <= it.index; }
+		bool operator>=(const self &it) const { return index >= it.index; }
+
+	private:
+		// point cur at element index, within the leaf that holds it
+		void _reseat()
+		{
+			if (index < tree->count)
+			{
+				size_type first;
+				typename tree_type::_node *leaf = tree->_leaf_for(index, first);
+				cur = tree_type::_elements(leaf) + (index - first);
+				leaf_end = tree_type::_elements(leaf) + leaf->count;
+			}
+			else
+				cur = leaf_end = nullptr;
+		}
+
+	private:
+		const tree_type *tree;
+		size_type index;	// position in the sequence
+		const T *cur;		// the element
+		const T *leaf_end;	// end of the leaf cur is in
+	};
+
+
+	template <typename T, typename Alloc = allocator<T> >
+	class persistent_vector
+	{
+		friend class transient_vector<T, Alloc>;
+
+	public:
+		using value_type             = T;
+		using reference              = T const &;
+		using const_reference        = T const &;
+		using iterator               = _pvec_iterator<T, Alloc>;
+		using const_iterator         = _pvec_iterator<T, Alloc>;
+		using difference_type        = std::ptrdiff_t;
+		using size_type              = std::size_t;
+		using allocator_type         = Alloc;
+		using transient_type         = transient_vector<T, Alloc>;
+
+	public:
+		persistent_vector() {}											// constructor: default
+		persistent_vector(size_type n, const_reference val);			// constructor: fill
+		template <typename InputIterator>
+		persistent_vector(InputIterator first, InputIterator last);		// constructor: range
+		persistent_vector(std::initializer_list<value_type> il);		// constructor: initializer_list
+		// copy, move and assignment share every node, O(1)
+
+		// Element Access
+		const_reference operator[](size_type n) const { return tree[n]; }	// access element
+		const_reference at(size_type n) const;							// access element, throws out_of_range
+		const_reference front() const { return tree[0]; }				// access first element
+		const_reference back() const { return tree._elements(tree.tail)[tree.tail->count - 1]; }	// access last element
+
+		// Iterators
+		const_iterator begin() const { return const_iterator(&tree, 0); }
+		const_iterator end() const { return const_iterator(&tree, size()); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		// Capacity
+		size_type size() const { return tree.count; }					// return size
+		bool empty() const { return tree.count == 0; }					// test whether vector is empty
+
+		// Versions: each returns a new vector and leaves this one as it is
+		persistent_vector push_back(const_reference val) const;			// add element at the end
+		persistent_vector set(size_type n, const_reference val) const;	// replace element n
+		persistent_vector concat(const persistent_vector &x) const;		// this followed by x
+		transient_type transient() const { return transient_type(*this); }// batch of edits in place
+		void swap(persistent_vector &x) { tree.swap(x.tree); }			// swap content
+
+	protected:
+		template <typename Integer>
+		void _range_initialize(Integer n, Integer val, std::true_type);	// (n, val) that matched the range constructor
+		template <typename InputIterator>
+		void _range_initialize(InputIterator first, InputIterator last, std::false_type);
+
+	protected:
+		_pvec_tree<T, Alloc> tree;
+	};
+
+
+	// a persistent_vector under edit: the same operations, in place. Nodes it shares with the
+	// persistent_vector it came from (or any other) are copied the first time they are written,
+	// its own nodes are written directly. persistent() ends the edit and leaves it empty
+	template <typename T, typename Alloc = allocator<T> >
+	class transient_vector
+	{
+	public:
+		using value_type             = T;
+		using const_reference        = T const &;
+		using size_type              = std::size_t;
+		using persistent_type        = persistent_vector<T, Alloc>;
+
+	public:
+		transient_vector() {}											// constructor: default
+		explicit transient_vector(const persistent_type &v) : tree(v.tree) {}	// constructor: edit of a version
+		transient_vector(transient_vector &&x) noexcept : tree(std::move(x.tree)) {}	// constructor: move
+		transient_vector& operator=(transient_vector &&x) noexcept { tree = std::move(x.tree); return *this; }
+		transient_vector(const transient_vector &) = delete;
+		transient_vector& operator=(const transient_vector &) = delete;
+
+		// Element Access
+		const_reference operator[](size_type n) const { return tree[n]; }	// access element
+
+		// Capacity
+		size_type size() const { return tree.count; }					// return size
+		bool empty() const { return tree.count == 0; }					// test whether vector is empty
+
+		// Modifiers
+		void push_back(const_reference val) { tree.push_back(val); }	// add element at the end
+		void push_back(value_type &&val) { tree.push_back(std::move(val)); }
+		void set(size_type n, const_reference val) { tree.set(n, val); }// replace element n
+		void append(const persistent_type &x) { tree.append(x.tree); }	// concat x to the end
+		persistent_type persistent();									// end the edit, return the result
+
+	protected:
+		_pvec_tree<T, Alloc> tree;
+	};
+
+	template <typename T, typename Alloc>
+	bool operator==(const persistent_vector<T, Alloc>& lhs, const persistent_vector<T, Alloc>& rhs);
+	template <typename T, typename Alloc>
+	bool operator!=(const persistent_vector<T, Alloc>& lhs, const persistent_vector<T, Alloc>& rhs) { return !(lhs == rhs); }
+	template <typename T, typename Alloc>
+	void swap(persistent_vector<T, Alloc>& x, persistent_vector<T, Alloc>& y) { x.swap(y); }
+}
+
+#include "../Implementation/persistent_vector_impl.h"
+
+#endif // INCLUDED_PERSISTENT_VECTOR_H
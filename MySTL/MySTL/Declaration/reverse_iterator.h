@@ -1,6 +1,7 @@
 #ifndef INCLUDED_REVERSE_ITERATOR_H
 #define INCLUDED_REVERSE_ITERATOR_H
 
+#include <type_traits>	// conditional, is_base_of
 #include "type_traits.h"
 #include "iterator.h"
 
@@ -13,7 +14,11 @@ namespace MySTL
 		Iterator current;
 
 	public:
-		typedef typename iterator_traits<Iterator>::iterator_category iterator_category;
+		// walking backwards is random access at best, never contiguous
+		typedef typename std::conditional<
+			std::is_base_of<contiguous_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value,
+			random_access_iterator_tag,
+			typename iterator_traits<Iterator>::iterator_category>::type iterator_category;
 		typedef typename iterator_traits<Iterator>::value_type value_type;
 		typedef typename iterator_traits<Iterator>::difference_type difference_type;
 		typedef typename iterator_traits<Iterator>::pointer pointer;
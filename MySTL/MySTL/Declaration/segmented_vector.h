@@ -0,0 +1,175 @@
+#ifndef INCLUDED_SEGMENTED_VECTOR_H
+#define INCLUDED_SEGMENTED_VECTOR_H
+
+// segmented_vector<T, FirstSegment>: a sequence that grows by adding segments instead of
+// reallocating. Segment k holds FirstSegment << k elements, so
+//	segment of element i = floor(log2(i / FirstSegment + 1))
+// and random access is a bit scan plus two loads. Elements never move: pointers and references
+// stay valid until the element is popped, and growing needs no more than the new segment.
+// The segment table is a fixed array inside the object, it never reallocates either.
+#include <cstddef>		// size_t, ptrdiff_t
+#include <type_traits>	// conditional
+
+#include "allocator.h"
+#include "iterator.h"
+#include "simd_kernels.h"	// _floor_log2
+
+namespace MySTL
+{
+	// Ref / Ptr select the iterator (T&, T*) or the const_iterator (const T&, const T*).
+	// Slot is the entry type of the segment table: T*, or std::atomic<T*> for concurrent_vector
+	template <typename T, typename Ref, typename Ptr, std::size_t FirstSegment, typename Slot = T*>
+	class _segmented_iterator
+	{
+	public:
+		typedef random_access_iterator_tag iterator_category;
+		typedef T value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Ptr pointer;
+		typedef Ref reference;
+		typedef std::size_t size_type;
+		typedef _segmented_iterator self;
+
+	public:
+		_segmented_iterator() : table(nullptr), index(0), cur(nullptr), seg_end(nullptr) {}
+		_segmented_iterator(const Slot *table, size_type index) : table(table), index(index) { _reseat(); }
+		// iterator -> const_iterator
+		template <typename R, typename P>
+		_segmented_iterator(const _segmented_iterator<T, R, P, FirstSegment, Slot> &it) : table(it.table), index(it.index), cur(it.cur), seg_end(it.seg_end) {}
+
+		reference operator*() const { return *cur; }
+		pointer operator->() const { return cur; }
+		reference operator[](difference_type n) const { return *(*this + n); }
+
+		self& operator++() { ++index; if (++cur == seg_end) _reseat(); return *this; }
+		self operator++(int) { self tmp = *this; ++*this; return tmp; }
+		self& operator--() { --index; _reseat(); return *this; }
+		self operator--(int) { self tmp = *this; --*this; return tmp; }
+		self& operator+=(difference_type n) { index += n; _reseat(); return *this; }
+		self& operator-=(difference_type n) { index -= n; _reseat(); return *this; }
+		self operator+(difference_type n) const { self tmp = *this; return tmp += n; }
+		self operator-(difference_type n) const { self tmp = *this; return tmp -= n; }
+		difference_type operator-(const self &it) const { return static_cast<difference_type>(index) - static_cast<difference_type>(it.index); }
+
+		bool operator==(const self &it) const { return index == it.index; }
+		bool operator!=(const self &it) const { return index != it.index; }
+		bool operator< (const self &it) const { return index < it.index; }
+		bool operator> (const self &it) const { return index > it.index; }
+		bool operator<=(const self &it) const { return index <= it.index; }
+		bool operator>=(const self &it) const { return index >= it.index; }
+
+	private:
+		template <typename, typename, typename, std::size_t, typename> friend class _segmented_iterator;
+
+		// point cur at element index, the segment past the last one may not be allocated yet
+		void _reseat()
+		{
+			const size_type k = _floor_log2(index / FirstSegment + 1);
+			T *base = table[k];
+			if (base)
+			{
+				cur = base + (index - FirstSegment * ((size_type(1) << k) - 1));
+				seg_end = base + (FirstSegment << k);
+			}
+			else
+				cur = seg_end = nullptr;
+		}
+
+	private:
+		const Slot *table;	// segment table of the container
+		size_type index;	// position in the sequence
+		T *cur;				// the element
+		T *seg_end;			// end of the segment cur is in
+	};
+
+
+	template <typename T, std::size_t FirstSegment = 16, typename Alloc = allocator<T> >
+	class segmented_vector
+	{
+		static_assert(FirstSegment > 0 && (FirstSegment & (FirstSegment - 1)) == 0, "FirstSegment must be a power of two");
+
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using difference_type        = std::ptrdiff_t;
+		using iterator               = _segmented_iterator<T, T&, T*, FirstSegment>;
+		using const_iterator         = _segmented_iterator<T, const T&, const T*, FirstSegment>;
+		using allocator_type         = Alloc;
+
+		static const size_type first_segment = FirstSegment;
+		static const size_type max_segments  = sizeof(size_type) * 8;
+
+	protected:
+		using data_allocator         = Alloc;
+
+	public:
+		segmented_vector() : count(0), segments(0) { _clear_table(); }	// constructor: default
+		segmented_vector(const segmented_vector &v);					// constructor: copy
+		segmented_vector(segmented_vector &&v) noexcept;				// constructor: move
+		segmented_vector& operator=(const segmented_vector &rhs);		// assign content: copy
+		segmented_vector& operator=(segmented_vector &&rhs) noexcept;	// assign content: move
+		~segmented_vector();											// destructor
+
+		// Element Access
+		reference operator[](size_type n) { return *_address(n); }		// access element
+		const_reference operator[](size_type n) const { return *_address(n); }
+		reference at(size_type n);										// access element, range checked
+		reference front() { return *table[0]; }							// access first element
+		reference back() { return *_address(count - 1); }				// access last element
+
+		// Iterators
+		iterator begin() { return iterator(table, 0); }
+		iterator end() { return iterator(table, count); }
+		const_iterator begin() const { return const_iterator(table, 0); }
+		const_iterator end() const { return const_iterator(table, count); }
+
+		// Modifiers
+		void push_back(const_reference val);							// add element at the end
+		void push_back(value_type &&val);								// add element at the end: move
+		template <typename... Args>
+		reference emplace_back(Args&&... args);							// construct element at the end
+		void pop_back();												// delete last element
+		void clear();													// destroy the elements, keep the segments
+		void swap(segmented_vector &v) noexcept;						// swap content
+
+		// Capacity
+		size_type size() const { return count; }						// return size
+		size_type capacity() const { return _segment_start(segments); }// return elements the allocated segments hold
+		size_type segment_count() const { return segments; }			// return number of allocated segments
+		bool empty() const { return count == 0; }						// test whether empty
+		void reserve(size_type n);										// allocate segments up to @n elements
+		void shrink_to_fit();											// release the segments past the last element
+
+	private:
+		// element i lives in segment _segment_of(i), at offset i - _segment_start(k)
+		static size_type _segment_of(size_type i) { return _floor_log2(i / FirstSegment + 1); }
+		static size_type _segment_start(size_type k) { return FirstSegment * ((size_type(1) << k) - 1); }
+		static size_type _segment_size(size_type k) { return FirstSegment << k; }
+
+		pointer _address(size_type i) const
+		{
+			const size_type k = _segment_of(i);
+			return table[k] + (i - _segment_start(k));
+		}
+		pointer _slot_for_back();	// address for element count, adds a segment when full
+		void _add_segment();
+		void _clear_table();
+		void _free();
+
+	private:
+		size_type count;				// elements in use
+		size_type segments;				// segments allocated, table[segments..] are null
+		pointer table[max_segments];	// segment k has _segment_size(k) elements
+	};
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void swap(segmented_vector<T, FirstSegment, Alloc>& x, segmented_vector<T, FirstSegment, Alloc>& y) noexcept;
+}
+
+#include "../Implementation/segmented_vector_impl.h"
+
+#endif // INCLUDED_SEGMENTED_VECTOR_H
@@ -0,0 +1,334 @@
+#ifndef INCLUDED_SIMD_KERNELS_H
+#define INCLUDED_SIMD_KERNELS_H
+
+// byte level kernels the algorithms lower to for contiguous ranges of trivial objects
+//  _mismatch_bytes     index of the first differing byte of two buffers
+//  _find_byte          memchr
+//  _find_u32           first 32-bit word equal to a value
+// and the bit scans _count_trailing_zeros / _floor_log2 / _popcount64.
+// Word level kernels of the packed vector<bool>:
+//  _bitwise_words      dst[i] = op(dst[i], src[i]), two words per SSE2 register
+//  _popcount_words     set bits of a word array
+// Decoding kernels of compressed_int_vector:
+//  _unpack_lanes_u32   128 values of @width bits, packed in 4 interleaved 32-bit lanes, optionally delta-summed
+//  _prefix_sum_u32     running sum, in place
+// Group kernels of the swiss table control bytes, one bit per byte of a 16 byte group:
+//  _match_bytes16      bytes equal to a value
+//  _less_bytes16       bytes less than a value, signed
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <cstring>      // memchr
+
+#include "type_traits.h"    // _index_sequence
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define MYSTL_HAS_SSE2
+#include <emmintrin.h>  // SSE2
+#include <xmmintrin.h>  // _mm_prefetch
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>     // _BitScanForward, _BitScanReverse, __popcnt
+#endif
+
+namespace MySTL
+{
+	// index of the lowest set bit, @x must not be 0
+	inline unsigned _count_trailing_zeros(unsigned x)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, x);
+		return static_cast<unsigned>(index);
+#else
+		return static_cast<unsigned>(__builtin_ctz(x));
+#endif
+	}
+
+
+	// index of the lowest set bit, @x must not be 0
+	inline unsigned _count_trailing_zeros64(std::uint64_t x)
+	{
+#if defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanForward64(&index, x);
+		return static_cast<unsigned>(index);
+#elif defined(_MSC_VER)
+		const unsigned low = static_cast<unsigned>(x);
+		return low ? _count_trailing_zeros(low) : 32 + _count_trailing_zeros(static_cast<unsigned>(x >> 32));
+#else
+		return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+	}
+
+
+	// number of set bits, the popcnt instruction where the target has it
+	inline unsigned _popcount64(std::uint64_t x)
+	{
+#if defined(_MSC_VER) && defined(_WIN64)
+		return static_cast<unsigned>(__popcnt64(x));
+#elif defined(_MSC_VER)
+		return __popcnt(static_cast<unsigned>(x)) + __popcnt(static_cast<unsigned>(x >> 32));
+#else
+		return static_cast<unsigned>(__builtin_popcountll(x));
+#endif
+	}
+
+
+	// index of the highest set bit, @x must not be 0
+	inline unsigned _floor_log2(std::size_t x)
+	{
+#if defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanReverse64(&index, x);
+		return static_cast<unsigned>(index);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, x);
+		return static_cast<unsigned>(index);
+#else
+		return static_cast<unsigned>(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(x));
+#endif
+	}
+
+
+	inline std::size_t _mismatch_bytes(const void *a, const void *b, std::size_t n)
+	{
+		const unsigned char *p = static_cast<const unsigned char*>(a);
+		const unsigned char *q = static_cast<const unsigned char*>(b);
+		std::size_t i = 0;
+#ifdef MYSTL_HAS_SSE2
+		for (; i + 16 <= n; i += 16)
+		{
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q + i));
+			unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+			if (mask != 0xFFFF)
+				return i + _count_trailing_zeros(~mask & 0xFFFF);
+		}
+#endif
+		for (; i != n && p[i] == q[i]; ++i);
+		return i;
+	}
+
+
+	inline std::size_t _find_byte(const void *p, std::size_t n, unsigned char value)
+	{
+		const void *r = std::memchr(p, value, n);
+		return r ? static_cast<std::size_t>(static_cast<const unsigned char*>(r) - static_cast<const unsigned char*>(p)) : n;
+	}
+
+
+	inline std::size_t _find_u32(const std::uint32_t *p, std::size_t n, std::uint32_t value)
+	{
+		std::size_t i = 0;
+#ifdef MYSTL_HAS_SSE2
+		const __m128i v = _mm_set1_epi32(static_cast<int>(value));
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(x, v)));
+			if (mask != 0)
+				return i + _count_trailing_zeros(mask) / 4;
+		}
+#endif
+		for (; i != n && p[i] != value; ++i);
+		return i;
+	}
+
+
+	// operations of _bitwise_words, on one word and on a register of two
+	struct _and_words
+	{
+		std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const { return a & b; }
+#ifdef MYSTL_HAS_SSE2
+		__m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); }
+#endif
+	};
+
+	struct _or_words
+	{
+		std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const { return a | b; }
+#ifdef MYSTL_HAS_SSE2
+		__m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); }
+#endif
+	};
+
+	struct _xor_words
+	{
+		std::uint64_t operator()(std::uint64_t a, std::uint64_t b) const { return a ^ b; }
+#ifdef MYSTL_HAS_SSE2
+		__m128i operator()(__m128i a, __m128i b) const { return _mm_xor_si128(a, b); }
+#endif
+	};
+
+
+	template <typename Operation>
+	inline void _bitwise_words(std::uint64_t *dst, const std::uint64_t *src, std::size_t n, Operation op)
+	{
+		std::size_t i = 0;
+#ifdef MYSTL_HAS_SSE2
+		for (; i + 2 <= n; i += 2)
+		{
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+			__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), op(x, y));
+		}
+#endif
+		for (; i != n; ++i)
+			dst[i] = op(dst[i], src[i]);
+	}
+
+
+	inline std::size_t _popcount_words(const std::uint64_t *p, std::size_t n)
+	{
+		// four independent sums, so the popcnts don't wait on one another
+		std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0, i = 0;
+		for (; i + 4 <= n; i += 4)
+		{
+			c0 += _popcount64(p[i]);
+			c1 += _popcount64(p[i + 1]);
+			c2 += _popcount64(p[i + 2]);
+			c3 += _popcount64(p[i + 3]);
+		}
+		for (; i != n; ++i)
+			c0 += _popcount64(p[i]);
+		return c0 + c1 + c2 + c3;
+	}
+
+
+	// Value i of the block is lane i % 4, slot i / 4; lane l is a stream of 32 @width-bit slots in
+	// the words in[l], in[l + 4], in[l + 8] ..., so one SSE2 register decodes four values at a time
+	// with a shift that is the same in every lane. @in holds 4 * @width words, 0 <= @width <= 32.
+	// Every width has its own fully unrolled kernel (_unpack_slots<Width, 0, Delta>), so the shifts
+	// are immediates and the slots that straddle two words are known at compile time.
+	// Delta: the slots are gaps, out[i] = base + slot[0] + ... + slot[i], summed while unpacking.
+#ifdef MYSTL_HAS_SSE2
+	template <unsigned Width, unsigned Slot, bool Delta>
+	struct _unpack_slots
+	{
+		static const unsigned bit = Slot * Width, word = bit / 32, shift = bit % 32;
+
+		static void run(const std::uint32_t *in, std::uint32_t *out, __m128i mask, __m128i carry)
+		{
+			// width 0: all zeros, and no words to read
+			__m128i v = Width ? _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * word)), shift) : _mm_setzero_si128();
+			if (shift + Width > 32)	// the slot continues in the next word of the lane
+				v = _mm_or_si128(v, _mm_slli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * word + 4)), 32 - shift));
+			v = _mm_and_si128(v, mask);
+			if (Delta)
+			{
+				v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+				v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+				v = _mm_add_epi32(v, carry);
+				carry = _mm_shuffle_epi32(v, 0xFF);	// the last sum, in every lane
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * Slot), v);
+			_unpack_slots<Width, Slot + 1, Delta>::run(in, out, mask, carry);
+		}
+	};
+
+	template <unsigned Width, bool Delta>
+	struct _unpack_slots<Width, 32, Delta>
+	{
+		static void run(const std::uint32_t *, std::uint32_t *, __m128i, __m128i) {}
+	};
+
+	template <unsigned Width, bool Delta>
+	inline void _unpack_lanes_fixed(const std::uint32_t *in, std::uint32_t *out, std::uint32_t base)
+	{
+		const std::uint32_t mask = Width == 32 ? ~std::uint32_t(0) : (std::uint32_t(1) << (Width % 32)) - 1;
+		_unpack_slots<Width, 0, Delta>::run(in, out, _mm_set1_epi32(static_cast<int>(mask)), _mm_set1_epi32(static_cast<int>(base)));
+	}
+
+	template <bool Delta, std::size_t... Widths>
+	inline void _unpack_lanes_dispatch(const std::uint32_t *in, unsigned width, std::uint32_t *out, std::uint32_t base,
+		_index_sequence<Widths...>)
+	{
+		typedef void (*kernel)(const std::uint32_t *, std::uint32_t *, std::uint32_t);
+		static const kernel kernels[] = { &_unpack_lanes_fixed<static_cast<unsigned>(Widths), Delta>... };
+		kernels[width](in, out, base);
+	}
+#endif
+
+	template <bool Delta>
+	inline void _unpack_lanes_u32(const std::uint32_t *in, unsigned width, std::uint32_t *out, std::uint32_t base)
+	{
+#ifdef MYSTL_HAS_SSE2
+		_unpack_lanes_dispatch<Delta>(in, width, out, base, _make_index_sequence<33>());
+#else
+		const std::uint32_t mask = width == 32 ? ~std::uint32_t(0) : (std::uint32_t(1) << width) - 1;
+		for (unsigned j = 0, bit = 0; j != 32; ++j, bit += width)
+		{
+			const unsigned w = bit / 32, shift = bit % 32;
+			for (unsigned l = 0; l != 4; ++l)
+			{
+				std::uint32_t v = width ? in[4 * w + l] >> shift : 0;
+				if (shift + width > 32)
+					v |= in[4 * w + 4 + l] << (32 - shift);
+				out[4 * j + l] = Delta ? base += v & mask : v & mask;
+			}
+		}
+#endif
+	}
+
+	// the slots as they are
+	inline void _unpack_lanes_u32(const std::uint32_t *in, unsigned width, std::uint32_t *out)
+	{
+		_unpack_lanes_u32<false>(in, width, out, 0);
+	}
+
+
+	// p[i] = base + p[0] + ... + p[i], modulo 2^32
+	inline void _prefix_sum_u32(std::uint32_t *p, std::size_t n, std::uint32_t base)
+	{
+		std::size_t i = 0;
+#ifdef MYSTL_HAS_SSE2
+		__m128i carry = _mm_set1_epi32(static_cast<int>(base));
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+			x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+			x = _mm_add_epi32(x, carry);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), x);
+			carry = _mm_shuffle_epi32(x, 0xFF);	// the last sum, in every lane
+		}
+		base = static_cast<std::uint32_t>(_mm_cvtsi128_si32(carry));
+#endif
+		for (std::uint32_t *q = p + i, *e = p + n; q != e; ++q)
+			*q = base += *q;
+	}
+
+
+	// bit i set when p[i] == value, for the 16 bytes at @p (unaligned)
+	inline unsigned _match_bytes16(const signed char *p, signed char value)
+	{
+#ifdef MYSTL_HAS_SSE2
+		const __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(value))));
+#else
+		unsigned mask = 0;
+		for (unsigned i = 0; i != 16; ++i)
+			mask |= static_cast<unsigned>(p[i] == value) << i;
+		return mask;
+#endif
+	}
+
+
+	// bit i set when p[i] < value, for the 16 bytes at @p (unaligned)
+	inline unsigned _less_bytes16(const signed char *p, signed char value)
+	{
+#ifdef MYSTL_HAS_SSE2
+		const __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(g, _mm_set1_epi8(value))));
+#else
+		unsigned mask = 0;
+		for (unsigned i = 0; i != 16; ++i)
+			mask |= static_cast<unsigned>(p[i] < value) << i;
+		return mask;
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef INCLUDED_SMALL_VECTOR_H
+#define INCLUDED_SMALL_VECTOR_H
+
+// small_vector<T, N>: the interface of vector, but the first N elements live in a buffer inside
+// the object. Storage comes from Alloc only once the size exceeds N; from then on it behaves
+// like a vector (growth follows GrowthPolicy, see growth_policy.h).
+#include <initializer_list>
+#include <cstddef>		// ptrdiff_t, size_t
+#include <climits>		// UINT_MAX
+#include <type_traits>	// aligned_storage, alignment_of
+
+#include "allocator.h"
+#include "growth_policy.h"
+#include "uninitialized_functions.h"
+
+namespace MySTL
+{
+	template <typename T, std::size_t N, typename Alloc = allocator<T>, typename GrowthPolicy = double_growth>
+	class small_vector
+	{
+		static_assert(N > 0, "small_vector needs room for at least one inline element");
+
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using iterator               = T*;
+		using const_iterator         = T const *;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using difference_type        = std::ptrdiff_t;
+		using allocator_type         = allocator<T>;
+		using growth_policy          = GrowthPolicy;
+
+		static const size_type inline_capacity = N;
+
+	protected:
+		using data_allocator         = Alloc;
+
+	public:
+		small_vector() : elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N) {}// constructor: default
+
+		small_vector(const small_vector &);								// constructor: copy
+		small_vector(small_vector &&) noexcept(std::is_nothrow_move_constructible<T>::value);// constructor: move, inline elements are moved one by one
+		explicit small_vector(const size_type n);						// constructor: fill
+		small_vector(const size_type n, const_reference val);			// constructor: fill
+		small_vector(std::initializer_list<value_type> il);				// constructor: initializer_list
+		template<typename InputIterator>
+		small_vector(InputIterator first, InputIterator second);		// constructor: range
+
+		small_vector& operator=(const small_vector &rhs);				// assign content: copy
+		small_vector& operator=(small_vector &&rhs) noexcept(std::is_nothrow_move_constructible<T>::value);// assign content: move
+		small_vector& operator=(std::initializer_list<value_type> il);	// assign content: initializer list
+
+		~small_vector();												// destructor
+
+		// Element Access
+		reference operator[](size_type n) { return *(elements_start + n); }	// access element
+		const_reference operator[](size_type n) const { return *(elements_start + n); }
+		reference front() { return *begin(); }							// access first element
+		reference back() { return *(end() - 1); }						// access last element
+		pointer data() { return elements_start; }						// access data
+		const_pointer data() const { return elements_start; }
+		reference at(size_type n);										// access element
+
+		// Modifiers
+		void assign(size_type n, const_reference val);					// assign content: fill
+		void assign(std::initializer_list<value_type> il);				// assign content: initializer list
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last);			// assign content: range
+
+		void push_back(const_reference val);							// add element at the end
+		void push_back(value_type &&val);								// add element at the end: move
+		template <typename... Args>
+		void emplace_back(Args&&... args);								// construct and insert element at the end
+		void pop_back();												// delete last element
+
+		iterator insert(iterator position, const_reference val);		// insert elements: single element
+		iterator insert(iterator position, size_type n, const_reference val);// insert elements: fill
+		template<typename InputIterator>
+		iterator insert(iterator position, InputIterator first, InputIterator second);// insert elements: range
+		iterator insert(iterator position, std::initializer_list<value_type> il);// insert elements: initializer list
+		template <typename... Args>
+		iterator emplace(iterator position, Args&&... args);			// construct and insert element
+
+		iterator erase(iterator position);								// erase elements: single element
+		iterator erase(iterator first, iterator second);				// erase elements: range
+
+		void clear() noexcept;											// clear content, keeps the storage
+		void swap(small_vector &x);										// swap content
+
+		// Capacity
+		size_type size() const { return first_free - elements_start; }	// return size
+		static size_type max_size() { return size_type(UINT_MAX / sizeof(value_type)); }// return maximum size
+		void resize(size_type n, const_reference val = value_type());	// change size
+		size_type capacity() const { return end_of_storage - elements_start; }// return size of allocated storage capacity
+		bool empty() const { return elements_start == first_free; }		// test whether small_vector is empty
+		bool is_inline() const { return elements_start == _inline_data(); }// test whether the elements live in the inline buffer
+		void reserve(size_type n);										// request a change in capacity
+		void shrink_to_fit();											// shrink to fit, moves back inline when size() <= N
+
+		// Iterators
+		iterator begin() { return elements_start; }						// return iterator to begining
+		iterator end() { return first_free; }							// return iterator to end
+		const_iterator begin() const { return elements_start; }
+		const_iterator end() const { return first_free; }
+		const_iterator cbegin() const { return elements_start; }		// return const_iterator to begining
+		const_iterator cend() const { return first_free; }				// return const_iterator to end
+
+	private:
+		pointer _inline_data() { return reinterpret_cast<pointer>(buffer); }
+		const_pointer _inline_data() const { return reinterpret_cast<const_pointer>(buffer); }
+		void _reset_inline() { elements_start = first_free = _inline_data(); end_of_storage = _inline_data() + N; }
+
+		void _free();													// destroy the elements, release heap storage
+		void _steal(small_vector &rhs);									// take over the content of rhs, *this holds no elements
+		void _relocate(size_type newcapacity);							// move the elements to heap storage of newcapacity
+		void _grow(size_type n);										// make room for n more elements
+
+		// auxiliary functions for overloads
+		template <typename InputIterator>
+		void _assign(InputIterator first, InputIterator last, std::false_type);
+		void _assign(size_type n, const_reference val, std::true_type);
+
+		template <typename InputIterator>
+		iterator _insert(iterator position, InputIterator first, InputIterator second, std::false_type);
+		iterator _insert(iterator position, size_type n, const_reference val, std::true_type);
+
+	private:
+		iterator elements_start;	// head pointer, the inline buffer or heap storage
+		iterator first_free;		// the pointer that point to the first free element in the array
+		iterator end_of_storage;	// tail pointer, end of storage
+		typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type buffer[N];	// inline storage
+	};
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	bool operator==(const small_vector<T, N, Alloc, GrowthPolicy>& lhs, const small_vector<T, N, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	bool operator!=(const small_vector<T, N, Alloc, GrowthPolicy>& lhs, const small_vector<T, N, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	bool operator< (const small_vector<T, N, Alloc, GrowthPolicy>& lhs, const small_vector<T, N, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void swap(small_vector<T, N, Alloc, GrowthPolicy>& x, small_vector<T, N, Alloc, GrowthPolicy>& y);
+}
+
+#include "../Implementation/small_vector_impl.h"
+
+#endif // INCLUDED_SMALL_VECTOR_H
@@ -0,0 +1,163 @@
+#ifndef INCLUDED_SOA_VECTOR_H
+#define INCLUDED_SOA_VECTOR_H
+
+// soa_vector<Ts...>: a vector of records (Ts...) stored as a structure of arrays, every field in a
+// contiguous array of its own. A scan over one field only reads that field:
+//	soa_vector<int, double, std::string> v;
+//	v.emplace_back(1, 0.5, "a");
+//	for (double x : v.column<1>()) ...	// touches the doubles only
+// v[i] is a proxy (soa_row) holding a reference into every column; v[i].get<1>() is the field.
+// All columns share size and capacity; growing moves every column (strong guarantee).
+#include <cstddef>		// size_t, ptrdiff_t
+#include <tuple>		// tuple, tuple_element
+#include <type_traits>	// integral_constant
+
+#include "allocator.h"
+#include "type_traits.h"
+#include "growth_policy.h"
+#include "span.h"
+
+namespace MySTL
+{
+	// a row of soa_vector seen through references, Refs are Ts&... or const Ts&...
+	template <typename... Refs>
+	class soa_row
+	{
+	public:
+		explicit soa_row(const std::tuple<Refs...> &r) : refs(r) {}
+
+		template <std::size_t I>
+		typename std::tuple_element<I, std::tuple<Refs...> >::type get() const { return std::get<I>(refs); }
+
+		// the row as values
+		operator std::tuple<typename std::decay<Refs>::type...>() const { return std::tuple<typename std::decay<Refs>::type...>(refs); }
+
+		// assign every field, the row stays where it is
+		soa_row& operator=(const std::tuple<typename std::decay<Refs>::type...> &val) { refs = val; return *this; }
+		soa_row& operator=(std::tuple<typename std::decay<Refs>::type...> &&val) { refs = std::move(val); return *this; }
+		soa_row& operator=(const soa_row &row) { refs = row.refs; return *this; }	// assigns the fields, not the references
+
+		soa_row(const soa_row &) = default;
+
+	private:
+		std::tuple<Refs...> refs;
+	};
+
+	template <std::size_t I, typename... Refs>
+	typename std::tuple_element<I, std::tuple<Refs...> >::type get(const soa_row<Refs...> &row) { return row.template get<I>(); }
+
+
+	template <typename... Ts>
+	class soa_vector
+	{
+		static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+	public:
+		using value_type      = std::tuple<Ts...>;
+		using reference       = soa_row<Ts&...>;
+		using const_reference = soa_row<const Ts&...>;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template <std::size_t I>
+		using column_type     = typename std::tuple_element<I, value_type>::type;
+
+		static const size_type columns = sizeof...(Ts);
+
+	public:
+		soa_vector() : count(0), cap(0) {}								// constructor: default
+		soa_vector(const soa_vector &v);								// constructor: copy
+		soa_vector(soa_vector &&v) noexcept;							// constructor: move
+		soa_vector& operator=(const soa_vector &rhs);					// assign content: copy
+		soa_vector& operator=(soa_vector &&rhs) noexcept;				// assign content: move
+		~soa_vector();													// destructor
+
+		// Element Access
+		reference operator[](size_type n) { return _row(n, _make_index_sequence<sizeof...(Ts)>()); }
+		const_reference operator[](size_type n) const { return _row(n, _make_index_sequence<sizeof...(Ts)>()); }
+		reference front() { return (*this)[0]; }
+		reference back() { return (*this)[count - 1]; }
+
+		// Column Access
+		template <std::size_t I>
+		span<column_type<I> > column() { return span<column_type<I> >(std::get<I>(data_columns), count); }
+		template <std::size_t I>
+		span<const column_type<I> > column() const { return span<const column_type<I> >(std::get<I>(data_columns), count); }
+		template <std::size_t I>
+		column_type<I>* data() { return std::get<I>(data_columns); }
+
+		// Modifiers
+		void push_back(const value_type &val);							// add a row at the end
+		void push_back(value_type &&val);								// add a row at the end: move
+		template <typename... Args>
+		void emplace_back(Args&&... args);								// add a row, one argument per column
+		void pop_back();												// delete last row
+		void erase(size_type pos);										// erase rows: single row
+		void erase(size_type first, size_type last);					// erase rows: range [first, last)
+		void clear();													// clear content
+		void swap(soa_vector &v) noexcept;								// swap content
+
+		// Capacity
+		size_type size() const { return count; }						// return number of rows
+		size_type capacity() const { return cap; }						// return number of rows allocated
+		bool empty() const { return count == 0; }						// test whether soa_vector is empty
+		void reserve(size_type n);										// request a change in capacity
+
+	private:
+		template <std::size_t I>
+		using column_index = std::integral_constant<std::size_t, I>;
+		using last_column  = column_index<sizeof...(Ts)>;
+
+		template <std::size_t... Is>
+		reference _row(size_type n, _index_sequence<Is...>) { return reference(std::tuple<Ts&...>(std::get<Is>(data_columns)[n]...)); }
+		template <std::size_t... Is>
+		const_reference _row(size_type n, _index_sequence<Is...>) const { return const_reference(std::tuple<const Ts&...>(std::get<Is>(data_columns)[n]...)); }
+
+		template <std::size_t... Is>
+		void _push_back(const value_type &val, _index_sequence<Is...>) { emplace_back(std::get<Is>(val)...); }
+		template <std::size_t... Is>
+		void _push_back(value_type &&val, _index_sequence<Is...>) { emplace_back(std::move(std::get<Is>(val))...); }
+
+		// construct column I.. of row @n, undoing the constructed fields if a later one throws
+		template <std::size_t I, typename Arg, typename... Args>
+		void _construct_row(size_type n, column_index<I>, Arg &&arg, Args&&... args);
+		void _construct_row(size_type, last_column) {}
+
+		// move the columns I.. into arrays of @n rows, stored in @fresh; nothing is lost if one throws
+		template <std::size_t I>
+		void _relocate_columns(std::tuple<Ts*...> &fresh, size_type n, column_index<I>);
+		void _relocate_columns(std::tuple<Ts*...> &, size_type, last_column) {}
+
+		// copy the columns I.. of @v into storage of this, which has room for v.size() rows
+		template <std::size_t I>
+		void _copy_columns(const soa_vector &v, column_index<I>);
+		void _copy_columns(const soa_vector &, last_column) {}
+
+		template <std::size_t I>
+		void _erase_column(size_type first, size_type last);
+		template <std::size_t I>
+		void _destroy_column(size_type first, size_type last);
+		template <std::size_t I>
+		void _deallocate_column();
+
+		template <std::size_t... Is>
+		void _erase(size_type first, size_type last, _index_sequence<Is...>);
+		template <std::size_t... Is>
+		void _destroy(size_type first, size_type last, _index_sequence<Is...>);
+		template <std::size_t... Is>
+		void _deallocate(_index_sequence<Is...>);
+		void _free();
+
+	private:
+		std::tuple<Ts*...> data_columns;	// one array of cap elements per column
+		size_type count;					// rows in use
+		size_type cap;						// rows allocated
+	};
+
+	template <typename... Ts>
+	void swap(soa_vector<Ts...>& x, soa_vector<Ts...>& y) noexcept;
+}
+
+#include "../Implementation/soa_vector_impl.h"
+
+#endif // INCLUDED_SOA_VECTOR_H
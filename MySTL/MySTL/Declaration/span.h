@@ -0,0 +1,46 @@
+#ifndef INCLUDED_SPAN_H
+#define INCLUDED_SPAN_H
+
+// span<T>: a non-owning view of @size contiguous elements, what a container hands out when
+// the caller should see its storage without copying it (e.g. one column of soa_vector).
+// The view is invalidated by whatever invalidates the pointers of the owner.
+#include <cstddef>	// size_t, ptrdiff_t
+#include <cassert>	// assert
+
+namespace MySTL
+{
+	template <typename T>
+	class span
+	{
+	public:
+		using element_type    = T;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer         = T*;
+		using reference       = T&;
+		using iterator        = T*;
+
+	public:
+		span() : ptr(nullptr), count(0) {}
+		span(pointer p, size_type n) : ptr(p), count(n) {}
+
+		iterator begin() const { return ptr; }
+		iterator end() const { return ptr + count; }
+		pointer data() const { return ptr; }
+		size_type size() const { return count; }
+		bool empty() const { return count == 0; }
+
+		reference operator[](size_type n) const { assert(n < count); return ptr[n]; }
+		reference front() const { return *ptr; }
+		reference back() const { return ptr[count - 1]; }
+
+		// the elements [offset, offset + n)
+		span subspan(size_type offset, size_type n) const { assert(offset + n <= count); return span(ptr + offset, n); }
+
+	private:
+		pointer ptr;
+		size_type count;
+	};
+}
+
+#endif // INCLUDED_SPAN_H
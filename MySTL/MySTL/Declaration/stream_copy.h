@@ -0,0 +1,86 @@
+#ifndef INCLUDED_STREAM_COPY_H
+#define INCLUDED_STREAM_COPY_H
+
+// copy kernels for trivially copyable ranges, selected by a copy policy:
+//  temporal_copy_tag   plain memcpy, the destination ends up in cache
+//  streaming_copy_tag  non-temporal stores + prefetching, bypass the cache
+//  adaptive_copy_tag   streaming only when the range is at least STREAMING_THRESHOLD bytes
+#include <cstring>      // memcpy
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include "simd_kernels.h"   // MYSTL_HAS_SSE2, SSE2 intrinsics
+
+namespace MySTL
+{
+	struct temporal_copy_tag {};
+	struct streaming_copy_tag {};
+	struct adaptive_copy_tag {};
+
+	// Ranges smaller than this stay on the cached path: streaming only pays off once the
+	// destination would evict a noticeable part of the last level cache anyway.
+	enum { STREAMING_THRESHOLD = 4 * 1024 * 1024 };
+	// how far ahead of the current source position we prefetch (bytes)
+	enum { PREFETCH_DISTANCE = 512 };
+
+
+	// copy @n bytes from @src to @dst with non-temporal stores.
+	// @dst and @src must not overlap.
+	inline void _streaming_memcpy(void *dst, const void *src, std::size_t n)
+	{
+#ifdef MYSTL_HAS_SSE2
+		char *d = static_cast<char*>(dst);
+		const char *s = static_cast<const char*>(src);
+
+		// non-temporal stores need a 16-byte aligned destination, copy the head normally
+		std::size_t head = (16 - (reinterpret_cast<std::uintptr_t>(d) & 15)) & 15;
+		if (head > n)
+			head = n;
+		std::memcpy(d, s, head);
+		d += head;
+		s += head;
+		n -= head;
+
+		// one cache line per iteration
+		for (; n >= 64; n -= 64, d += 64, s += 64)
+		{
+			_mm_prefetch(s + PREFETCH_DISTANCE, _MM_HINT_NTA);
+			__m128i x0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+			__m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16));
+			__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32));
+			__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48));
+			_mm_stream_si128(reinterpret_cast<__m128i*>(d), x0);
+			_mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), x1);
+			_mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), x2);
+			_mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), x3);
+		}
+		// streaming stores are weakly ordered, fence before anyone reads the destination
+		_mm_sfence();
+
+		std::memcpy(d, s, n);	// tail
+#else
+		std::memcpy(dst, src, n);
+#endif
+	}
+
+
+	// overloads for each policy
+	inline void _copy_bytes(void *dst, const void *src, std::size_t n, temporal_copy_tag)
+	{
+		std::memcpy(dst, src, n);
+	}
+
+	inline void _copy_bytes(void *dst, const void *src, std::size_t n, streaming_copy_tag)
+	{
+		_streaming_memcpy(dst, src, n);
+	}
+
+	inline void _copy_bytes(void *dst, const void *src, std::size_t n, adaptive_copy_tag)
+	{
+		if (n >= static_cast<std::size_t>(STREAMING_THRESHOLD))
+			_streaming_memcpy(dst, src, n);
+		else
+			std::memcpy(dst, src, n);
+	}
+}
+
+#endif
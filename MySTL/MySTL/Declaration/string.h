@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <iterator>		// reverse_iterator
 #include <cstddef>		// size_t, ptrdiff_t
+#include <cassert>		// assert
 #include <climits>      // UINT_MAX
 #include <iostream>		// istream, ostream
 
@@ -47,7 +48,7 @@ namespace MySTL
 		template <typename InputIterator>
 		string(InputIterator first, InputIterator last);					// (7) range constructor
 		string(std::initializer_list<char> il);								// (8) initializer list
-		string(string &&str) /*noexcept*/;										// (9) move constructor
+		string(string &&str) noexcept;											// (9) move constructor
 
 		~string();
 
@@ -87,6 +88,11 @@ namespace MySTL
 
 		void resize(size_type n);
 		void resize(size_type n, char c);
+		// change size without filling the new characters, for a buffer that is overwritten right away
+		void resize_default_init(size_type n);
+		// grow the storage to @n and let @op(begin(), n) write into it, the size becomes its return value (<= n)
+		template <typename Operation>
+		void resize_and_overwrite(size_type n, Operation op);
 
 		size_type capacity() const /*noexcept*/ { return end_of_storage - elements_start; }
 		void reserve(size_type n = 0);
@@ -392,6 +398,17 @@ namespace MySTL
 
 	void swap(string& x, string& y);
 
+
+	// a member template has to be visible to its callers, so it is defined here rather than in string_impl.cpp
+	template <typename Operation>
+	void string::resize_and_overwrite(size_type n, Operation op)
+	{
+		reserve(n);
+		size_type new_size = static_cast<size_type>(op(elements_start, n));
+		assert(new_size <= n);
+		first_free = elements_start + new_size;
+	}
+
 	std::istream& operator>> (std::istream& is, string& str);
 	std::ostream& operator<< (std::ostream& os, const string& str);
 
@@ -0,0 +1,227 @@
+#ifndef INCLUDED_SWISS_TABLE_H
+#define INCLUDED_SWISS_TABLE_H
+
+// _swiss_table: the open addressing hash table behind hash_map and hash_set, the way _flat_tree
+// is behind flat_map / flat_set. The values sit in one array of slots; beside it is one control
+// byte per slot: empty (0x80), deleted (0xFE), or the low 7 bits of the hash of the value (H2).
+// A lookup starts at the slot picked by the other bits (H1) and reads the control bytes 16 at a
+// time: one SSE2 compare yields the slots whose H2 matches, so nearly every key compared is the
+// one searched for, and a group holding an empty byte ends the probe. Groups are visited at
+// offsets 0, 16, 48, 96, ... which reaches every slot of a power of two table.
+//	capacity	2^k - 1 slots. The control byte past the last slot is a sentinel that ends
+//				iteration; a copy of the first 15 bytes follows it, so a group read near the end
+//				needs no wrap
+//	load		at most 7/8 of the slots full or deleted. Past that the table doubles, or is
+//				rebuilt at the same size when deletions used up the room
+//	erase		marks the slot deleted, or empty when no probe can have gone past it
+// Slots and control bytes come from MySTL::allocator; an empty table points at one static group
+// and allocates nothing.
+// Iterators and references are invalidated by an insert that grows the table and by rehash;
+// erase invalidates only the erased element.
+// With a transparent Hash and KeyEqual (as hash<string> and equal_to<string> are) the lookups take
+// any type both accept: a const char * or a span<const char> for a string key.
+#include <initializer_list>
+#include <cstddef>		// size_t, ptrdiff_t
+#include <iterator>		// forward_iterator_tag
+#include <utility>		// pair
+#include <type_traits>	// conditional, enable_if, is_convertible
+
+#include "allocator.h"
+#include "functional.h"		// _identity, _select1st
+#include "hash.h"			// hash, equal_to
+#include "simd_kernels.h"	// _match_bytes16, _less_bytes16
+#include "type_traits.h"	// _if_transparent
+
+namespace MySTL
+{
+	// control bytes; a full slot holds H2, in [0, 127]
+	const signed char _ctrl_empty    = -128;
+	const signed char _ctrl_deleted  = -2;
+	const signed char _ctrl_sentinel = -1;
+
+	// the control bytes of every table without slots: a sentinel, then empties
+	inline signed char* _swiss_empty_group()
+	{
+		static signed char group[16] = { _ctrl_sentinel,
+			_ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty,
+			_ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty };
+		return group;
+	}
+
+
+	template <typename T, typename Ref, typename Ptr>
+	class _swiss_iterator
+	{
+		template <typename, typename, typename> friend class _swiss_iterator;
+		template <typename, typename, typename, typename, typename, bool> friend class _swiss_table;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type        = T;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = Ptr;
+		using reference         = Ref;
+
+	public:
+		_swiss_iterator() : ctrl(nullptr), slot(nullptr) {}
+		template <typename R, typename P>
+		_swiss_iterator(const _swiss_iterator<T, R, P> &it) : ctrl(it.ctrl), slot(it.slot) {}	// iterator -> const_iterator
+
+		reference operator*() const { return *slot; }
+		pointer operator->() const { return slot; }
+		_swiss_iterator& operator++() { ++ctrl; ++slot; _skip(); return *this; }
+		_swiss_iterator operator++(int) { _swiss_iterator tmp = *this; ++*this; return tmp; }
+
+		template <typename R, typename P>
+		bool operator==(const _swiss_iterator<T, R, P> &it) const { return ctrl == it.ctrl; }
+		template <typename R, typename P>
+		bool operator!=(const _swiss_iterator<T, R, P> &it) const { return ctrl != it.ctrl; }
+
+	private:
+		_swiss_iterator(const signed char *ctrl, T *slot) : ctrl(ctrl), slot(slot) {}
+
+		// to the next full slot or the sentinel, a group at a time
+		void _skip()
+		{
+			while (*ctrl < _ctrl_sentinel)
+			{
+				const unsigned shift = _count_trailing_zeros(~_less_bytes16(ctrl, _ctrl_sentinel));
+				ctrl += shift;
+				slot += shift;
+			}
+		}
+
+	private:
+		const signed char *ctrl;
+		T *slot;
+	};
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	class _swiss_table
+	{
+	public:
+		using key_type               = Key;
+		using value_type             = Value;
+		using hasher                 = Hash;
+		using key_equal              = KeyEqual;
+		using size_type              = std::size_t;
+		using difference_type        = std::ptrdiff_t;
+		using reference              = Value&;
+		using const_reference        = Value const &;
+		using pointer                = Value*;
+		using const_pointer          = Value const *;
+		using iterator               = typename std::conditional<Mutable, _swiss_iterator<Value, Value&, Value*>,
+														_swiss_iterator<Value, Value const &, Value const *> >::type;
+		using const_iterator         = _swiss_iterator<Value, Value const &, Value const *>;
+
+	protected:
+		// the return type of a heterogeneous lookup, present when Hash and KeyEqual are transparent
+		template <typename K, typename Result>
+		using _if_hetero = typename _if_transparent<Hash, typename _if_transparent<KeyEqual, Result, K>::type, K>::type;
+
+	public:
+		_swiss_table() : _swiss_table(0, Hash(), KeyEqual()) {}
+		_swiss_table(size_type bucket_count, const Hash &hf, const KeyEqual &eq);
+		template <typename InputIterator>
+		_swiss_table(InputIterator first, InputIterator last, size_type bucket_count, const Hash &hf, const KeyEqual &eq);
+		_swiss_table(const _swiss_table &t);
+		_swiss_table(_swiss_table &&t);
+		_swiss_table& operator=(const _swiss_table &t) { _swiss_table tmp(t); swap(tmp); return *this; }
+		_swiss_table& operator=(_swiss_table &&t) { _swiss_table tmp(std::move(t)); swap(tmp); return *this; }
+		~_swiss_table() { _destroy(); _deallocate(); }
+
+		// Iterators
+		iterator begin() { iterator it(ctrl, slots); it._skip(); return it; }
+		iterator end() { return iterator(ctrl + cap, slots + cap); }
+		const_iterator begin() const { const_iterator it(ctrl, slots); it._skip(); return it; }
+		const_iterator end() const { return const_iterator(ctrl + cap, slots + cap); }
+
+		// Capacity
+		size_type size() const { return elements; }
+		bool empty() const { return elements == 0; }
+		size_type max_size() const { return size_type(-1) / (sizeof(Value) + 1) / 2; }
+
+		// Buckets and hash policy
+		size_type bucket_count() const { return cap; }
+		float load_factor() const { return cap ? float(elements) / float(cap) : 0.0f; }
+		float max_load_factor() const { return 0.875f; }
+		void reserve(size_type n);										// room for n values without a rehash
+		void rehash(size_type n);										// rebuild with at least n slots, drops the deleted ones
+
+		// Lookup
+		iterator find(const key_type &k) { return _iter(_find(k, _hash(k))); }
+		const_iterator find(const key_type &k) const { return _iter(_find(k, _hash(k))); }
+		size_type count(const key_type &k) const { return _find(k, _hash(k)) != cap; }
+		bool contains(const key_type &k) const { return _find(k, _hash(k)) != cap; }
+
+		// Lookup, heterogeneous
+		template <typename K>
+		_if_hetero<K, iterator> find(const K &k) { return _iter(_find(k, _hash(k))); }
+		template <typename K>
+		_if_hetero<K, const_iterator> find(const K &k) const { return _iter(_find(k, _hash(k))); }
+		template <typename K>
+		_if_hetero<K, size_type> count(const K &k) const { return _find(k, _hash(k)) != cap; }
+		template <typename K>
+		_if_hetero<K, bool> contains(const K &k) const { return _find(k, _hash(k)) != cap; }
+
+		// Modifiers
+		std::pair<iterator, bool> insert(const value_type &val) { return _insert_unique(val); }
+		std::pair<iterator, bool> insert(value_type &&val) { return _insert_unique(std::move(val)); }
+		template <typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args) { return _insert_unique(value_type(std::forward<Args>(args)...)); }
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last);
+		void insert(std::initializer_list<value_type> il) { insert(il.begin(), il.end()); }
+
+		iterator erase(const_iterator position);
+		size_type erase(const key_type &k) { return _erase_key(k); }
+		template <typename K>
+		typename std::enable_if<!std::is_convertible<const K&, const_iterator>::value, _if_hetero<K, size_type> >::type
+			erase(const K &k) { return _erase_key(k); }
+		void clear();
+		void swap(_swiss_table &t);
+
+		hasher hash_function() const { return hash_fn; }
+		key_equal key_eq() const { return eq; }
+
+	protected:
+		template <typename K>
+		std::size_t _hash(const K &k) const { return static_cast<std::size_t>(hash_fn(k)); }
+		template <typename K>
+		size_type _find(const K &k, std::size_t h) const;				// slot of k, cap if absent
+		size_type _find_first_non_full(std::size_t h) const;			// first empty or deleted slot of the probe
+		size_type _prepare_insert(std::size_t h);						// the slot for a new value, grows if needed
+		void _set_ctrl(size_type i, signed char c) { ctrl[i] = c; ctrl[((i - 15) & cap) + 15] = c; }	// and its copy past the sentinel
+		iterator _iter(size_type i) const { return iterator(ctrl + i, slots + i); }
+
+		template <typename V>
+		std::pair<iterator, bool> _insert_unique(V &&val);
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> _try_emplace(K &&k, Args&&... args);	// value_type(piecewise_construct, k, args), when k is absent
+		template <typename K>
+		size_type _erase_key(const K &k);
+		void _erase_at(size_type i);
+
+		static size_type _growth(size_type c) { return c - c / 8; }		// values a table of c slots holds
+		static size_type _capacity_for(size_type n);					// smallest 2^k - 1 >= 15 that holds n
+		void _grow();
+		void _resize(size_type new_cap);
+		void _allocate(size_type c);									// ctrl / slots for c slots, all empty
+		void _destroy();												// the values
+		void _deallocate();
+
+	protected:
+		signed char *ctrl;			// cap + 16 bytes: one per slot, the sentinel, 15 copies
+		Value *slots;
+		size_type cap;				// 0, or 2^k - 1
+		size_type elements;
+		size_type growth_left;		// inserts into empty slots before the table must grow
+		Hash hash_fn;
+		KeyEqual eq;
+	};
+}
+
+#include "../Implementation/swiss_table_impl.h"
+
+#endif // INCLUDED_SWISS_TABLE_H
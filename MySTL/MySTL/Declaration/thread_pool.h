@@ -0,0 +1,98 @@
+#ifndef INCLUDED_THREAD_POOL_H
+#define INCLUDED_THREAD_POOL_H
+
+#include <cstddef>              // size_t
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>               // unique_ptr
+#include <exception>            // exception_ptr
+
+namespace MySTL
+{
+	// execution policy, selects the parallel overloads of the uninitialized functions
+	struct parallel_policy {};
+	const parallel_policy par = parallel_policy();
+
+
+	// A fixed set of worker threads with static scheduling: task i of a run() always executes
+	// on worker (i % size()), the calling thread being worker 0. Splitting a range into size()
+	// chunks therefore maps every chunk to the same thread on every run, which is what makes
+	// first-touch page placement useful: the thread that constructs a chunk is the thread that
+	// processes it later.
+	class thread_pool
+	{
+	public:
+		typedef std::size_t size_type;
+		typedef std::function<void(size_type)> task_type;
+
+	public:
+		explicit thread_pool(size_type n_threads = std::thread::hardware_concurrency());
+		~thread_pool();
+
+		thread_pool(const thread_pool &) = delete;
+		thread_pool& operator=(const thread_pool &) = delete;
+
+		// number of threads taking part in a run, including the caller
+		size_type size() const { return n_workers + 1; }
+
+		// invoke task(i) for every i in [0, n_tasks) and wait for all of them.
+		// If tasks throw, the first exception is rethrown after every task has finished.
+		// Must not be called from inside a task.
+		void run(size_type n_tasks, const task_type &task);
+
+		// the process-wide pool, sized to the hardware concurrency
+		static thread_pool& instance();
+
+	private:
+		void worker_loop(size_type id);
+		void run_share(size_type id);
+
+	private:
+		std::unique_ptr<std::thread[]> workers;
+		size_type n_workers;
+
+		std::mutex run_mtx;				// serializes concurrent callers of run()
+		std::mutex mtx;
+		std::condition_variable cv_start;
+		std::condition_variable cv_done;
+
+		const task_type *job;
+		size_type job_tasks;
+		size_type pending;				// workers that haven't finished the current job
+		unsigned long generation;		// bumped for every job, wakes the workers
+		bool stopping;
+		std::exception_ptr error;
+	};
+
+
+	// [begin, end) of chunk @i when @n elements are split into @chunks pieces
+	inline std::size_t _chunk_begin(std::size_t n, std::size_t i, std::size_t chunks)
+	{
+		return static_cast<std::size_t>(static_cast<unsigned long long>(n) * i / chunks);
+	}
+
+	// invoke f(begin, end) on the chunks of [0, n), each chunk on its own worker of @pool.
+	// Uses the same partition as the parallel uninitialized functions, so a range that was
+	// constructed in parallel is processed by the threads that first touched its pages.
+	template <typename Function>
+	inline void parallel_for(thread_pool &pool, std::size_t n, Function f)
+	{
+		const std::size_t chunks = pool.size();
+		pool.run(chunks, [&](std::size_t i)
+		{
+			std::size_t b = _chunk_begin(n, i, chunks), e = _chunk_begin(n, i + 1, chunks);
+			if (b != e)
+				f(b, e);
+		});
+	}
+
+	template <typename Function>
+	inline void parallel_for(std::size_t n, Function f)
+	{
+		parallel_for(thread_pool::instance(), n, f);
+	}
+}
+
+#endif
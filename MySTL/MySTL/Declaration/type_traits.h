@@ -1,142 +1,176 @@
-#ifndef INCLUDED_TYPE_TRAITS_H
-#define INCLUDED_TYPE_TRAITS_H
-
-namespace MySTL
-{
-	struct _true_type {};
-	struct _false_type {};
-
-	template<typename T>
-	struct _type_traits
-	{
-		typedef _false_type			has_trivial_default_constructor;
-		typedef _false_type			has_trivial_copy_constructor;
-		typedef _false_type			has_trivial_assignment_operator;
-		typedef _false_type			has_trivial_destructor;
-		typedef _false_type			is_POD_type;
-	};
-
-
-	// partial specialization
-
-	template<> struct _type_traits<char>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<> struct _type_traits<signed char>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<> struct _type_traits<unsigned char>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<short>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<unsigned short>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<int>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<unsigned int>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<long>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<unsigned long>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<float>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<double>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-	template<>	struct _type_traits<long double>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-
-
-	template<typename T>
-	struct _type_traits<T*>
-	{
-		typedef _true_type			has_trivial_default_constructor;
-		typedef _true_type			has_trivial_copy_constructor;
-		typedef _true_type			has_trivial_assignment_operator;
-		typedef _true_type			has_trivial_destructor;
-		typedef _true_type			is_POD_type;
-	};
-}
-
-#endif
+#ifndef INCLUDED_TYPE_TRAITS_H
+#define INCLUDED_TYPE_TRAITS_H
+
+#include <type_traits>	// compiler support for user-defined types
+#include <cstddef>		// size_t
+
+namespace MySTL
+{
+	struct _true_type {};
+	struct _false_type {};
+
+	// maps a compile time bool onto _true_type / _false_type
+	template<bool B> struct _bool_type { typedef _false_type type; };
+	template<> struct _bool_type<true> { typedef _true_type type; };
+
+	// User-defined types: ask the compiler, so that e.g. a struct of ints takes the same
+	// fast paths (memcpy, no destructor calls) as the built-in types below.
+	template<typename T>
+	struct _type_traits
+	{
+		typedef typename _bool_type<std::is_trivially_default_constructible<T>::value>::type	has_trivial_default_constructor;
+		typedef typename _bool_type<std::is_trivially_copy_constructible<T>::value>::type		has_trivial_copy_constructor;
+		typedef typename _bool_type<std::is_trivially_copy_assignable<T>::value>::type			has_trivial_assignment_operator;
+		typedef typename _bool_type<std::is_trivially_destructible<T>::value>::type				has_trivial_destructor;
+		typedef typename _bool_type<std::is_pod<T>::value>::type								is_POD_type;
+	};
+
+
+	// partial specialization
+
+	template<> struct _type_traits<char>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<> struct _type_traits<signed char>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<> struct _type_traits<unsigned char>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<short>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<unsigned short>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<int>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<unsigned int>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<long>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<unsigned long>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<float>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<double>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+	template<>	struct _type_traits<long double>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+
+	template<typename T>
+	struct _type_traits<T*>
+	{
+		typedef _true_type			has_trivial_default_constructor;
+		typedef _true_type			has_trivial_copy_constructor;
+		typedef _true_type			has_trivial_assignment_operator;
+		typedef _true_type			has_trivial_destructor;
+		typedef _true_type			is_POD_type;
+	};
+
+
+	// compile time list of indices 0 .. N-1, std::index_sequence is C++14:
+	// expanding a function over a parameter pack by position, e.g. over every column of soa_vector
+	template <std::size_t... Is>
+	struct _index_sequence {};
+
+	template <std::size_t N, std::size_t... Is>
+	struct _make_index_sequence : _make_index_sequence<N - 1, N - 1, Is...> {};
+
+	template <std::size_t... Is>
+	struct _make_index_sequence<0, Is...> : _index_sequence<Is...> {};
+
+
+	// void for any well-formed type, std::void_t is C++17: detects a member type in a
+	// partial specialization, e.g. Compare::is_transparent for the flat_map lookups
+	template <typename T>
+	struct _void_t { typedef void type; };
+
+	// makes a lookup template visible only when Compare (or Hash, KeyEqual) is transparent
+	// (K only makes the return type depend on the lookup template, so that it is SFINAE)
+	template <typename Compare, typename Result, typename K, typename = void>
+	struct _if_transparent {};
+	template <typename Compare, typename Result, typename K>
+	struct _if_transparent<Compare, Result, K, typename _void_t<typename Compare::is_transparent>::type> { typedef Result type; };
+}
+
+#endif
@@ -2,101 +2,293 @@
 #define INCLUDED_UNINITIALIZED_FUNCTIONS_H
 
 // implementation of
-// uninitialized_copy, uninitialized_fill, uninitialized_fill_n
+// uninitialized_copy, uninitialized_fill, uninitialized_fill_n,
+// uninitialized_move, uninitialized_move_n, uninitialized_move_if_noexcept,
+// uninitialized_default_construct
 #include <cstring>          // function:    memcpy
+#include <utility>          // function:    std::move, std::pair
+#include <type_traits>      // struct:      std::is_nothrow_move_constructible, std::is_copy_constructible, std::is_same
 #include "construct.h"      // function:    construct
 #include "iterator.h"       // struct:      iterator_traits
 #include "type_traits.h"    // struct:      _type_traits
-//#include "algorithm.h"      // function:    copy, fill, fill_n
+#include "algorithm.h"      // function:    copy, fill, fill_n
+#include "stream_copy.h"    // struct:      temporal_copy_tag, streaming_copy_tag, adaptive_copy_tag
 
 
 namespace MySTL
 {
+    // _true_type when [first, last) can be copied into raw memory at result by assignment or memcpy:
+    // both sides hold the same POD type. A range of another type (const char * into std::string,
+    // int into double) is constructed element by element, whatever the source type is
     template <typename InputIterator, typename ForwardIterator>
-    inline typename ForwardIterator uninitialized_copy(InputIterator first, InputIterator last, ForwardIterator result)
+    struct _pod_copy
     {
-        // iterator_traits<InputIterator> invokes the partial specialization version of iterator_traits
-        // (e.g. iterator_traits<const T*>), and get the value type of InputIterator;
-        // After that, invokes the corresponding version partial specialization version of _type_traits
-        // (e.g. _type_traits<int>), so as to judge whether it is POD_TYPE or not.
-        // We've try our best to improve the efficency with respect to different objects :-)
-        typedef typename _type_traits<typename iterator_traits<InputIterator>::value_type>::is_POD_type POD_TYPE;
-        return _uninitialized_copy_aux(first, last, result, POD_TYPE());
+        typedef typename std::remove_cv<typename iterator_traits<InputIterator>::value_type>::type source_type;
+        typedef typename std::remove_cv<typename iterator_traits<ForwardIterator>::value_type>::type value_type;
+        typedef typename std::conditional<std::is_same<source_type, value_type>::value,
+            typename _type_traits<value_type>::is_POD_type, _false_type>::type type;
+    };
+
+
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator _uninitialized_copy_aux(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy, _true_type)
+    {
+        return MySTL::copy(first, last, result);
     }
 
-    template <typename InputIterator, typename ForwardIterator, typename T>
-    inline typename ForwardIterator _uninitialized_copy_aux(InputIterator first, InputIterator last, ForwardIterator result, _true_type)
+    // raw pointers to POD objects: the copy policy picks between cached and non-temporal stores
+    template <typename T, typename CopyPolicy>
+    inline T* _uninitialized_copy_aux(const T *first, const T *last, T *result, CopyPolicy policy, _true_type)
     {
-        return copy(first, last, result);
+        if (first != last)	// an empty vector hands in null pointers, which memcpy must not see
+            _copy_bytes(result, first, sizeof(T) * static_cast<std::size_t>(last - first), policy);
+        return result + (last - first);
     }
 
-    template <typename InputIterator, typename ForwardIterator, typename T>
-    inline typename ForwardIterator _uninitialized_copy_aux(InputIterator first, InputIterator last, ForwardIterator result, _false_type)
+    template <typename T, typename CopyPolicy>
+    inline T* _uninitialized_copy_aux(T *first, T *last, T *result, CopyPolicy policy, _true_type)
+    {
+        return _uninitialized_copy_aux(static_cast<const T*>(first), static_cast<const T*>(last), result, policy, _true_type());
+    }
+
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator _uninitialized_copy_aux(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy, _false_type)
     {
         ForwardIterator curr = result;      // don't change the position of result
-        for ( ; first != last; ++first, ++curr)
-            construct(&*first, curr);
+        try
+        {
+            for ( ; first != last; ++first, ++curr)
+                construct(&*curr, *first);
+        }
+        catch (...)
+        {
+            destory(result, curr);          // roll back what has been constructed so far
+            throw;
+        }
         return curr;
     }
 
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator uninitialized_copy(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy policy)
+    {
+        // iterator_traits<ForwardIterator> invokes the partial specialization version of iterator_traits
+        // (e.g. iterator_traits<T*>), and get the value type of the destination;
+        // After that, invokes the corresponding version partial specialization version of _type_traits
+        // (e.g. _type_traits<int>), so as to judge whether it is POD_TYPE or not. The source has
+        // to hold the same type for the copy to be a plain assignment, see _pod_copy.
+        // We've try our best to improve the efficency with respect to different objects :-)
+        typedef typename _pod_copy<InputIterator, ForwardIterator>::type POD_TYPE;
+        return _uninitialized_copy_aux(first, last, result, policy, POD_TYPE());
+    }
+
+    // large POD ranges are streamed past the cache by default, see stream_copy.h
+    template <typename InputIterator, typename ForwardIterator>
+    inline ForwardIterator uninitialized_copy(InputIterator first, InputIterator last, ForwardIterator result)
+    {
+        return MySTL::uninitialized_copy(first, last, result, adaptive_copy_tag());
+    }
+
     // partial specialization
     inline char* uninitialized_copy(const char *first, const char *last, char *result)
     {
-        std::memcpy(result, first, static_cast<std::size_t>(last - first));
+        _copy_bytes(result, first, static_cast<std::size_t>(last - first), adaptive_copy_tag());
         return result + (last - first);
     }
 
     inline wchar_t* uninitialized_copy(const wchar_t *first, const wchar_t *last, wchar_t *result)
     {
-        std::memcpy(result, first, sizeof(wchar_t) * static_cast<std::size_t>(last - first));
+        _copy_bytes(result, first, sizeof(wchar_t) * static_cast<std::size_t>(last - first), adaptive_copy_tag());
         return result + (last - first);
     }
 
 
     //////////////////////////////////////////////
-    template <typename ForwardIterator, typename T>
-    inline void uninitialized_fill(ForwardIterator first, ForwardIterator last, const T &x)
+    // moving a POD object is copying it, so those ranges take the memcpy path of uninitialized_copy
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator _uninitialized_move_aux(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy policy, _true_type)
+    {
+        return MySTL::uninitialized_copy(first, last, result, policy);
+    }
+
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator _uninitialized_move_aux(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy, _false_type)
+    {
+        ForwardIterator curr = result;
+        try
+        {
+            for (; first != last; ++first, ++curr)
+                construct(&*curr, std::move(*first));
+        }
+        catch (...)
+        {
+            destory(result, curr);  // the moved-from sources are left in a valid but unspecified state
+            throw;
+        }
+        return curr;
+    }
+
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator uninitialized_move(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy policy)
+    {
+        typedef typename _pod_copy<InputIterator, ForwardIterator>::type POD_TYPE;
+        return _uninitialized_move_aux(first, last, result, policy, POD_TYPE());
+    }
+
+    template <typename InputIterator, typename ForwardIterator>
+    inline ForwardIterator uninitialized_move(InputIterator first, InputIterator last, ForwardIterator result)
+    {
+        return MySTL::uninitialized_move(first, last, result, adaptive_copy_tag());
+    }
+
+
+    //////////////////////////////////////////////
+    template <typename InputIterator, typename Size, typename ForwardIterator>
+    inline std::pair<InputIterator, ForwardIterator> uninitialized_move_n(InputIterator first, Size n, ForwardIterator result)
+    {
+        ForwardIterator curr = result;
+        try
+        {
+            for (; n > 0; --n, ++first, ++curr)
+                construct(&*curr, std::move(*first));
+        }
+        catch (...)
+        {
+            destory(result, curr);
+            throw;
+        }
+        return std::pair<InputIterator, ForwardIterator>(first, curr);
+    }
+
+    // partial specialization
+    template <typename T, typename Size>
+    inline std::pair<T*, T*> uninitialized_move_n(T *first, Size n, T *result)
+    {
+        return std::pair<T*, T*>(first + n, MySTL::uninitialized_move(first, first + n, result));
+    }
+
+
+    //////////////////////////////////////////////
+    // Relocation used by the growth paths of the containers: move the elements when that can't
+    // throw (or when there is no copy constructor), copy them otherwise, so that a failure
+    // leaves the source range untouched (strong exception guarantee).
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator _uninitialized_move_if_noexcept_aux(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy policy, std::true_type)
+    {
+        return MySTL::uninitialized_move(first, last, result, policy);
+    }
+
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator _uninitialized_move_if_noexcept_aux(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy policy, std::false_type)
+    {
+        return MySTL::uninitialized_copy(first, last, result, policy);
+    }
+
+    template <typename InputIterator, typename ForwardIterator, typename CopyPolicy>
+    inline ForwardIterator uninitialized_move_if_noexcept(InputIterator first, InputIterator last, ForwardIterator result, CopyPolicy policy)
+    {
+        typedef typename iterator_traits<InputIterator>::value_type T;
+        typedef std::integral_constant<bool,
+            std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value> MOVE;
+        return _uninitialized_move_if_noexcept_aux(first, last, result, policy, MOVE());
+    }
+
+    template <typename InputIterator, typename ForwardIterator>
+    inline ForwardIterator uninitialized_move_if_noexcept(InputIterator first, InputIterator last, ForwardIterator result)
+    {
+        return MySTL::uninitialized_move_if_noexcept(first, last, result, adaptive_copy_tag());
+    }
+
+
+    //////////////////////////////////////////////
+    // default-initialize: objects with a trivial default constructor are left indeterminate
+    template <typename ForwardIterator>
+    inline void _uninitialized_default_construct_aux(ForwardIterator, ForwardIterator, _true_type) {}
+
+    template <typename ForwardIterator>
+    inline void _uninitialized_default_construct_aux(ForwardIterator first, ForwardIterator last, _false_type)
+    {
+        typedef typename iterator_traits<ForwardIterator>::value_type T;
+        ForwardIterator curr = first;
+        try
+        {
+            for (; curr != last; ++curr)
+                new (static_cast<void*>(&*curr)) T;
+        }
+        catch (...)
+        {
+            destory(first, curr);
+            throw;
+        }
+    }
+
+    template <typename ForwardIterator>
+    inline void uninitialized_default_construct(ForwardIterator first, ForwardIterator last)
     {
-        typedef typename _type_traits<iterator_traits<ForwardIterator>::value_type>::is_POD_type POD_TYPE;
-        return _uninntialized_fill_aux(first, last, x, POD_TYPE());
+        typedef typename _type_traits<typename iterator_traits<ForwardIterator>::value_type>::has_trivial_default_constructor TRIVIAL_CTOR;
+        _uninitialized_default_construct_aux(first, last, TRIVIAL_CTOR());
     }
 
+
+    //////////////////////////////////////////////
     template <typename ForwardIterator, typename T>
-    inline void _uninntialized_fill_aux(ForwardIterator first, ForwardIterator last, const T &x, _true_type)
+    inline void _uninitialized_fill_aux(ForwardIterator first, ForwardIterator last, const T &x, _true_type)
     {
-        return fill(first, last, x);
+        MySTL::fill(first, last, x);
     }
 
     template <typename ForwardIterator, typename T>
-    inline void _uninntialized_fill_aux(ForwardIterator first, ForwardIterator last, const T &x, _false_type)
+    inline void _uninitialized_fill_aux(ForwardIterator first, ForwardIterator last, const T &x, _false_type)
     {
         ForwardIterator curr = first;
-        for (; curr != first; ++curr)
-            construct(&*curr, x);
+        try
+        {
+            for (; curr != last; ++curr)
+                construct(&*curr, x);
+        }
+        catch (...)
+        {
+            destory(first, curr);
+            throw;
+        }
+    }
+
+    template <typename ForwardIterator, typename T>
+    inline void uninitialized_fill(ForwardIterator first, ForwardIterator last, const T &x)
+    {
+        typedef typename _type_traits<typename iterator_traits<ForwardIterator>::value_type>::is_POD_type POD_TYPE;
+        _uninitialized_fill_aux(first, last, x, POD_TYPE());
     }
 
 
     //////////////////////////////////////////////
     template <typename ForwardIterator, typename Size, typename T>
-    typename ForwardIterator uninitialized_fill_n(ForwardIterator first, Size n, const T &x)
+    inline ForwardIterator _uninitialized_fill_n_aux(ForwardIterator first, Size n, const T &x, _true_type)
     {
-        typedef typename _type_traits<iterator_traits<ForwardIterator>::value_type>::is_POD_type POD_TYPE;
-        return _uninntialized_fill_n_aux(first, n, x, POD_TYPE());
+        return MySTL::fill_n(first, n, x);
     }
 
     template <typename ForwardIterator, typename Size, typename T>
-    typename ForwardIterator _uninntialized_fill_n_aux(ForwardIterator first, Size n, const T &x, _true_type)
+    inline ForwardIterator _uninitialized_fill_n_aux(ForwardIterator first, Size n, const T &x, _false_type)
     {
-        return fill_n(first, n, x);
+        ForwardIterator curr = first;   // ForwardIterator doesn't support operator+= operation
+        try
+        {
+            for (; n > 0; --n, ++curr)
+                construct(&*curr, x);
+        }
+        catch (...)
+        {
+            destory(first, curr);
+            throw;
+        }
+        return curr;
     }
 
     template <typename ForwardIterator, typename Size, typename T>
-    typename ForwardIterator _uninntialized_fill_n_aux(ForwardIterator first, Size n, const T &x, _false_type)
+    inline ForwardIterator uninitialized_fill_n(ForwardIterator first, Size n, const T &x)
     {
-        ForwardIterator curr = first;   // ForwardIterator doesn't support operator+= operation
-        for (; n; --n, ++curr)
-            construct(&*first, x);
-        return curr;
+        typedef typename _type_traits<typename iterator_traits<ForwardIterator>::value_type>::is_POD_type POD_TYPE;
+        return _uninitialized_fill_n_aux(first, n, x, POD_TYPE());
     }
 }
 
@@ -1,188 +1,241 @@
-#ifndef INCLUDED_VECTOR_H
-#define INCLUDED_VECTOR_H
-
-#include <initializer_list>
-#include <cstddef>		// ptrdiff_t
-#include <memory>		// uninitialized_copy, uninitialized_fill
-
-
-#include "allocator.h"
-#include "reverse_iterator.h"
-
-using namespace MySTL;
-using std::uninitialized_copy;
-using std::uninitialized_fill_n;
-
-namespace MySTL
-{
-
-	template <typename T, typename Alloc = allocator<T>>
-	class vector
-	{
-	public:
-		using size_type              = std::size_t;
-		using value_type             = T;
-		using reference              = T&;
-		using const_reference        = T const &;
-		using iterator               = T*;
-		using const_iterator         = T const *;
-		using pointer                = T*;
-		using const_pointer          = T const *;
-		using reverse_iterator       = std::reverse_iterator<T*>;
-		using const_reverse_iterator = std::reverse_iterator<T const*>;
-		using difference_type        = std::ptrdiff_t;
-		using allocator_type         = allocator<T>;
-
-	protected:
-		using data_allocator         = Alloc;
-
-	public:
-		vector() : elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr) {}//constructor: default
-		
-		vector(const vector &);											// constructor: copy
-		vector(vector &&) /*noexcept*/;										// constructor: move
-		explicit vector(const size_type n);								// constructor: fill
-		vector(const size_type n, const_reference val);					// constructor: fill
-		vector(std::initializer_list<value_type> il);					// constructor: initializer_list
-		template<typename InputIterator>
-		vector(InputIterator first, InputIterator second);				// constructor: range
-
-		vector& operator=(const vector &rhs);							// assign content: copy
-		vector& operator=(std::initializer_list<value_type> il);		// assign content: initializer list
-		vector& operator=(vector &&rhs) /*noexcept*/;						// assign content: move
-		
-		~vector();														// destructor
-		
-		// Element Access
-		reference operator[](size_type n) { return *(elements_start + n); }	// access element
-		reference front() { return *(begin()); }						// access first element
-		reference back() { return *(end() - 1); }						// access last element
-		iterator  data() { return elements_start; }						// access data
-		reference at(size_type n);										// access element
-
-		// Modifiers
-		void assign(size_type n, const_reference);						// assign vector content: fill
-		void assign(std::initializer_list<value_type> il);				// assign vector content: initializer list
-		template <typename InputIterator>
-		void assign(InputIterator first, InputIterator last);
-
-		void push_back(const_reference);								// add element at the end
-		void pop_back();												// delete last element
-
-		iterator insert(iterator position, const_reference val);		// insert elements: single element
-		iterator insert(iterator position, size_type n, const_reference val);// insert elements: fill
-		template<typename InputIterator>
-		iterator insert(iterator position, InputIterator first, InputIterator second);// insert elements: range
-		//iterator insert(iterator position, value_type &&val);			// insert elements: move
-		iterator insert(iterator position, std::initializer_list<value_type> il);// insert elements: initializer list
-
-		void clear() /*noexcept*/ { erase(begin(), end()); } 				// clear content
-		void swap(vector &x);											// swap content
-
-		iterator erase(iterator position);								// erase elements: single element
-		iterator erase(iterator first, iterator second);				// erase elements: range
-
-		template<typename... Args>
-		void emplace(const_iterator position, Args&&... args);			// construct and insert element
-		template<typename... Args>
-		void emplace_back(Args&&... args);								// construct and insert element at the end
-
-		// Capacity
-		size_type size() const { return first_free - elements_start; }	// return size
-		static size_type max_size() /*noexcept*/ { return size_type(UINT_MAX / sizeof(value_type)); }// return maximum size
-		void resize(size_type n, value_type val = value_type());		// change size
-		size_type capacity() const { return end_of_storage - elements_start; }// return size of allocated storage capacity
-		bool empty() const { return elements_start == first_free; }		// test whether vector is empty
-		void reserve(size_type n);										// request a change in capacity
-		void shrink_to_fit();											// shrink to fit
-
-		// Iterators
-		iterator begin() const { return elements_start; }				// return iterator to begining
-		iterator end() const { return first_free; }						// return iterator to end
-		iterator rbegin() const { return reverse_iterator(elements_start); }// return reverse iterator to reverse begining
-		iterator rend() const { return reverse_iterator(first_free); }	// return reverse iterator to reverse end
-		const_iterator cbegin() const { return elements_start; }		// return const_iterator to begining
-		const_iterator cend() const { return first_free; }				// return const_iterator to end
-		const_iterator crbegin() const { return const_reverse_iterator(elements_start); } // return const_reverse_iterator to reverse beigining
-		const_iterator crend() const { return const_reverse_iterator(first_free); } // return const_reverse_iterator to reverse end
-
-		// Allocator
-		//allocator_type get_allocator() const { return data_allocator; }
-		
-
-	private:
-		void chk_n_alloc();
-		template <typename InputIterator>
-		vector& alloc_n_copy(InputIterator, InputIterator);
-		vector& alloc_n_fill_n(const size_type, const_reference);
-
-		void _free();
-		void _reallocate();
-
-		// auxiliary functions for overloads
-		template <typename InputIterator>
-		void _vector(InputIterator first, InputIterator second, std::false_type);
-		void _vector(const size_type n, const_reference val, std::true_type);
-
-		template <typename InputIterator>
-		iterator _insert(iterator position, InputIterator first, InputIterator second, std::false_type);
-		iterator _insert(iterator position, size_type n, const_reference val, std::true_type);
-
-		template <typename InputIterator>
-		void _assign(InputIterator first, InputIterator last, std::false_type);
-		void _assign(size_type n, const_reference val, std::true_type);
-
-	private:
-		iterator elements_start;	// head pointer
-		iterator first_free;		// the pointer that point to the first free element in the array
-		iterator end_of_storage;	// tail pointer, end of storage
-
-	public:
-		// non-member functions overloads
-		template <typename T, typename Alloc>
-		friend bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-		template <typename T, typename Alloc>
-		friend bool operator!= (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-		template <typename T, typename Alloc>
-		friend bool operator<  (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-		template <typename T, typename Alloc>
-		friend bool operator<= (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-		template <typename T, typename Alloc>
-		friend bool operator>  (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-		template <typename T, typename Alloc>
-		friend bool operator>= (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-		template <typename T, typename Alloc>
-		friend void swap(vector<T, Alloc>& x, vector<T, Alloc>& y);
-	};
-
-	template <typename T, typename Alloc>
-	bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-	template <typename T, typename Alloc>
-	bool operator!= (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-	template <typename T, typename Alloc>
-	bool operator<  (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-	template <typename T, typename Alloc>
-	bool operator<= (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-	template <typename T, typename Alloc>
-	bool operator>  (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-	template <typename T, typename Alloc>
-	bool operator>= (const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs);
-
-	template <typename T, typename Alloc>
-	void swap(vector<T, Alloc>& x, vector<T, Alloc>& y);
-}
-
-#include "../Implementation/vector_impl.h"
-
-#endif // INCLUDED_VECTOR_H
+#ifndef INCLUDED_VECTOR_H
+#define INCLUDED_VECTOR_H
+
+#include <initializer_list>
+#include <cstddef>		// ptrdiff_t
+#include <climits>		// UINT_MAX
+#include <memory>		// uninitialized_copy, uninitialized_fill
+
+
+#include "allocator.h"
+#include "reverse_iterator.h"
+#include "move_iterator.h"
+#include "parallel_uninitialized_functions.h"
+#include "growth_policy.h"
+
+using namespace MySTL;
+using std::uninitialized_copy;
+using std::uninitialized_fill_n;
+
+namespace MySTL
+{
+
+	// GrowthPolicy decides the new capacity when the vector runs out of room, see growth_policy.h
+	template <typename T, typename Alloc = allocator<T>, typename GrowthPolicy = double_growth>
+	class vector
+	{
+	public:
+		using size_type              = std::size_t;
+		using value_type             = T;
+		using reference              = T&;
+		using const_reference        = T const &;
+		using iterator               = T*;
+		using const_iterator         = T const *;
+		using pointer                = T*;
+		using const_pointer          = T const *;
+		using reverse_iterator       = std::reverse_iterator<T*>;
+		using const_reverse_iterator = std::reverse_iterator<T const*>;
+		using difference_type        = std::ptrdiff_t;
+		using allocator_type         = allocator<T>;
+		using growth_policy          = GrowthPolicy;
+
+	protected:
+		using data_allocator         = Alloc;
+
+	public:
+		vector() : elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr) {}//constructor: default
+		
+		vector(const vector &);											// constructor: copy
+		vector(vector &&) noexcept;											// constructor: move
+		explicit vector(const size_type n);								// constructor: fill
+		vector(const size_type n, const_reference val);					// constructor: fill
+		vector(std::initializer_list<value_type> il);					// constructor: initializer_list
+		template<typename InputIterator>
+		vector(InputIterator first, InputIterator second);				// constructor: range
+
+		// parallel construction, see parallel_uninitialized_functions.h
+		vector(const parallel_policy &, const vector &);				// constructor: copy
+		vector(const parallel_policy &, const size_type n);				// constructor: fill
+		vector(const parallel_policy &, const size_type n, const_reference val);// constructor: fill
+		template<typename RandomAccessIterator>
+		vector(const parallel_policy &, RandomAccessIterator first, RandomAccessIterator second);// constructor: range
+
+		vector& operator=(const vector &rhs);							// assign content: copy
+		vector& operator=(std::initializer_list<value_type> il);		// assign content: initializer list
+		vector& operator=(vector &&rhs) noexcept;						// assign content: move
+		
+		~vector();														// destructor
+		
+		// Element Access
+		reference operator[](size_type n) { return *(elements_start + n); }	// access element
+		reference front() { return *(begin()); }						// access first element
+		reference back() { return *(end() - 1); }						// access last element
+		iterator  data() { return elements_start; }						// access data
+		reference at(size_type n);										// access element
+
+		// Modifiers
+		void assign(size_type n, const_reference);						// assign vector content: fill
+		void assign(std::initializer_list<value_type> il);				// assign vector content: initializer list
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last);
+		void assign(const parallel_policy &, size_type n, const_reference);	// assign vector content: fill, in parallel
+		template <typename RandomAccessIterator>
+		void assign(const parallel_policy &, RandomAccessIterator first, RandomAccessIterator last);// assign vector content: range, in parallel
+
+		void push_back(const_reference);								// add element at the end
+		void push_back(value_type &&);									// add element at the end: move
+		void pop_back();												// delete last element
+
+		iterator insert(iterator position, const_reference val);		// insert elements: single element
+		iterator insert(iterator position, size_type n, const_reference val);// insert elements: fill
+		template<typename InputIterator>
+		iterator insert(iterator position, InputIterator first, InputIterator second);// insert elements: range, moves from a move_iterator range
+		iterator insert(iterator position, value_type &&val);			// insert elements: move
+		iterator insert(iterator position, std::initializer_list<value_type> il);// insert elements: initializer list
+
+		void clear() /*noexcept*/ { erase(begin(), end()); } 				// clear content
+		void swap(vector &x);											// swap content
+
+		iterator erase(iterator position);								// erase elements: single element
+		iterator erase(iterator first, iterator second);				// erase elements: range
+
+		template<typename... Args>
+		iterator emplace(const_iterator position, Args&&... args);		// construct and insert element
+		template<typename... Args>
+		void emplace_back(Args&&... args);								// construct and insert element at the end
+
+		// Unchecked append, for loops that know how much they will add: no capacity check per element
+		//	T *w = v.reserve_back(n);		// room for n more elements, [w, w + n) is raw memory
+		//	for (...) ::new (w + k) T(...);	// plain stores for trivial types, so the loop can vectorize
+		//	v.commit_back(k);				// the first k elements of the window become part of the vector
+		pointer reserve_back(size_type n);								// make room for @n more elements, return the window
+		void commit_back(size_type n);									// append the @n constructed elements at end()
+		void unchecked_push_back(const_reference val);					// push_back that assumes size() < capacity()
+		template<typename... Args>
+		void unchecked_emplace_back(Args&&... args);					// emplace_back that assumes size() < capacity()
+
+		// Capacity
+		size_type size() const { return first_free - elements_start; }	// return size
+		static size_type max_size() /*noexcept*/ { return size_type(UINT_MAX / sizeof(value_type)); }// return maximum size
+		void resize(size_type n, value_type val = value_type());		// change size
+		// change size, the new elements are default-initialized: left indeterminate for trivial types
+		void resize_default_init(size_type n);
+		// grow the storage to @n and let @op(data(), n) write into it, the size becomes its return value (<= n)
+		// only for trivial types, the elements beyond the old size are raw memory until op writes them
+		template <typename Operation>
+		void resize_and_overwrite(size_type n, Operation op);
+		size_type capacity() const { return end_of_storage - elements_start; }// return size of allocated storage capacity
+		bool empty() const { return elements_start == first_free; }		// test whether vector is empty
+		void reserve(size_type n);										// request a change in capacity
+		void shrink_to_fit();											// shrink to fit
+
+		// Iterators
+		iterator begin() const { return elements_start; }				// return iterator to begining
+		iterator end() const { return first_free; }						// return iterator to end
+		iterator rbegin() const { return reverse_iterator(elements_start); }// return reverse iterator to reverse begining
+		iterator rend() const { return reverse_iterator(first_free); }	// return reverse iterator to reverse end
+		const_iterator cbegin() const { return elements_start; }		// return const_iterator to begining
+		const_iterator cend() const { return first_free; }				// return const_iterator to end
+		const_iterator crbegin() const { return const_reverse_iterator(elements_start); } // return const_reverse_iterator to reverse beigining
+		const_iterator crend() const { return const_reverse_iterator(first_free); } // return const_reverse_iterator to reverse end
+
+		// Allocator
+		//allocator_type get_allocator() const { return data_allocator; }
+		
+
+	private:
+		template <typename InputIterator>
+		vector& alloc_n_copy(InputIterator, InputIterator);
+		vector& alloc_n_fill_n(const size_type, const_reference);
+		template <typename RandomAccessIterator>
+		vector& alloc_n_copy(const parallel_policy &, RandomAccessIterator, RandomAccessIterator);
+		vector& alloc_n_fill_n(const parallel_policy &, const size_type, const_reference);
+
+		void _free();
+		template <typename... Args>
+		iterator _realloc_emplace(iterator position, Args&&... args);	// grow and construct an element at position
+		// capacity to grow to in order to append @n elements
+		size_type _next_capacity(size_type n) const { return GrowthPolicy::next_capacity(size(), n, sizeof(value_type)); }
+
+		// auxiliary functions for overloads
+		template <typename InputIterator>
+		void _vector(InputIterator first, InputIterator second, std::false_type);
+		void _vector(const size_type n, const_reference val, std::true_type);
+		template <typename RandomAccessIterator>
+		void _vector(const parallel_policy &, RandomAccessIterator first, RandomAccessIterator second, std::false_type);
+		void _vector(const parallel_policy &, const size_type n, const_reference val, std::true_type);
+
+		iterator _default_init_n(iterator first, size_type n, std::true_type);	// no-op
+		iterator _default_init_n(iterator first, size_type n, std::false_type);	// runs the default constructor
+		iterator _open_gap(iterator position, size_type n, std::true_type);	// shift the tail by memmove
+		iterator _open_gap(iterator position, size_type n, std::false_type);	// shift the tail by moves
+		template <typename InputIterator>
+		iterator _insert(iterator position, InputIterator first, InputIterator second, std::false_type);
+		iterator _insert(iterator position, size_type n, const_reference val, std::true_type);
+
+		template <typename InputIterator>
+		void _assign(InputIterator first, InputIterator last, std::false_type);
+		void _assign(size_type n, const_reference val, std::true_type);
+		template <typename RandomAccessIterator>
+		void _assign(const parallel_policy &, RandomAccessIterator first, RandomAccessIterator last, std::false_type);
+		void _assign(const parallel_policy &, size_type n, const_reference val, std::true_type);
+
+	private:
+		iterator elements_start;	// head pointer
+		iterator first_free;		// the pointer that point to the first free element in the array
+		iterator end_of_storage;	// tail pointer, end of storage
+
+	public:
+		// non-member functions overloads
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend bool operator==(const vector<T1, Alloc1, GrowthPolicy1>& lhs, const vector<T1, Alloc1, GrowthPolicy1>& rhs);
+
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend bool operator!= (const vector<T1, Alloc1, GrowthPolicy1>& lhs, const vector<T1, Alloc1, GrowthPolicy1>& rhs);
+
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend bool operator<  (const vector<T1, Alloc1, GrowthPolicy1>& lhs, const vector<T1, Alloc1, GrowthPolicy1>& rhs);
+
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend bool operator<= (const vector<T1, Alloc1, GrowthPolicy1>& lhs, const vector<T1, Alloc1, GrowthPolicy1>& rhs);
+
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend bool operator>  (const vector<T1, Alloc1, GrowthPolicy1>& lhs, const vector<T1, Alloc1, GrowthPolicy1>& rhs);
+
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend bool operator>= (const vector<T1, Alloc1, GrowthPolicy1>& lhs, const vector<T1, Alloc1, GrowthPolicy1>& rhs);
+
+		template <typename T1, typename Alloc1, typename GrowthPolicy1>
+		friend void swap(vector<T1, Alloc1, GrowthPolicy1>& x, vector<T1, Alloc1, GrowthPolicy1>& y);
+	};
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator==(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator!= (const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator<  (const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator<= (const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator>  (const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator>= (const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs);
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void swap(vector<T, Alloc, GrowthPolicy>& x, vector<T, Alloc, GrowthPolicy>& y);
+
+	// erase every element for which pred is true in one pass, returns the number of erased elements
+	template <typename T, typename Alloc, typename GrowthPolicy, typename Predicate>
+	typename vector<T, Alloc, GrowthPolicy>::size_type erase_if(vector<T, Alloc, GrowthPolicy>& c, Predicate pred);
+}
+
+#include "../Implementation/vector_impl.h"
+#include "bit_vector.h"	// vector<bool>
+
+#endif // INCLUDED_VECTOR_H
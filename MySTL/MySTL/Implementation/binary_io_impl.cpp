@@ -0,0 +1,148 @@
+#include <istream>
+#include <ostream>
+#include <stdexcept>	// runtime_error
+#include <string>		// std::string, for the error messages
+#include <cstring>		// memcpy, memcmp
+
+#include "../Declaration/binary_io.h"
+
+namespace MySTL
+{
+	//////////////////// header ////////////////////
+	binary_header binary_header::make(kind_type kind, std::size_t element_size, std::size_t alignment, std::size_t count, std::size_t payload_bytes)
+	{
+		binary_header h;
+		std::memcpy(h.magic, "MSTL", 4);
+		h.version = current_version;
+		h.kind = static_cast<std::uint8_t>(kind);
+		h.endian = native_endian();
+		h.reserved = 0;
+		h.element_size = static_cast<std::uint32_t>(element_size);
+		h.alignment = static_cast<std::uint32_t>(alignment);
+		h.count = count;
+		h.payload_bytes = payload_bytes;
+		return h;
+	}
+
+	std::uint8_t binary_header::native_endian()
+	{
+		const std::uint16_t probe = 1;
+		unsigned char first;
+		std::memcpy(&first, &probe, 1);
+		return first == 1 ? little_endian : big_endian;
+	}
+
+	std::size_t binary_header::payload_offset() const
+	{
+		const std::size_t a = alignment ? alignment : 1;
+		return (sizeof(binary_header) + a - 1) / a * a;
+	}
+
+	void binary_header::check(kind_type k, std::size_t elem_size, std::size_t align) const
+	{
+		if (std::memcmp(magic, "MSTL", 4) != 0 || version != current_version)
+			throw std::runtime_error("binary_io: not a MySTL blob");
+		if (endian != native_endian())
+			throw std::runtime_error("binary_io: written on a machine of the other endianness");
+		if (kind != k || element_size != elem_size || alignment != align)
+			throw std::runtime_error("binary_io: blob holds another kind of container or element type");
+		// readers size what they return from count: the payload has to be exactly that big
+		if (k == string_table_kind ? count >= payload_bytes / sizeof(std::uint64_t)
+			: count > payload_bytes / elem_size || count * elem_size != payload_bytes)
+			throw std::runtime_error("binary_io: count does not match the payload size");
+	}
+
+
+	//////////////////// stream helpers ////////////////////
+	void _check_stream(const std::ios &s, const char *what)
+	{
+		if (!s)
+			throw std::runtime_error(std::string(what) + ": stream error");
+	}
+
+	void _write_binary_header(std::ostream &os, const binary_header &h)
+	{
+		static const char zeros[64] = {};
+		os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+		std::size_t padding = h.payload_offset() - sizeof(h);
+		for (; padding > sizeof(zeros); padding -= sizeof(zeros))
+			os.write(zeros, sizeof(zeros));
+		os.write(zeros, static_cast<std::streamsize>(padding));
+		_check_stream(os, "save_binary");
+	}
+
+	binary_header _read_binary_header(std::istream &is, binary_header::kind_type kind, std::size_t element_size, std::size_t alignment)
+	{
+		binary_header h;
+		is.read(reinterpret_cast<char*>(&h), sizeof(h));
+		_check_stream(is, "load_binary");
+		h.check(kind, element_size, alignment);
+		is.ignore(static_cast<std::streamsize>(h.payload_offset() - sizeof(h)));
+		_check_stream(is, "load_binary");
+		return h;
+	}
+
+
+	//////////////////// string ////////////////////
+	void save_binary(std::ostream &os, const string &s)
+	{
+		_write_binary_header(os, binary_header::make(binary_header::string_kind, 1, 1, s.size(), s.size()));
+		if (!s.empty())
+			os.write(s.begin(), static_cast<std::streamsize>(s.size()));
+		_check_stream(os, "save_binary");
+	}
+
+	void load_binary(std::istream &is, string &s)
+	{
+		const binary_header h = _read_binary_header(is, binary_header::string_kind, 1, 1);
+		const std::size_t n = static_cast<std::size_t>(h.count);
+		s.clear();
+		s.resize_and_overwrite(n, [&is](char *p, std::size_t count) -> std::size_t {
+			is.read(p, static_cast<std::streamsize>(count));
+			return static_cast<std::size_t>(is.gcount());
+		});
+		if (s.size() != n)
+			throw std::runtime_error("load_binary: truncated payload");
+	}
+
+
+	//////////////////// zero-copy views ////////////////////
+	const binary_header& _view_binary_header(const void *data, std::size_t size, binary_header::kind_type kind,
+		std::size_t element_size, std::size_t alignment)
+	{
+		if (size < sizeof(binary_header))
+			throw std::runtime_error("binary_io: buffer smaller than a header");
+		if (reinterpret_cast<std::uintptr_t>(data) % std::alignment_of<binary_header>::value != 0)
+			throw std::runtime_error("binary_io: buffer is not aligned for the header");
+		const binary_header &h = *static_cast<const binary_header*>(data);
+		h.check(kind, element_size, alignment);
+		if (h.payload_offset() > size || h.payload_bytes > size - h.payload_offset())
+			throw std::runtime_error("binary_io: buffer ends inside the payload");
+		return h;
+	}
+
+	span<const char> view_binary_string(const void *data, std::size_t size)
+	{
+		const binary_header &h = _view_binary_header(data, size, binary_header::string_kind, 1, 1);
+		return span<const char>(static_cast<const char*>(data) + h.payload_offset(), static_cast<std::size_t>(h.count));
+	}
+
+	string_table_view view_binary_string_table(const void *data, std::size_t size)
+	{
+		const binary_header &h = _view_binary_header(data, size, binary_header::string_table_kind, 1, std::alignment_of<std::uint64_t>::value);
+		const std::size_t n = static_cast<std::size_t>(h.count);
+		const std::uint64_t *offsets = reinterpret_cast<const std::uint64_t*>(static_cast<const char*>(data) + h.payload_offset());
+		const char *chars = reinterpret_cast<const char*>(offsets + n + 1);
+		_check_string_offsets(offsets, n, h.payload_bytes - (n + 1) * sizeof(std::uint64_t));
+		return string_table_view(offsets, chars, n);
+	}
+
+	void _check_string_offsets(const std::uint64_t *offsets, std::size_t n, std::uint64_t chars_bytes)
+	{
+		if (offsets[0] != 0 || offsets[n] != chars_bytes)
+			throw std::runtime_error("binary_io: offset table does not match the payload");
+		for (std::size_t i = 0; i != n; ++i)
+			if (offsets[i] > offsets[i + 1])
+				throw std::runtime_error("binary_io: offset table is not in order");
+	}
+}
@@ -0,0 +1,118 @@
+#ifndef INCLUDED_BINARY_IO_IMPL_H
+#define INCLUDED_BINARY_IO_IMPL_H
+
+#include <istream>
+#include <ostream>
+#include <stdexcept>	// runtime_error
+#include <type_traits>	// is_trivially_copyable, alignment_of
+#include <cstdint>		// uintptr_t
+
+#include "../Declaration/binary_io.h"
+
+namespace MySTL
+{
+	// header and the padding in front of the payload
+	void _write_binary_header(std::ostream &os, const binary_header &h);
+	// read a header and skip the padding in front of the payload
+	binary_header _read_binary_header(std::istream &is, binary_header::kind_type kind, std::size_t element_size, std::size_t alignment);
+	// the checked header of the blob at @data, throws when @size can't hold the whole blob
+	const binary_header& _view_binary_header(const void *data, std::size_t size, binary_header::kind_type kind,
+		std::size_t element_size, std::size_t alignment);
+	// throws unless the @n + 1 offsets of a string table start at 0, never decrease and end at @chars_bytes
+	void _check_string_offsets(const std::uint64_t *offsets, std::size_t n, std::uint64_t chars_bytes);
+	void _check_stream(const std::ios &s, const char *what);
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void save_binary(std::ostream &os, const vector<T, Alloc, GrowthPolicy> &v)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "save_binary writes the bytes of the elements, T must be trivially copyable");
+		const std::size_t bytes = v.size() * sizeof(T);
+		_write_binary_header(os, binary_header::make(binary_header::array_kind, sizeof(T), std::alignment_of<T>::value, v.size(), bytes));
+		os.write(reinterpret_cast<const char*>(v.begin()), static_cast<std::streamsize>(bytes));
+		_check_stream(os, "save_binary");
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void save_binary(std::ostream &os, const vector<string, Alloc, GrowthPolicy> &v)
+	{
+		// offset table first, so a reader finds string i without scanning the ones before it
+		vector<std::uint64_t> offsets;
+		offsets.reserve(v.size() + 1);
+		std::uint64_t offset = 0;
+		offsets.push_back(offset);
+		for (auto it = v.begin(); it != v.end(); ++it)
+			offsets.push_back(offset += it->size());
+		const std::size_t table_bytes = offsets.size() * sizeof(std::uint64_t);
+
+		_write_binary_header(os, binary_header::make(binary_header::string_table_kind, 1, std::alignment_of<std::uint64_t>::value,
+			v.size(), table_bytes + static_cast<std::size_t>(offset)));
+		os.write(reinterpret_cast<const char*>(offsets.begin()), static_cast<std::streamsize>(table_bytes));
+		for (auto it = v.begin(); it != v.end(); ++it)
+			if (!it->empty())
+				os.write(it->begin(), static_cast<std::streamsize>(it->size()));
+		_check_stream(os, "save_binary");
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void load_binary(std::istream &is, vector<T, Alloc, GrowthPolicy> &v)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "load_binary reads the bytes of the elements, T must be trivially copyable");
+		const binary_header h = _read_binary_header(is, binary_header::array_kind, sizeof(T), std::alignment_of<T>::value);
+		const std::size_t n = static_cast<std::size_t>(h.count);
+		v.clear();
+		// straight into the elements, without zeroing them first
+		v.resize_and_overwrite(n, [&is](T *p, std::size_t count) -> std::size_t {
+			is.read(reinterpret_cast<char*>(p), static_cast<std::streamsize>(count * sizeof(T)));
+			return static_cast<std::size_t>(is.gcount()) / sizeof(T);
+		});
+		if (v.size() != n)
+			throw std::runtime_error("load_binary: truncated payload");
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void load_binary(std::istream &is, vector<string, Alloc, GrowthPolicy> &v)
+	{
+		const binary_header h = _read_binary_header(is, binary_header::string_table_kind, 1, std::alignment_of<std::uint64_t>::value);
+		const std::size_t n = static_cast<std::size_t>(h.count);
+		vector<std::uint64_t> offsets;
+		offsets.resize_default_init(n + 1);
+		is.read(reinterpret_cast<char*>(offsets.begin()), static_cast<std::streamsize>((n + 1) * sizeof(std::uint64_t)));
+		_check_stream(is, "load_binary");
+		_check_string_offsets(offsets.begin(), n, h.payload_bytes - (n + 1) * sizeof(std::uint64_t));
+
+		v.clear();
+		v.reserve(n);
+		vector<char> buffer;
+		for (std::size_t i = 0; i != n; ++i)
+		{
+			const std::size_t len = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+			if (len == 0)
+			{
+				v.emplace_back();
+				continue;
+			}
+			buffer.resize_default_init(len);
+			is.read(buffer.begin(), static_cast<std::streamsize>(len));
+			_check_stream(is, "load_binary");
+			v.emplace_back(buffer.begin(), len);
+		}
+	}
+
+
+	template <typename T>
+	span<const T> view_binary_array(const void *data, std::size_t size)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "the view reinterprets the payload bytes, T must be trivially copyable");
+		const binary_header &h = _view_binary_header(data, size, binary_header::array_kind, sizeof(T), std::alignment_of<T>::value);
+		const T *first = reinterpret_cast<const T*>(static_cast<const char*>(data) + h.payload_offset());
+		if (reinterpret_cast<std::uintptr_t>(first) % std::alignment_of<T>::value != 0)
+			throw std::runtime_error("view_binary_array: buffer is not aligned for the element type");
+		return span<const T>(first, static_cast<std::size_t>(h.count));
+	}
+}
+
+#endif // INCLUDED_BINARY_IO_IMPL_H
@@ -0,0 +1,495 @@
+#ifndef INCLUDED_BIT_VECTOR_IMPL_H
+#define INCLUDED_BIT_VECTOR_IMPL_H
+
+#include <stdexcept>	// out_of_range
+#include <cstring>		// memcpy, memset, memcmp
+#include <cassert>		// assert
+
+#include "../Declaration/bit_vector.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>::vector(const vector &v)
+		: words_start(nullptr), bits(0), word_capacity(0)
+	{
+		_reallocate(v.word_count());
+		if (v.word_count())
+			std::memcpy(words_start, v.words_start, v.word_count() * sizeof(word_type));
+		bits = v.bits;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>::vector(vector &&v) noexcept
+		: words_start(v.words_start), bits(v.bits), word_capacity(v.word_capacity)
+	{
+		v.words_start = nullptr;
+		v.bits = v.word_capacity = 0;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>::vector(size_type n, bool val)
+		: words_start(nullptr), bits(0), word_capacity(0)
+	{
+		resize(n, val);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>::vector(std::initializer_list<bool> il)
+		: words_start(nullptr), bits(0), word_capacity(0)
+	{
+		_vector(il.begin(), il.end(), std::false_type());
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	vector<bool, Alloc, GrowthPolicy>::vector(InputIterator first, InputIterator last)
+		: words_start(nullptr), bits(0), word_capacity(0)
+	{
+		_vector(first, last, typename std::is_integral<InputIterator>::type());
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::operator=(const vector &rhs)
+	{
+		if (this != &rhs)
+		{
+			bits = 0;
+			reserve(rhs.bits);
+			if (rhs.word_count())
+				std::memcpy(words_start, rhs.words_start, rhs.word_count() * sizeof(word_type));
+			bits = rhs.bits;
+		}
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::operator=(vector &&rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			data_allocator::deallocate(words_start, word_capacity);
+			words_start = rhs.words_start;
+			bits = rhs.bits;
+			word_capacity = rhs.word_capacity;
+			rhs.words_start = nullptr;
+			rhs.bits = rhs.word_capacity = 0;
+		}
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::operator=(std::initializer_list<bool> il)
+	{
+		bits = 0;
+		_vector(il.begin(), il.end(), std::false_type());
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>::~vector()
+	{
+		data_allocator::deallocate(words_start, word_capacity);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::reference vector<bool, Alloc, GrowthPolicy>::at(size_type n)
+	{
+		if (n >= bits)
+			throw std::out_of_range("vector<bool>::at");
+		return (*this)[n];
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::const_reference vector<bool, Alloc, GrowthPolicy>::at(size_type n) const
+	{
+		if (n >= bits)
+			throw std::out_of_range("vector<bool>::at");
+		return test(n);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::push_back(bool val)
+	{
+		if (bits == capacity())
+			_reallocate(GrowthPolicy::next_capacity(word_count(), 1, sizeof(word_type)));
+		if (bits % bits_per_word == 0)
+			words_start[bits / bits_per_word] = val ? 1 : 0;	// a word not in use yet, write all of it
+		else if (val)
+			words_start[bits / bits_per_word] |= _mask(bits);
+		++bits;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::pop_back()
+	{
+		--bits;
+		_clear_tail();
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::iterator vector<bool, Alloc, GrowthPolicy>::insert(const_iterator position, bool val)
+	{
+		return insert(position, 1, val);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::iterator vector<bool, Alloc, GrowthPolicy>::insert(const_iterator position, size_type n, bool val)
+	{
+		const size_type index = _index(position);
+		const size_type old_bits = bits;
+		_grow_to(bits + n);
+		// shift the tail up by n, bit by bit from the back
+		for (size_type i = old_bits; i-- > index; )
+			(*this)[i + n] = test(i);
+		_fill(index, index + n, val);
+		return begin() + static_cast<difference_type>(index);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::iterator vector<bool, Alloc, GrowthPolicy>::erase(const_iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::iterator vector<bool, Alloc, GrowthPolicy>::erase(const_iterator first, const_iterator last)
+	{
+		const size_type index = _index(first), n = static_cast<size_type>(last - first);
+		for (size_type i = index + n; i < bits; ++i)
+			(*this)[i - n] = test(i);
+		bits -= n;
+		_clear_tail();
+		return begin() + static_cast<difference_type>(index);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::swap(vector &v) noexcept
+	{
+		std::swap(words_start, v.words_start);
+		std::swap(bits, v.bits);
+		std::swap(word_capacity, v.word_capacity);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::set()
+	{
+		_fill(0, bits, true);
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::set(size_type first, size_type last)
+	{
+		_fill(first, last, true);
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::reset()
+	{
+		if (bits)
+			std::memset(words_start, 0, word_count() * sizeof(word_type));
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::reset(size_type first, size_type last)
+	{
+		_fill(first, last, false);
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::flip()
+	{
+		for (size_type i = 0, n = word_count(); i != n; ++i)
+			words_start[i] = ~words_start[i];
+		_clear_tail();
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool vector<bool, Alloc, GrowthPolicy>::any() const
+	{
+		for (size_type i = 0, n = word_count(); i != n; ++i)
+			if (words_start[i])
+				return true;
+		return false;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::size_type vector<bool, Alloc, GrowthPolicy>::find_first() const
+	{
+		for (size_type i = 0, n = word_count(); i != n; ++i)
+			if (words_start[i])
+				return i * bits_per_word + _count_trailing_zeros64(words_start[i]);
+		return npos;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	typename vector<bool, Alloc, GrowthPolicy>::size_type vector<bool, Alloc, GrowthPolicy>::find_next(size_type pos) const
+	{
+		const size_type start = pos + 1;
+		if (start >= bits)
+			return npos;
+		size_type i = start / bits_per_word;
+		// the bits of the first word before start don't count
+		word_type w = words_start[i] & (~word_type(0) << (start % bits_per_word));
+		for (const size_type n = word_count(); !w; w = words_start[i])
+			if (++i == n)
+				return npos;
+		return i * bits_per_word + _count_trailing_zeros64(w);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::operator&=(const vector &rhs)
+	{
+		assert(bits == rhs.bits);
+		_bitwise_words(words_start, rhs.words_start, word_count(), _and_words());
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::operator|=(const vector &rhs)
+	{
+		assert(bits == rhs.bits);
+		_bitwise_words(words_start, rhs.words_start, word_count(), _or_words());
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy>& vector<bool, Alloc, GrowthPolicy>::operator^=(const vector &rhs)
+	{
+		assert(bits == rhs.bits);
+		_bitwise_words(words_start, rhs.words_start, word_count(), _xor_words());
+		return *this;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::resize(size_type n, bool val)
+	{
+		if (n > bits)
+		{
+			const size_type old_bits = bits;
+			_grow_to(n);
+			if (val)
+				_fill(old_bits, n, true);
+		}
+		else
+		{
+			bits = n;
+			_clear_tail();
+		}
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::reserve(size_type n)
+	{
+		if (n > capacity())
+			_reallocate(_words_for(n));
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::shrink_to_fit()
+	{
+		if (word_count() < word_capacity)
+			_reallocate(word_count());
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::_reallocate(size_type words)
+	{
+		word_type *new_start = words ? data_allocator::allocate(words) : nullptr;
+		if (word_count())
+			std::memcpy(new_start, words_start, word_count() * sizeof(word_type));
+		data_allocator::deallocate(words_start, word_capacity);
+		words_start = new_start;
+		word_capacity = words;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::_grow_to(size_type n)
+	{
+		const size_type old_words = word_count(), new_words = _words_for(n);
+		if (new_words > word_capacity)
+			_reallocate(GrowthPolicy::next_capacity(old_words, new_words - old_words, sizeof(word_type)));
+		// the bits past the old size in its last word are 0 already, the words after it are raw memory
+		if (new_words > old_words)
+			std::memset(words_start + old_words, 0, (new_words - old_words) * sizeof(word_type));
+		bits = n;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::_fill(size_type first, size_type last, bool val)
+	{
+		if (first >= last)
+			return;
+		const size_type first_word = first / bits_per_word, last_word = (last - 1) / bits_per_word;
+		const word_type head = ~word_type(0) << (first % bits_per_word);			// bits >= first of the first word
+		const word_type tail = ~word_type(0) >> (bits_per_word - 1 - (last - 1) % bits_per_word);	// bits < last of the last word
+		if (first_word == last_word)
+		{
+			if (val) words_start[first_word] |= head & tail;
+			else words_start[first_word] &= ~(head & tail);
+			return;
+		}
+		if (val) words_start[first_word] |= head;
+		else words_start[first_word] &= ~head;
+		if (last_word > first_word + 1)
+			std::memset(words_start + first_word + 1, val ? 0xFF : 0, (last_word - first_word - 1) * sizeof(word_type));
+		if (val) words_start[last_word] |= tail;
+		else words_start[last_word] &= ~tail;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::_clear_tail()
+	{
+		if (bits % bits_per_word)
+			words_start[bits / bits_per_word] &= ~(~word_type(0) << (bits % bits_per_word));
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	void vector<bool, Alloc, GrowthPolicy>::_vector(InputIterator first, InputIterator last, std::false_type)
+	{
+		for (; first != last; ++first)
+			push_back(static_cast<bool>(*first));
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	void vector<bool, Alloc, GrowthPolicy>::_vector(size_type n, bool val, std::true_type)
+	{
+		resize(n, val);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions
+	// the bits past size() are 0 on both sides, so the words compare as they are
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator==(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		return lhs.size() == rhs.size()
+			&& (lhs.empty() || std::memcmp(lhs.words(), rhs.words(), lhs.word_count() * sizeof(_bit_word)) == 0);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator!=(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+
+	// lexicographic, false before true: the first word that differs holds the first bit that
+	// differs, its lowest set bit of lhs ^ rhs; lhs is less when that bit is 0 in lhs
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator<(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		typedef typename vector<bool, Alloc, GrowthPolicy>::size_type size_type;
+		const size_type common = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+		const size_type full = common / _bits_per_word, rest = common % _bits_per_word;
+		const _bit_word *l = lhs.words(), *r = rhs.words();
+		size_type i = 0;
+		_bit_word diff = 0;
+		while (i != full && (diff = l[i] ^ r[i]) == 0)
+			++i;
+		if (i == full && rest != 0)
+			diff = (l[i] ^ r[i]) & ((_bit_word(1) << rest) - 1);	// only the bits both sides hold
+		if (diff != 0)
+			return ((l[i] >> _count_trailing_zeros64(diff)) & 1) == 0;
+		return lhs.size() < rhs.size();
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator<=(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator>(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		return rhs < lhs;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	bool operator>=(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy> operator&(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		vector<bool, Alloc, GrowthPolicy> result(lhs);
+		result &= rhs;
+		return result;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy> operator|(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		vector<bool, Alloc, GrowthPolicy> result(lhs);
+		result |= rhs;
+		return result;
+	}
+
+
+	template <typename Alloc, typename GrowthPolicy>
+	vector<bool, Alloc, GrowthPolicy> operator^(const vector<bool, Alloc, GrowthPolicy>& lhs, const vector<bool, Alloc, GrowthPolicy>& rhs)
+	{
+		vector<bool, Alloc, GrowthPolicy> result(lhs);
+		result ^= rhs;
+		return result;
+	}
+}
+
+#endif // INCLUDED_BIT_VECTOR_IMPL_H
@@ -0,0 +1,358 @@
+#ifndef INCLUDED_COMPRESSED_INT_VECTOR_IMPL_H
+#define INCLUDED_COMPRESSED_INT_VECTOR_IMPL_H
+
+#include <stdexcept>	// out_of_range
+#include <utility>		// std::swap
+#include <cstring>		// memcpy, memset
+
+#include "../Declaration/compressed_int_vector.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// decoding helpers
+	// the decoded 32-bit gaps / distances as T
+	inline void _widen_u32(const std::uint32_t *, std::uint32_t *, std::size_t) {}	// decoded in place
+	inline void _widen_u32(const std::uint32_t *in, std::uint64_t *out, std::size_t n)
+	{
+		for (std::size_t i = 0; i != n; ++i)
+			out[i] = in[i];
+	}
+
+	inline void _delta_sum(std::uint32_t *p, std::size_t n, std::uint32_t base) { _prefix_sum_u32(p, n, base); }
+	inline void _delta_sum(std::uint64_t *p, std::size_t n, std::uint64_t base)
+	{
+		for (std::size_t i = 0; i != n; ++i)
+			p[i] = base += p[i];
+	}
+
+	// delta block without outliers: unpack and sum in one pass
+	inline bool _unpack_delta(const std::uint32_t *in, unsigned width, std::uint32_t base, std::uint32_t *out)
+	{
+		_unpack_lanes_u32<true>(in, width, out, base);
+		return true;
+	}
+	inline bool _unpack_delta(const std::uint32_t *in, unsigned width, std::uint64_t base, std::uint64_t *out)
+	{
+		// 128 gaps of up to 25 bits sum up to less than 2^32: 32-bit sums from 0, then the base
+		if (width > 25)
+			return false;
+		std::uint32_t sums[128];
+		_unpack_lanes_u32<true>(in, width, sums, 0);
+		for (std::size_t i = 0; i != 128; ++i)
+			out[i] = base + sums[i];
+		return true;
+	}
+
+	// the 32-bit scratch buffer for unpacking: the output itself for uint32_t
+	inline std::uint32_t* _unpack_buffer(std::uint32_t *out, std::uint32_t *) { return out; }
+	inline std::uint32_t* _unpack_buffer(std::uint64_t *, std::uint32_t *scratch) { return scratch; }
+
+
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T>
+	template <typename InputIterator>
+	compressed_int_vector<T>::compressed_int_vector(InputIterator first, InputIterator last)
+		: tail_size(0)
+	{
+		for (; first != last; ++first)
+			push_back(static_cast<value_type>(*first));
+	}
+
+
+	template <typename T>
+	typename compressed_int_vector<T>::value_type compressed_int_vector<T>::operator[](size_type n) const
+	{
+		const size_type b = n / block_size;
+		if (b == blocks.size())
+			return tail[n % block_size];
+		const block_info &info = blocks.begin()[b];
+		if (info.mode == raw_mode)
+		{
+			T val;
+			std::memcpy(&val, words.begin() + info.offset + n % block_size * sizeof(T) / sizeof(std::uint32_t), sizeof(T));
+			return val;
+		}
+		T buffer[block_size];
+		decode_block(b, buffer);
+		return buffer[n % block_size];
+	}
+
+
+	template <typename T>
+	typename compressed_int_vector<T>::value_type compressed_int_vector<T>::at(size_type n) const
+	{
+		if (n >= size())
+			throw std::out_of_range("compressed_int_vector::at");
+		return (*this)[n];
+	}
+
+
+	template <typename T>
+	typename compressed_int_vector<T>::size_type compressed_int_vector<T>::lower_bound(value_type val) const
+	{
+		// the first block starting at or above val; the answer is in the block before it, or is its
+		// start. A run of values equal to val may cross into it, but it cannot begin there
+		size_type lo = 0, hi = block_count();
+		while (lo != hi)
+		{
+			const size_type mid = lo + (hi - lo) / 2;
+			const T first = mid < blocks.size() ? blocks.begin()[mid].base : tail[0];
+			if (first < val)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		if (lo == 0)
+			return 0;
+		T buffer[block_size];
+		const size_type n = decode_block(lo - 1, buffer);
+		size_type i = 0;
+		while (i != n && buffer[i] < val)
+			++i;
+		return (lo - 1) * block_size + i;
+	}
+
+
+	template <typename T>
+	template <typename Function>
+	void compressed_int_vector<T>::for_each(Function f) const
+	{
+		T buffer[block_size];
+		for (size_type b = 0, count = block_count(); b != count; ++b)
+		{
+			const size_type n = decode_block(b, buffer);
+			for (size_type i = 0; i != n; ++i)
+				f(buffer[i]);
+		}
+	}
+
+
+	template <typename T>
+	void compressed_int_vector<T>::decode(value_type *out) const
+	{
+		for (size_type b = 0, count = block_count(); b != count; ++b)
+			out += decode_block(b, out);
+	}
+
+
+	template <typename T>
+	typename compressed_int_vector<T>::size_type compressed_int_vector<T>::decode_block(size_type b, value_type *out) const
+	{
+		if (b == blocks.size())
+		{
+			std::memcpy(out, tail, tail_size * sizeof(T));
+			return tail_size;
+		}
+		const block_info &info = blocks.begin()[b];
+		const std::uint32_t *in = words.begin() + info.offset;
+		if (info.mode == raw_mode)
+		{
+			std::memcpy(out, in, block_size * sizeof(T));
+			return block_size;
+		}
+
+		if (info.mode == delta_mode && info.outliers == 0 && _unpack_delta(in, info.width, info.base, out))
+			return block_size;
+
+		std::uint32_t scratch[block_size];
+		std::uint32_t *packed = _unpack_buffer(out, scratch);
+		_unpack_lanes_u32(in, info.width, packed);
+		_widen_u32(packed, out, block_size);
+
+		// the outliers replace their slots
+		const unsigned char *p = reinterpret_cast<const unsigned char*>(in + 4 * info.width);
+		for (unsigned k = 0; k != info.outliers; ++k)
+		{
+			const unsigned pos = *p++;
+			T val = 0;
+			for (unsigned shift = 0; ; shift += 7)
+			{
+				const unsigned char byte = *p++;
+				val |= static_cast<T>(byte & 0x7F) << shift;
+				if (!(byte & 0x80))
+					break;
+			}
+			out[pos] = val;
+		}
+
+		if (info.mode == delta_mode)
+			_delta_sum(out, block_size, info.base);
+		else
+			for (size_type i = 0; i != block_size; ++i)
+				out[i] += info.base;
+		return block_size;
+	}
+
+
+	template <typename T>
+	void compressed_int_vector<T>::push_back(value_type val)
+	{
+		tail[tail_size++] = val;
+		if (tail_size == block_size)
+			_encode_block();
+	}
+
+
+	template <typename T>
+	void compressed_int_vector<T>::clear()
+	{
+		blocks.clear();
+		words.clear();
+		tail_size = 0;
+	}
+
+
+	template <typename T>
+	void compressed_int_vector<T>::swap(compressed_int_vector &v)
+	{
+		blocks.swap(v.blocks);
+		words.swap(v.words);
+		for (size_type i = 0; i != block_size; ++i)
+			std::swap(tail[i], v.tail[i]);
+		std::swap(tail_size, v.tail_size);
+	}
+
+
+	template <typename T>
+	void compressed_int_vector<T>::shrink_to_fit()
+	{
+		blocks.shrink_to_fit();
+		words.shrink_to_fit();
+	}
+
+
+	template <typename T>
+	typename compressed_int_vector<T>::size_type compressed_int_vector<T>::memory_bytes() const
+	{
+		return sizeof(*this) + blocks.capacity() * sizeof(block_info) + words.capacity() * sizeof(std::uint32_t);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T>
+	void compressed_int_vector<T>::_encode_block()
+	{
+		block_info info;
+		info.offset = words.size();
+		tail_size = 0;
+
+		// gaps when the block is sorted, else distances from the smallest value
+		T d[block_size];
+		bool sorted = true;
+		T low = tail[0];
+		for (size_type i = 1; i != block_size; ++i)
+		{
+			sorted = sorted && tail[i - 1] <= tail[i];
+			low = tail[i] < low ? tail[i] : low;
+		}
+		info.mode = static_cast<std::uint8_t>(sorted ? delta_mode : frame_mode);
+		info.base = sorted ? tail[0] : low;
+		for (size_type i = 0; i != block_size; ++i)
+			d[i] = sorted ? (i ? tail[i] - tail[i - 1] : 0) : tail[i] - low;
+
+		// the width with the smallest block: packed words + outlier pairs
+		size_type outlier_bytes[65] = {}, outlier_count[65] = {};	// of the values of each bit length
+		for (size_type i = 0; i != block_size; ++i)
+		{
+			const unsigned len = _bit_length(d[i]);
+			outlier_bytes[len] += 1 + _varint_length(d[i]);
+			++outlier_count[len];
+		}
+		size_type best_bytes = block_size * sizeof(T), best_outliers = 0;
+		unsigned best_width = 0;
+		bool raw = true;
+		for (unsigned width = 32; ; --width)
+		{
+			size_type bytes = 4 * width * sizeof(std::uint32_t), outliers = 0;
+			for (unsigned len = width + 1; len <= 64; ++len)
+			{
+				bytes += outlier_bytes[len];
+				outliers += outlier_count[len];
+			}
+			if (bytes < best_bytes)
+			{
+				best_bytes = bytes;
+				best_width = width;
+				best_outliers = outliers;
+				raw = false;
+			}
+			if (width == 0)
+				break;
+		}
+
+		if (raw)
+		{
+			info.mode = raw_mode;
+			info.base = tail[0];
+			info.width = 0;
+			info.outliers = 0;
+			const size_type raw_words = block_size * sizeof(T) / sizeof(std::uint32_t);
+			std::memcpy(words.reserve_back(raw_words), tail, block_size * sizeof(T));
+			words.commit_back(raw_words);
+			blocks.push_back(info);
+			return;
+		}
+
+		info.width = static_cast<std::uint8_t>(best_width);
+		info.outliers = static_cast<std::uint16_t>(best_outliers);
+		const size_type packed_words = 4 * best_width;
+		const size_type pair_words = (best_bytes - packed_words * sizeof(std::uint32_t) + 3) / 4;
+		// reserve_back grows the words geometrically, resize would reallocate for every block
+		std::uint32_t *out = words.reserve_back(packed_words + pair_words);
+		if (packed_words + pair_words)	// a block of equal values / gaps takes no words
+			std::memset(out, 0, (packed_words + pair_words) * sizeof(std::uint32_t));
+		words.commit_back(packed_words + pair_words);
+
+		// slot j of lane l is value 4 * j + l, at bit j * width of the lane
+		const T mask = best_width == 32 ? T(0xFFFFFFFFu) : (T(1) << best_width) - 1;
+		if (best_width)
+			for (size_type i = 0; i != block_size; ++i)
+			{
+				const size_type lane = i % 4, bit = i / 4 * best_width;
+				const std::uint64_t v = static_cast<std::uint64_t>(d[i] & mask) << (bit % 32);
+				out[4 * (bit / 32) + lane] |= static_cast<std::uint32_t>(v);
+				if (bit % 32 + best_width > 32)
+					out[4 * (bit / 32 + 1) + lane] |= static_cast<std::uint32_t>(v >> 32);
+			}
+
+		unsigned char *p = reinterpret_cast<unsigned char*>(out + packed_words);
+		for (size_type i = 0; i != block_size; ++i)
+		{
+			if (_bit_length(d[i]) <= best_width)
+				continue;
+			*p++ = static_cast<unsigned char>(i);
+			for (T x = d[i]; ; x >>= 7)
+			{
+				if (x < 0x80)
+				{
+					*p++ = static_cast<unsigned char>(x);
+					break;
+				}
+				*p++ = static_cast<unsigned char>(x | 0x80);
+			}
+		}
+		blocks.push_back(info);
+	}
+
+
+	template <typename T>
+	unsigned compressed_int_vector<T>::_bit_length(T x)
+	{
+		const std::uint64_t y = x;
+		if (y >> 32)	// size_t may be 32 bits
+			return 33 + _floor_log2(static_cast<std::size_t>(y >> 32));
+		return y ? _floor_log2(static_cast<std::size_t>(y)) + 1 : 0;
+	}
+
+
+	template <typename T>
+	unsigned compressed_int_vector<T>::_varint_length(T x)
+	{
+		return x ? (_bit_length(x) + 6) / 7 : 1;	// 7 bits per byte
+	}
+}
+
+#endif // INCLUDED_COMPRESSED_INT_VECTOR_IMPL_H
@@ -0,0 +1,269 @@
+#ifndef INCLUDED_CONCURRENT_VECTOR_IMPL_H
+#define INCLUDED_CONCURRENT_VECTOR_IMPL_H
+
+#include <utility>		// std::move, std::forward
+#include <stdexcept>	// out_of_range
+#include <type_traits>	// is_trivially_destructible
+
+#include "../Declaration/concurrent_vector.h"
+#include "../Declaration/construct.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	concurrent_vector<T, FirstSegment, Alloc>::concurrent_vector()
+		: claimed(0), published(0), segments(0)
+	{
+		for (size_type k = 0; k != max_segments; ++k)
+		{
+			table[k].store(nullptr, std::memory_order_relaxed);
+			ready[k].store(nullptr, std::memory_order_relaxed);
+		}
+		_add_segments(0);	// begin() is taken before the first push, it has to point into a segment
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	concurrent_vector<T, FirstSegment, Alloc>::~concurrent_vector()
+	{
+		_free();
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename concurrent_vector<T, FirstSegment, Alloc>::reference concurrent_vector<T, FirstSegment, Alloc>::at(size_type n)
+	{
+		if (n >= size())
+			throw std::out_of_range("concurrent_vector::at");
+		return (*this)[n];
+	}
+
+
+	// a slot past claimed_size() may sit in a segment that is still being added
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	bool concurrent_vector<T, FirstSegment, Alloc>::is_ready(size_type n) const
+	{
+		const size_type k = _segment_of(n);
+		const size_type off = n - _segment_start(k);
+		const std::atomic<std::uint64_t> *words = ready[k].load(std::memory_order_acquire);
+		return words && ((words[off / 64].load(std::memory_order_acquire) >> (off % 64)) & 1);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::push_back(const_reference val)
+	{
+		emplace_back(val);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::push_back(value_type &&val)
+	{
+		emplace_back(std::move(val));
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	template <typename... Args>
+	typename concurrent_vector<T, FirstSegment, Alloc>::reference concurrent_vector<T, FirstSegment, Alloc>::emplace_back(Args&&... args)
+	{
+		// elements never move, so args may refer to one of them
+		const size_type i = claimed.fetch_add(1, std::memory_order_relaxed);
+		const size_type k = _segment_of(i), off = i - _segment_start(k);
+		if (k >= segments.load(std::memory_order_acquire))
+			_add_segments(k);
+		pointer p = table[k].load(std::memory_order_acquire) + off;
+		data_allocator::construct(p, std::forward<Args>(args)...);
+		ready[k].load(std::memory_order_acquire)[off / 64].fetch_or(std::uint64_t(1) << (off % 64), std::memory_order_release);
+		return *p;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::grow_by(size_type n)
+	{
+		return _grow(n, [](pointer p) { data_allocator::construct(p); });
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::grow_by(size_type n, const_reference val)
+	{
+		return _grow(n, [&val](pointer p) { data_allocator::construct(p, val); });
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	template <typename InputIterator>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::grow_by(InputIterator first, InputIterator last)
+	{
+		return _grow(static_cast<size_type>(last - first), [&first](pointer p) { data_allocator::construct(p, *first); ++first; });
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::clear()
+	{
+		const size_type n = claimed.load(std::memory_order_acquire);
+		if (!std::is_trivially_destructible<T>::value)
+			for (size_type i = 0; i != n; ++i)
+				if (is_ready(i))	// holes left by a throwing constructor hold no element
+					MySTL::destory(_address(i));
+		for (size_type k = 0, count = segments.load(std::memory_order_acquire); k != count; ++k)
+		{
+			std::atomic<std::uint64_t> *words = ready[k].load(std::memory_order_relaxed);
+			for (size_type w = 0; w != _word_count(k); ++w)
+				words[w].store(0, std::memory_order_relaxed);
+		}
+		claimed.store(0, std::memory_order_release);
+		published.store(0, std::memory_order_release);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::reserve(size_type n)
+	{
+		if (n > capacity())
+			_add_segments(_segment_of(n - 1));
+	}
+
+
+	// the cursor moves over the ready bits a word at a time, and never backwards
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::size() const
+	{
+		size_type cur = published.load(std::memory_order_acquire);
+		size_type p = cur;
+		for (;;)
+		{
+			const size_type k = _segment_of(p);
+			const std::atomic<std::uint64_t> *words = ready[k].load(std::memory_order_acquire);
+			if (!words)
+				break;
+			const size_type off = p - _segment_start(k);
+			const size_type bit = off % 64;
+			const size_type avail = 64 - bit < _segment_size(k) - off ? 64 - bit : _segment_size(k) - off;
+			const std::uint64_t w = ~(words[off / 64].load(std::memory_order_acquire) >> bit);	// the zeros shifted in stop the count at the end of the word
+			size_type ones = w ? _count_trailing_zeros64(w) : 64;
+			if (ones > avail)
+				ones = avail;
+			p += ones;
+			if (ones < avail)
+				break;
+		}
+		while (cur < p && !published.compare_exchange_weak(cur, p, std::memory_order_acq_rel, std::memory_order_acquire))
+			;
+		return cur < p ? p : cur;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::pending_size() const
+	{
+		const size_type n = size();	// first: claimed only grows, so the difference can't wrap
+		return claimed.load(std::memory_order_acquire) - n;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::_claim(size_type n)
+	{
+		const size_type first = claimed.fetch_add(n, std::memory_order_relaxed);
+		if (n)
+		{
+			const size_type k = _segment_of(first + n - 1);
+			if (k >= segments.load(std::memory_order_acquire))
+				_add_segments(k);
+		}
+		return first;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	template <typename Construct>
+	typename concurrent_vector<T, FirstSegment, Alloc>::size_type concurrent_vector<T, FirstSegment, Alloc>::_grow(size_type n, Construct construct)
+	{
+		const size_type first = _claim(n), last = first + n;
+		size_type i = first;
+		try
+		{
+			while (i != last)
+			{
+				// one segment at a time, the slots in it are contiguous
+				const size_type k = _segment_of(i);
+				const size_type seg_last = last < _segment_start(k + 1) ? last : _segment_start(k + 1);
+				for (pointer p = _address(i); i != seg_last; ++i, ++p)
+					construct(p);
+			}
+		}
+		catch (...)
+		{
+			_publish(first, i);
+			throw;
+		}
+		_publish(first, last);
+		return first;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::_add_segments(size_type k)
+	{
+		std::lock_guard<std::mutex> lock(_segment_mutex());
+		size_type s = segments.load(std::memory_order_relaxed);
+		for (; s <= k; ++s)
+		{
+			pointer elements = data_allocator::allocate(_segment_size(s));
+			std::atomic<std::uint64_t> *words = word_allocator::allocate(_word_count(s));
+			for (size_type w = 0; w != _word_count(s); ++w)
+				word_allocator::construct(words + w, std::uint64_t(0));
+			ready[s].store(words, std::memory_order_release);
+			table[s].store(elements, std::memory_order_release);
+			segments.store(s + 1, std::memory_order_release);
+		}
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::_publish(size_type first, size_type last)
+	{
+		while (first != last)
+		{
+			const size_type k = _segment_of(first);
+			const size_type seg_last = last < _segment_start(k + 1) ? last : _segment_start(k + 1);
+			std::atomic<std::uint64_t> *words = ready[k].load(std::memory_order_acquire);
+			for (size_type off = first - _segment_start(k); first != seg_last; )
+			{
+				const size_type bit = off % 64;
+				const size_type n = 64 - bit < seg_last - first ? 64 - bit : seg_last - first;
+				const std::uint64_t mask = (n == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << n) - 1) << bit;
+				words[off / 64].fetch_or(mask, std::memory_order_release);
+				first += n;
+				off += n;
+			}
+		}
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void concurrent_vector<T, FirstSegment, Alloc>::_free()
+	{
+		clear();
+		std::lock_guard<std::mutex> lock(_segment_mutex());
+		for (size_type k = 0, count = segments.load(std::memory_order_relaxed); k != count; ++k)
+		{
+			data_allocator::deallocate(table[k].load(std::memory_order_relaxed), _segment_size(k));
+			word_allocator::deallocate(ready[k].load(std::memory_order_relaxed), _word_count(k));
+			table[k].store(nullptr, std::memory_order_relaxed);
+			ready[k].store(nullptr, std::memory_order_relaxed);
+		}
+		segments.store(0, std::memory_order_relaxed);
+	}
+}
+
+#endif // INCLUDED_CONCURRENT_VECTOR_IMPL_H
@@ -0,0 +1,381 @@
+#ifndef INCLUDED_COW_VECTOR_IMPL_H
+#define INCLUDED_COW_VECTOR_IMPL_H
+
+#include <iterator>		// std::distance
+#include <stdexcept>	// out_of_range
+#include <type_traits>	// is_integral
+#include <utility>		// std::move, std::forward
+
+#include "../Declaration/algorithm.h"
+#include "../Declaration/cow_vector.h"
+#include "../Declaration/uninitialized_functions.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, typename Alloc>
+	cow_vector<T, Alloc>::cow_vector(size_type n)
+		: rep(nullptr)
+	{
+		_fill_initialize(n, value_type());
+	}
+
+
+	template <typename T, typename Alloc>
+	cow_vector<T, Alloc>::cow_vector(size_type n, const_reference val)
+		: rep(nullptr)
+	{
+		_fill_initialize(n, val);
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename ForwardIterator>
+	cow_vector<T, Alloc>::cow_vector(ForwardIterator first, ForwardIterator last)
+		: rep(nullptr)
+	{
+		typedef typename std::is_integral<ForwardIterator>::type IS_INTEGER;
+		_range_initialize(first, last, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc>
+	cow_vector<T, Alloc>::cow_vector(std::initializer_list<value_type> il)
+		: rep(nullptr)
+	{
+		_range_initialize(il.begin(), il.end(), std::false_type());
+	}
+
+
+	template <typename T, typename Alloc>
+	cow_vector<T, Alloc>::cow_vector(const vector<T> &v)
+		: rep(nullptr)
+	{
+		_range_initialize(v.begin(), v.end(), std::false_type());
+	}
+
+
+	template <typename T, typename Alloc>
+	cow_vector<T, Alloc>& cow_vector<T, Alloc>::operator=(const cow_vector &x)
+	{
+		if (rep != x.rep)
+		{
+			x._retain();
+			_release(rep);
+			rep = x.rep;
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc>
+	cow_vector<T, Alloc>& cow_vector<T, Alloc>::operator=(cow_vector &&x) noexcept
+	{
+		if (this != &x)
+		{
+			_rep *old = rep;
+			rep = x.rep;
+			x.rep = nullptr;
+			_release(old);
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc>
+	typename cow_vector<T, Alloc>::const_reference cow_vector<T, Alloc>::at(size_type n) const
+	{
+		if (n >= size())
+			throw std::out_of_range("cow_vector::at");
+		return _data()[n];
+	}
+
+
+	template <typename T, typename Alloc>
+	typename cow_vector<T, Alloc>::reference cow_vector<T, Alloc>::at(size_type n)
+	{
+		if (n >= size())
+			throw std::out_of_range("cow_vector::at");
+		return _mutable_data()[n];
+	}
+
+
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::reserve(size_type n)
+	{
+		if (n > capacity())
+			_make_unique(n);
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename... Args>
+	void cow_vector<T, Alloc>::emplace_back(Args&&... args)
+	{
+		if (rep && rep->size != rep->capacity && _unique())
+		{
+			data_allocator::construct(_elements(rep) + rep->size, std::forward<Args>(args)...);
+			++rep->size;
+		}
+		else
+			_emplace_back_aux(std::forward<Args>(args)...);
+	}
+
+
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::pop_back()
+	{
+		T *p = _mutable_data();
+		data_allocator::destroy(p + --rep->size);
+	}
+
+
+	// the new value is built first: @val may live in the buffer that is about to be replaced
+	template <typename T, typename Alloc>
+	typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::insert(const_iterator position, const_reference val)
+	{
+		const size_type index = static_cast<size_type>(position - _data());
+		value_type tmp(val);
+		if (size() == capacity() || !_unique())
+			_make_unique(size() == capacity() ? _grown_capacity(size() + 1) : capacity());
+		T *p = _elements(rep);
+		const size_type n = rep->size;
+		if (index == n)
+			data_allocator::construct(p + n, std::move(tmp));
+		else
+		{
+			data_allocator::construct(p + n, std::move(p[n - 1]));
+			MySTL::move_backward(p + index, p + n - 1, p + n);
+			p[index] = std::move(tmp);
+		}
+		++rep->size;
+		return p + index;
+	}
+
+
+	template <typename T, typename Alloc>
+	typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::erase(const_iterator first, const_iterator last)
+	{
+		const size_type index = static_cast<size_type>(first - _data()), count = static_cast<size_type>(last - first);
+		if (count == 0)
+			return _mutable_data() + index;
+		T *p = _mutable_data();
+		T *new_end = MySTL::move(p + index + count, p + rep->size, p + index);
+		data_allocator::destroy(new_end, p + rep->size);
+		rep->size -= count;
+		return p + index;
+	}
+
+
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::resize(size_type n, const_reference val)
+	{
+		const size_type old_size = size();
+		if (n < old_size)
+		{
+			T *p = _mutable_data();
+			data_allocator::destroy(p + n, p + old_size);
+			rep->size = n;
+		}
+		else if (n > old_size)
+		{
+			value_type tmp(val);
+			if (n > capacity() || !_unique())
+				_make_unique(n > capacity() ? _grown_capacity(n) : capacity());
+			MySTL::uninitialized_fill_n(_elements(rep) + old_size, n - old_size, tmp);
+			rep->size = n;
+		}
+	}
+
+
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::clear()
+	{
+		if (!rep)
+			return;
+		if (!_unique())
+		{
+			_release(rep);
+			rep = nullptr;
+			return;
+		}
+		data_allocator::destroy(_elements(rep), _elements(rep) + rep->size);
+		rep->size = 0;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// protected member functions
+	// acq_rel: the last owner sees every read the others made of the buffer before it destroys it
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::_release(_rep *r)
+	{
+		if (r && r->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			data_allocator::destroy(_elements(r), _elements(r) + r->size);
+			_deallocate(r);
+		}
+	}
+
+
+	template <typename T, typename Alloc>
+	typename cow_vector<T, Alloc>::_rep* cow_vector<T, Alloc>::_allocate(size_type capacity)
+	{
+		T *block;
+		{
+			std::lock_guard<std::mutex> lock(_cow_alloc_mutex());
+			block = data_allocator::allocate(header_slots + capacity);
+		}
+		_rep *r = reinterpret_cast<_rep*>(block);
+		new (&r->refs) std::atomic<size_type>(1);
+		r->size = 0;
+		r->capacity = capacity;
+		return r;
+	}
+
+
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::_deallocate(_rep *r)
+	{
+		const size_type capacity = r->capacity;
+		r->refs.~atomic();
+		std::lock_guard<std::mutex> lock(_cow_alloc_mutex());
+		data_allocator::deallocate(reinterpret_cast<T*>(r), header_slots + capacity);
+	}
+
+
+	// a shared buffer is copied, a private one moved (when that cannot throw)
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::_make_unique(size_type capacity)
+	{
+		const size_type n = size();
+		if (capacity < n)
+			capacity = n;
+		_rep *r = _allocate(capacity);
+		try
+		{
+			if (rep && !_unique())
+				MySTL::uninitialized_copy(_elements(rep), _elements(rep) + n, _elements(r));
+			else if (rep)
+				MySTL::uninitialized_move_if_noexcept(_elements(rep), _elements(rep) + n, _elements(r));
+		}
+		catch (...)
+		{
+			_deallocate(r);
+			throw;
+		}
+		r->size = n;
+		_rep *old = rep;
+		rep = r;
+		_release(old);
+	}
+
+
+	// the new element goes in first, @args may refer into the old buffer
+	template <typename T, typename Alloc>
+	template <typename... Args>
+	void cow_vector<T, Alloc>::_emplace_back_aux(Args&&... args)
+	{
+		const size_type n = size();
+		const size_type new_capacity = n == capacity() ? _grown_capacity(n + 1) : capacity();
+		_rep *r = _allocate(new_capacity);
+		T *p = _elements(r);
+		try
+		{
+			data_allocator::construct(p + n, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			_deallocate(r);
+			throw;
+		}
+		try
+		{
+			if (rep && !_unique())
+				MySTL::uninitialized_copy(_elements(rep), _elements(rep) + n, p);
+			else if (rep)
+				MySTL::uninitialized_move_if_noexcept(_elements(rep), _elements(rep) + n, p);
+		}
+		catch (...)
+		{
+			data_allocator::destroy(p + n);
+			_deallocate(r);
+			throw;
+		}
+		r->size = n + 1;
+		_rep *old = rep;
+		rep = r;
+		_release(old);
+	}
+
+
+	template <typename T, typename Alloc>
+	void cow_vector<T, Alloc>::_fill_initialize(size_type n, const_reference val)
+	{
+		if (n == 0)
+			return;
+		rep = _allocate(n);
+		try
+		{
+			MySTL::uninitialized_fill_n(_elements(rep), n, val);
+		}
+		catch (...)
+		{
+			_deallocate(rep);
+			rep = nullptr;
+			throw;
+		}
+		rep->size = n;
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename Integer>
+	void cow_vector<T, Alloc>::_range_initialize(Integer n, Integer val, std::true_type)
+	{
+		_fill_initialize(static_cast<size_type>(n), static_cast<value_type>(val));
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename ForwardIterator>
+	void cow_vector<T, Alloc>::_range_initialize(ForwardIterator first, ForwardIterator last, std::false_type)
+	{
+		const size_type n = static_cast<size_type>(std::distance(first, last));
+		if (n == 0)
+			return;
+		rep = _allocate(n);
+		try
+		{
+			MySTL::uninitialized_copy(first, last, _elements(rep));
+		}
+		catch (...)
+		{
+			_deallocate(rep);
+			rep = nullptr;
+			throw;
+		}
+		rep->size = n;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions
+	template <typename T, typename Alloc>
+	bool operator==(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return false;
+		return lhs.data() == rhs.data() || MySTL::equal(lhs.begin(), lhs.end(), rhs.begin());	// a shared buffer is equal to itself
+	}
+
+
+	template <typename T, typename Alloc>
+	bool operator<(const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return MySTL::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+}
+
+#endif // INCLUDED_COW_VECTOR_IMPL_H
@@ -0,0 +1,201 @@
+#ifndef INCLUDED_FLAT_TREE_IMPL_H
+#define INCLUDED_FLAT_TREE_IMPL_H
+
+#include <algorithm>	// std::sort, std::lower_bound
+#include <iterator>		// std::make_move_iterator
+#include <tuple>		// forward_as_tuple
+#include <utility>		// std::move, std::forward, std::swap, piecewise_construct
+
+#include "../Declaration/flat_tree.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename InputIterator>
+	_flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_flat_tree(InputIterator first, InputIterator last, const Compare &comp)
+		: values(first, last), comp(comp)
+	{
+		_sort_unique(values.begin());
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename InputIterator>
+	_flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_flat_tree(sorted_unique_t, InputIterator first, InputIterator last, const Compare &comp)
+		: values(first, last), comp(comp)
+	{
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename InputIterator>
+	void _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::insert(InputIterator first, InputIterator last)
+	{
+		const size_type n = size();
+		values.insert(values.end(), first, last);
+		_sort_unique(values.begin() + n);
+		_merge_tail(n);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename InputIterator>
+	void _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::insert(sorted_unique_t, InputIterator first, InputIterator last)
+	{
+		const size_type n = size();
+		values.insert(values.end(), first, last);
+		_merge_tail(n);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	typename _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::size_type _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::erase(const key_type &k)
+	{
+		pointer it = _find(k);
+		if (it == values.end())
+			return 0;
+		values.erase(it);
+		return 1;
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	void _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::swap(_flat_tree &t)
+	{
+		values.swap(t.values);
+		using std::swap;
+		swap(comp, t.comp);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// protected member functions
+	// first value whose key is not less than k. [base, base + len] holds the answer; every step
+	// halves len and moves base with a conditional move instead of a branch
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename K>
+	typename _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::pointer _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_lower_bound(const K &k) const
+	{
+		pointer base = values.begin();
+		size_type len = values.size();
+		if (len == 0)
+			return base;
+		while (len > 1)
+		{
+			const size_type half = len / 2;
+			base = comp(KeyOfValue()(base[half - 1]), k) ? base + half : base;
+			len -= half;
+		}
+		return base + comp(KeyOfValue()(*base), k);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename K>
+	typename _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::pointer _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_upper_bound(const K &k) const
+	{
+		pointer base = values.begin();
+		size_type len = values.size();
+		if (len == 0)
+			return base;
+		while (len > 1)
+		{
+			const size_type half = len / 2;
+			base = !comp(k, KeyOfValue()(base[half - 1])) ? base + half : base;
+			len -= half;
+		}
+		return base + !comp(k, KeyOfValue()(*base));
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename K>
+	typename _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::pointer _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_find(const K &k) const
+	{
+		pointer it = _lower_bound(k);
+		return it != values.end() && !comp(k, KeyOfValue()(*it)) ? it : values.end();
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename V>
+	std::pair<typename _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::iterator, bool> _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_insert_unique(V &&val)
+	{
+		pointer it = _lower_bound(KeyOfValue()(val));
+		if (it != values.end() && !comp(KeyOfValue()(val), KeyOfValue()(*it)))
+			return std::pair<iterator, bool>(it, false);
+		return std::pair<iterator, bool>(values.insert(it, std::forward<V>(val)), true);
+	}
+
+
+	// builds the value only when k is absent; one search finds both the key and the insert position
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	template <typename K, typename... Args>
+	std::pair<typename _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::iterator, bool> _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_try_emplace(K &&k, Args&&... args)
+	{
+		pointer it = _lower_bound(k);
+		if (it != values.end() && !comp(k, KeyOfValue()(*it)))
+			return std::pair<iterator, bool>(it, false);
+		it = values.emplace(it, std::piecewise_construct,
+			std::forward_as_tuple(std::forward<K>(k)), std::forward_as_tuple(std::forward<Args>(args)...));
+		return std::pair<iterator, bool>(it, true);
+	}
+
+
+	// one sort, then one pass that keeps one value of every run of equal keys (which one is unspecified)
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	void _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_sort_unique(pointer first)
+	{
+		pointer last = values.end();
+		if (last - first < 2)
+			return;
+		std::sort(first, last, [this](const value_type &a, const value_type &b) { return _less(a, b); });
+		pointer out = first;
+		for (pointer it = first + 1; it != last; ++it)
+			if (_less(*out, *it))
+			{
+				if (++out != it)
+					*out = std::move(*it);
+			}
+		values.erase(out + 1, last);
+	}
+
+
+	// [0, n) and [n, size()) are both sorted and unique. The tail values whose key is already
+	// present are dropped (the old value stays, as with map::insert), the rest are merged in from
+	// the back: every old value moves at most once
+	template <typename Key, typename Value, typename KeyOfValue, typename Compare, bool Mutable>
+	void _flat_tree<Key, Value, KeyOfValue, Compare, Mutable>::_merge_tail(size_type n)
+	{
+		pointer old_first = values.begin(), old_last = values.begin() + n;
+		pointer out = old_last, probe = old_first;
+		for (pointer it = old_last; it != values.end(); ++it)
+		{
+			// the tail is sorted, so the search for the next key starts where the last one ended
+			probe = std::lower_bound(probe, old_last, *it, [this](const value_type &a, const value_type &b) { return _less(a, b); });
+			if (probe != old_last && !_less(*it, *probe))
+				continue;
+			if (out != it)
+				*out = std::move(*it);
+			++out;
+		}
+		values.erase(out, values.end());
+
+		const size_type m = size() - n;
+		if (m == 0 || n == 0 || _less(old_last[-1], *old_last))
+			return;	// nothing new, or already in order
+		vector<Value> tail(std::make_move_iterator(values.begin() + n), std::make_move_iterator(values.end()));
+		pointer i = values.begin() + n, j = tail.end(), w = values.end();
+		while (j != tail.begin())
+		{
+			if (i != values.begin() && _less(*(j - 1), *(i - 1)))
+				*--w = std::move(*--i);
+			else
+				*--w = std::move(*--j);
+		}
+	}
+}
+
+#endif // INCLUDED_FLAT_TREE_IMPL_H
@@ -0,0 +1,494 @@
+#ifndef INCLUDED_INPLACE_VECTOR_IMPL_H
+#define INCLUDED_INPLACE_VECTOR_IMPL_H
+
+#include <utility>	// std::move, std::forward, std::swap
+#include <new>		// bad_alloc
+#include <cstring>	// memmove
+#include <cassert>	// assert
+
+#include "../Declaration/inplace_vector.h"
+#include "../Declaration/algorithm.h"
+#include "../Declaration/construct.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// _inplace_storage, element by element for T that is not trivially copyable
+	template <typename T, std::size_t N, bool Trivial>
+	_inplace_storage<T, N, Trivial>::_inplace_storage(const _inplace_storage &s)
+		: count(0)
+	{
+		MySTL::uninitialized_copy(s._data(), s._data() + s.count, _data());
+		count = s.count;
+	}
+
+
+	template <typename T, std::size_t N, bool Trivial>
+	_inplace_storage<T, N, Trivial>::_inplace_storage(_inplace_storage &&s) noexcept(std::is_nothrow_move_constructible<T>::value)
+		: count(0)
+	{
+		MySTL::uninitialized_move(s._data(), s._data() + s.count, _data());
+		count = s.count;
+		MySTL::destory(s._data(), s._data() + s.count);	// leaves the source empty, as vector does
+		s.count = 0;
+	}
+
+
+	template <typename T, std::size_t N, bool Trivial>
+	_inplace_storage<T, N, Trivial>& _inplace_storage<T, N, Trivial>::operator=(const _inplace_storage &rhs)
+	{
+		if (this == &rhs)
+			return *this;
+		// assign over the common prefix, then construct or destroy the rest
+		if (rhs.count > count)
+		{
+			MySTL::copy(rhs._data(), rhs._data() + count, _data());
+			MySTL::uninitialized_copy(rhs._data() + count, rhs._data() + rhs.count, _data() + count);
+		}
+		else
+		{
+			MySTL::copy(rhs._data(), rhs._data() + rhs.count, _data());
+			MySTL::destory(_data() + rhs.count, _data() + count);
+		}
+		count = rhs.count;
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N, bool Trivial>
+	_inplace_storage<T, N, Trivial>& _inplace_storage<T, N, Trivial>::operator=(_inplace_storage &&rhs)
+		noexcept(std::is_nothrow_move_assignable<T>::value && std::is_nothrow_move_constructible<T>::value)
+	{
+		if (this == &rhs)
+			return *this;
+		if (rhs.count > count)
+		{
+			MySTL::move(rhs._data(), rhs._data() + count, _data());
+			MySTL::uninitialized_move(rhs._data() + count, rhs._data() + rhs.count, _data() + count);
+		}
+		else
+		{
+			MySTL::move(rhs._data(), rhs._data() + rhs.count, _data());
+			MySTL::destory(_data() + rhs.count, _data() + count);
+		}
+		count = rhs.count;
+		MySTL::destory(rhs._data(), rhs._data() + rhs.count);
+		rhs.count = 0;
+		return *this;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, std::size_t N>
+	inplace_vector<T, N>::inplace_vector(const size_type n)
+	{
+		assign(n, value_type());
+	}
+
+
+	template <typename T, std::size_t N>
+	inplace_vector<T, N>::inplace_vector(const size_type n, const_reference val)
+	{
+		assign(n, val);
+	}
+
+
+	template <typename T, std::size_t N>
+	inplace_vector<T, N>::inplace_vector(std::initializer_list<T> il)
+	{
+		assign(il.begin(), il.end());
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename InputIterator>
+	inplace_vector<T, N>::inplace_vector(InputIterator first, InputIterator second)
+	{
+		assign(first, second);
+	}
+
+
+	template <typename T, std::size_t N>
+	inplace_vector<T, N>& inplace_vector<T, N>::operator=(std::initializer_list<T> il)
+	{
+		assign(il.begin(), il.end());
+		return *this;
+	}
+
+
+	// Elements Access
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::reference inplace_vector<T, N>::at(size_type n)
+	{
+		assert(n < size());
+		return begin()[n];
+	}
+
+
+	// Modifiers
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::assign(size_type n, const_reference val)
+	{
+		_assign(n, val, std::true_type());
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::assign(std::initializer_list<value_type> il)
+	{
+		assign(il.begin(), il.end());
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename InputIterator>
+	void inplace_vector<T, N>::assign(InputIterator first, InputIterator last)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		_assign(first, last, IS_INTEGER());
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::push_back(const_reference val)
+	{
+		_check_room(1);
+		unchecked_push_back(val);
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::push_back(value_type &&val)
+	{
+		_check_room(1);
+		unchecked_push_back(std::move(val));
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	typename inplace_vector<T, N>::reference inplace_vector<T, N>::emplace_back(Args&&... args)
+	{
+		_check_room(1);
+		return unchecked_emplace_back(std::forward<Args>(args)...);
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::pointer inplace_vector<T, N>::try_push_back(const_reference val)
+	{
+		return full() ? nullptr : &unchecked_emplace_back(val);
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::pointer inplace_vector<T, N>::try_push_back(value_type &&val)
+	{
+		return full() ? nullptr : &unchecked_emplace_back(std::move(val));
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	typename inplace_vector<T, N>::pointer inplace_vector<T, N>::try_emplace_back(Args&&... args)
+	{
+		return full() ? nullptr : &unchecked_emplace_back(std::forward<Args>(args)...);
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::unchecked_push_back(const_reference val)
+	{
+		assert(!full());
+		MySTL::construct(end(), val);
+		++this->count;
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::unchecked_push_back(value_type &&val)
+	{
+		assert(!full());
+		MySTL::construct(end(), std::move(val));
+		++this->count;
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	typename inplace_vector<T, N>::reference inplace_vector<T, N>::unchecked_emplace_back(Args&&... args)
+	{
+		assert(!full());
+		pointer p = end();
+		new (static_cast<void*>(p)) value_type(std::forward<Args>(args)...);
+		++this->count;
+		return *p;
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::pop_back()
+	{
+		if (!empty())
+		{
+			--this->count;
+			MySTL::destory(end());
+		}
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(iterator position, const_reference val)
+	{
+		return emplace(position, val);
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(iterator position, value_type &&val)
+	{
+		return emplace(position, std::move(val));
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(iterator position, size_type n, const_reference val)
+	{
+		return _insert(position, n, val, std::true_type());
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename InputIterator>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(iterator position, InputIterator first, InputIterator second)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		return _insert(position, first, second, IS_INTEGER());
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::insert(iterator position, std::initializer_list<T> il)
+	{
+		return insert(position, il.begin(), il.end());
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::emplace(iterator position, Args&&... args)
+	{
+		_check_room(1);
+		if (position == end())
+		{
+			unchecked_emplace_back(std::forward<Args>(args)...);
+			return position;
+		}
+		typedef typename std::is_trivially_copyable<value_type>::type TRIVIALLY_COPYABLE;
+		value_type tmp(std::forward<Args>(args)...);	// args may refer to an element that is about to move
+		if (_open_gap(position, 1, TRIVIALLY_COPYABLE()) == position)
+			MySTL::construct(position, std::move(tmp));
+		else
+			*position = std::move(tmp);
+		++this->count;
+		return position;
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::erase(iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::erase(iterator first, iterator second)
+	{
+		if (first == second)
+			return first;
+		iterator new_end = MySTL::move(second, end(), first);
+		MySTL::destory(new_end, end());
+		_set_size(static_cast<size_type>(new_end - begin()));
+		return first;
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::clear() noexcept
+	{
+		MySTL::destory(begin(), end());
+		this->count = 0;
+	}
+
+
+	// the common prefix is swapped in place, the longer one hands its tail over
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::swap(inplace_vector &x)
+	{
+		if (this == &x)
+			return;
+		inplace_vector &longer = size() < x.size() ? x : *this;
+		inplace_vector &shorter = size() < x.size() ? *this : x;
+		const size_type common = shorter.size();
+		for (size_type i = 0; i != common; ++i)
+		{
+			using std::swap;
+			swap(longer[i], shorter[i]);
+		}
+		MySTL::uninitialized_move(longer.begin() + common, longer.end(), shorter.end());
+		MySTL::destory(longer.begin() + common, longer.end());
+		const size_type n = longer.size();
+		longer._set_size(common);
+		shorter._set_size(n);
+	}
+
+
+	// capacity
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::resize(size_type n, const_reference val)
+	{
+		reserve(n);
+		if (n < size())
+			MySTL::destory(begin() + n, end());
+		else
+			MySTL::uninitialized_fill_n(end(), n - size(), val);	// nothing moves, val stays valid
+		_set_size(n);
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::reserve(size_type n)
+	{
+		if (n > N)
+			throw std::bad_alloc();
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::_check_room(size_type n) const
+	{
+		if (n > N - size())
+			throw std::bad_alloc();
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::_open_gap(iterator position, size_type n, std::true_type)
+	{
+		// trivially copyable: one memmove, the whole gap counts as raw memory
+		std::memmove(static_cast<void*>(position + n), static_cast<const void*>(position),
+			sizeof(value_type) * static_cast<size_type>(end() - position));
+		return position;
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::_open_gap(iterator position, size_type n, std::false_type)
+	{
+		// the elements that land beyond end() are move constructed, the others move assigned
+		iterator old_end = end();
+		if (static_cast<size_type>(old_end - position) > n)
+		{
+			MySTL::uninitialized_move(old_end - n, old_end, old_end);
+			MySTL::move_backward(position, old_end - n, old_end);
+			return position + n;
+		}
+		MySTL::uninitialized_move(position, old_end, position + n);
+		return old_end;
+	}
+
+
+	// assign auxiliary
+	template <typename T, std::size_t N>
+	template <typename InputIterator>
+	void inplace_vector<T, N>::_assign(InputIterator first, InputIterator last, std::false_type)
+	{
+		const size_type n = static_cast<size_type>(last - first);
+		reserve(n);
+		clear();
+		MySTL::uninitialized_copy(first, last, begin());
+		_set_size(n);
+	}
+
+
+	template <typename T, std::size_t N>
+	void inplace_vector<T, N>::_assign(size_type n, const_reference val, std::true_type)
+	{
+		reserve(n);
+		value_type val_copy = val;
+		clear();
+		MySTL::uninitialized_fill_n(begin(), n, val_copy);
+		_set_size(n);
+	}
+
+
+	// insert auxiliary: the room is checked up front, then the gap opens in place (the same steps as vector)
+	template <typename T, std::size_t N>
+	template <typename InputIterator>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::_insert(iterator position, InputIterator first, InputIterator second, std::false_type)
+	{
+		const size_type n = static_cast<size_type>(second - first);
+		if (n == 0)
+			return position;	// _open_gap(position, 0) would move every element onto itself
+		_check_room(n);
+		typedef typename std::is_trivially_copyable<value_type>::type TRIVIALLY_COPYABLE;
+		iterator raw = _open_gap(position, n, TRIVIALLY_COPYABLE());
+		InputIterator mid = first + (raw - position);
+		MySTL::copy(first, mid, position);				// insert, over the moved-from elements
+		MySTL::uninitialized_copy(mid, second, raw);	// insert, into raw memory
+		_set_size(size() + n);
+		return position;
+	}
+
+
+	template <typename T, std::size_t N>
+	typename inplace_vector<T, N>::iterator inplace_vector<T, N>::_insert(iterator position, size_type n, const_reference val, std::true_type)
+	{
+		if (n == 0)
+			return position;	// _open_gap(position, 0) would move every element onto itself
+		_check_room(n);
+		typedef typename std::is_trivially_copyable<value_type>::type TRIVIALLY_COPYABLE;
+		value_type val_copy = val;	// val may refer to an element that is about to move
+		iterator raw = _open_gap(position, n, TRIVIALLY_COPYABLE());
+		MySTL::fill(position, raw, val_copy);
+		MySTL::uninitialized_fill_n(raw, n - static_cast<size_type>(raw - position), val_copy);
+		_set_size(size() + n);
+		return position;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions overloads
+	template <typename T, std::size_t N>
+	bool operator==(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs)
+	{
+		return lhs.size() == rhs.size() && MySTL::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+
+	template <typename T, std::size_t N>
+	bool operator!=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+
+	template <typename T, std::size_t N>
+	bool operator<(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs)
+	{
+		return MySTL::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+
+	template <typename T, std::size_t N>
+	void swap(inplace_vector<T, N>& x, inplace_vector<T, N>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif // INCLUDED_INPLACE_VECTOR_IMPL_H
@@ -0,0 +1,266 @@
+#include <stdexcept>	// runtime_error
+#include <string>
+#include <utility>		// std::swap
+#include <cerrno>
+#include <cstring>		// strerror
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>		// open, posix_fadvise
+#include <unistd.h>		// ftruncate, close
+#include <sys/mman.h>	// mmap, mremap, msync, madvise
+#include <sys/stat.h>	// fstat
+#endif
+
+#include "../Declaration/mapped_file.h"
+
+namespace MySTL
+{
+	namespace
+	{
+		[[noreturn]] void _throw_error(const char *what)
+		{
+#ifdef _WIN32
+			throw std::runtime_error(std::string("mapped_file: ") + what + " failed, error " + std::to_string(GetLastError()));
+#else
+			throw std::runtime_error(std::string("mapped_file: ") + what + " failed: " + std::strerror(errno));
+#endif
+		}
+	}
+
+
+#ifdef _WIN32
+	mapped_file::mapped_file() : addr(nullptr), bytes(0), file(INVALID_HANDLE_VALUE), mapping(nullptr) {}
+
+	bool mapped_file::is_open() const { return file != INVALID_HANDLE_VALUE; }
+
+	void mapped_file::open(const char *path, bool truncate)
+	{
+		close();
+		HANDLE h = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+			truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (h == INVALID_HANDLE_VALUE)
+			_throw_error("CreateFile");
+		LARGE_INTEGER sz;
+		if (!GetFileSizeEx(h, &sz))
+		{
+			CloseHandle(h);
+			_throw_error("GetFileSizeEx");
+		}
+		file = h;
+		bytes = static_cast<size_type>(sz.QuadPart);
+		_map();
+	}
+
+	void mapped_file::close()
+	{
+		if (!is_open())
+			return;
+		_unmap();
+		CloseHandle(static_cast<HANDLE>(file));
+		file = INVALID_HANDLE_VALUE;
+		bytes = 0;
+	}
+
+	void mapped_file::resize(size_type n)
+	{
+		// a view pins the file size, it has to go first
+		_unmap();
+		LARGE_INTEGER pos;
+		pos.QuadPart = static_cast<LONGLONG>(n);
+		if (!SetFilePointerEx(static_cast<HANDLE>(file), pos, nullptr, FILE_BEGIN) || !SetEndOfFile(static_cast<HANDLE>(file)))
+			_throw_error("SetEndOfFile");
+		bytes = n;
+		_map();
+	}
+
+	void mapped_file::flush(bool async)
+	{
+		if (addr && !FlushViewOfFile(addr, 0))
+			_throw_error("FlushViewOfFile");
+		if (!async && is_open() && !FlushFileBuffers(static_cast<HANDLE>(file)))
+			_throw_error("FlushFileBuffers");
+	}
+
+	// Windows has no per-mapping access hints; willneed prefetches, dontneed trims the working set
+	void mapped_file::advise(advice a)
+	{
+		if (!addr)
+			return;
+#if _WIN32_WINNT >= 0x0602
+		if (a == willneed)
+		{
+			WIN32_MEMORY_RANGE_ENTRY range = { addr, bytes };
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+#endif
+		if (a == dontneed)
+		{
+			flush();
+			VirtualUnlock(addr, bytes);	// fails for unlocked pages, but removes them from the working set
+		}
+	}
+
+	void mapped_file::_map()
+	{
+		if (bytes == 0)	// an empty file can't be mapped
+			return;
+		mapping = CreateFileMappingA(static_cast<HANDLE>(file), nullptr, PAGE_READWRITE, 0, 0, nullptr);
+		if (!mapping)
+			_throw_error("CreateFileMapping");
+		addr = MapViewOfFile(static_cast<HANDLE>(mapping), FILE_MAP_ALL_ACCESS, 0, 0, 0);
+		if (!addr)
+		{
+			CloseHandle(static_cast<HANDLE>(mapping));
+			mapping = nullptr;
+			_throw_error("MapViewOfFile");
+		}
+	}
+
+	void mapped_file::_unmap()
+	{
+		if (addr)
+			UnmapViewOfFile(addr);
+		if (mapping)
+			CloseHandle(static_cast<HANDLE>(mapping));
+		addr = nullptr;
+		mapping = nullptr;
+	}
+
+	void mapped_file::swap(mapped_file &f) noexcept
+	{
+		std::swap(addr, f.addr);
+		std::swap(bytes, f.bytes);
+		std::swap(file, f.file);
+		std::swap(mapping, f.mapping);
+	}
+
+#else	// POSIX
+
+	mapped_file::mapped_file() : addr(nullptr), bytes(0), fd(-1) {}
+
+	bool mapped_file::is_open() const { return fd != -1; }
+
+	void mapped_file::open(const char *path, bool truncate)
+	{
+		close();
+		int f = ::open(path, O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+		if (f == -1)
+			_throw_error("open");
+		struct stat st;
+		if (fstat(f, &st) == -1)
+		{
+			::close(f);
+			_throw_error("fstat");
+		}
+		fd = f;
+		bytes = static_cast<size_type>(st.st_size);
+		_map();
+	}
+
+	void mapped_file::close()
+	{
+		if (!is_open())
+			return;
+		_unmap();
+		::close(fd);
+		fd = -1;
+		bytes = 0;
+	}
+
+	void mapped_file::resize(size_type n)
+	{
+		if (ftruncate(fd, static_cast<off_t>(n)) == -1)
+			_throw_error("ftruncate");
+#ifdef MREMAP_MAYMOVE
+		if (addr && n != 0)
+		{
+			// the kernel moves the page table entries, the cached pages stay where they are
+			void *p = mremap(addr, bytes, n, MREMAP_MAYMOVE);
+			if (p == MAP_FAILED)
+				_throw_error("mremap");
+			addr = p;
+			bytes = n;
+			return;
+		}
+#endif
+		_unmap();
+		bytes = n;
+		_map();
+	}
+
+	void mapped_file::flush(bool async)
+	{
+		if (addr && msync(addr, bytes, async ? MS_ASYNC : MS_SYNC) == -1)
+			_throw_error("msync");
+	}
+
+	void mapped_file::advise(advice a)
+	{
+		if (!addr)
+			return;
+		switch (a)
+		{
+		case normal:     madvise(addr, bytes, MADV_NORMAL); break;
+		case sequential: madvise(addr, bytes, MADV_SEQUENTIAL); break;
+		case random:     madvise(addr, bytes, MADV_RANDOM); break;
+		case willneed:   madvise(addr, bytes, MADV_WILLNEED); break;
+		case dontneed:
+			// unmapping the pages is not enough, the page cache keeps them: write back, then drop
+			flush();
+			madvise(addr, bytes, MADV_DONTNEED);
+#ifdef POSIX_FADV_DONTNEED
+			posix_fadvise(fd, 0, static_cast<off_t>(bytes), POSIX_FADV_DONTNEED);
+#endif
+			break;
+		}
+	}
+
+	void mapped_file::_map()
+	{
+		if (bytes == 0)	// mmap rejects a length of 0
+			return;
+		void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (p == MAP_FAILED)
+			_throw_error("mmap");
+		addr = p;
+	}
+
+	void mapped_file::_unmap()
+	{
+		if (addr)
+			munmap(addr, bytes);
+		addr = nullptr;
+	}
+
+	void mapped_file::swap(mapped_file &f) noexcept
+	{
+		std::swap(addr, f.addr);
+		std::swap(bytes, f.bytes);
+		std::swap(fd, f.fd);
+	}
+#endif
+
+
+	mapped_file::~mapped_file()
+	{
+		close();
+	}
+
+	mapped_file::mapped_file(mapped_file &&f) noexcept : mapped_file()
+	{
+		swap(f);
+	}
+
+	mapped_file& mapped_file::operator=(mapped_file &&f) noexcept
+	{
+		if (this != &f)
+		{
+			close();
+			swap(f);
+		}
+		return *this;
+	}
+}
@@ -0,0 +1,214 @@
+#ifndef INCLUDED_MMAP_VECTOR_IMPL_H
+#define INCLUDED_MMAP_VECTOR_IMPL_H
+
+#include <utility>		// std::move, std::forward, std::swap
+#include <stdexcept>	// out_of_range, runtime_error
+#include <cstring>		// memmove, memset
+#include <cassert>		// assert
+
+#include "../Declaration/mmap_vector.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, typename GrowthPolicy>
+	mmap_vector<T, GrowthPolicy>::mmap_vector(const char *path, open_mode mode)
+		: count(0)
+	{
+		open(path, mode);
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	mmap_vector<T, GrowthPolicy>::mmap_vector(mmap_vector &&v) noexcept
+		: file(std::move(v.file)), count(v.count)
+	{
+		v.count = 0;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	mmap_vector<T, GrowthPolicy>& mmap_vector<T, GrowthPolicy>::operator=(mmap_vector &&v) noexcept
+	{
+		if (this != &v)
+		{
+			_write_size();
+			file = std::move(v.file);
+			count = v.count;
+			v.count = 0;
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	mmap_vector<T, GrowthPolicy>::~mmap_vector()
+	{
+		_write_size();
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::open(const char *path, open_mode mode)
+	{
+		close();
+		file.open(path, mode == truncate);
+		if (file.size() == 0)
+		{
+			// a new file: write the header, no elements yet
+			_resize_file(0);
+			header *h = _header();
+			h->magic = header_magic;
+			h->element_size = sizeof(value_type);
+			h->size = 0;
+			return;
+		}
+		const header *h = _header();
+		if (file.size() < sizeof(header) || h->magic != header_magic || h->element_size != sizeof(value_type))
+		{
+			file.close();
+			throw std::runtime_error("mmap_vector: not an mmap_vector file of this element type");
+		}
+		if (h->size > capacity())
+		{
+			file.close();
+			throw std::runtime_error("mmap_vector: size in the header is larger than the file");
+		}
+		count = static_cast<size_type>(h->size);
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::close()
+	{
+		_write_size();
+		file.close();
+		count = 0;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::flush(bool async)
+	{
+		_write_size();
+		file.flush(async);
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	typename mmap_vector<T, GrowthPolicy>::reference mmap_vector<T, GrowthPolicy>::at(size_type n)
+	{
+		if (n >= count)
+			throw std::out_of_range("mmap_vector::at");
+		return _data()[n];
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::push_back(const_reference val)
+	{
+		emplace_back(val);
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	template <typename... Args>
+	void mmap_vector<T, GrowthPolicy>::emplace_back(Args&&... args)
+	{
+		value_type tmp(std::forward<Args>(args)...);	// args may point into the mapping, which may move
+		if (count == capacity())
+			reserve(GrowthPolicy::next_capacity(count, 1, sizeof(value_type)));
+		_data()[count++] = tmp;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	typename mmap_vector<T, GrowthPolicy>::iterator mmap_vector<T, GrowthPolicy>::insert(iterator position, const_reference val)
+	{
+		const size_type index = static_cast<size_type>(position - begin());
+		value_type tmp = val;
+		if (count == capacity())
+			reserve(GrowthPolicy::next_capacity(count, 1, sizeof(value_type)));
+		pointer p = _data() + index;
+		std::memmove(static_cast<void*>(p + 1), static_cast<const void*>(p), (count - index) * sizeof(value_type));
+		*p = tmp;
+		++count;
+		return p;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	typename mmap_vector<T, GrowthPolicy>::iterator mmap_vector<T, GrowthPolicy>::erase(iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	typename mmap_vector<T, GrowthPolicy>::iterator mmap_vector<T, GrowthPolicy>::erase(iterator first, iterator last)
+	{
+		std::memmove(static_cast<void*>(first), static_cast<const void*>(last), static_cast<size_type>(end() - last) * sizeof(value_type));
+		count -= static_cast<size_type>(last - first);
+		return first;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	typename mmap_vector<T, GrowthPolicy>::size_type mmap_vector<T, GrowthPolicy>::capacity() const
+	{
+		return file.size() > sizeof(header) ? (file.size() - sizeof(header)) / sizeof(value_type) : 0;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::resize(size_type n, const_reference val)
+	{
+		if (n > count)
+		{
+			value_type tmp = val;
+			reserve(n);
+			for (pointer p = _data() + count, last = _data() + n; p != last; ++p)
+				*p = tmp;
+		}
+		count = n;
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::reserve(size_type n)
+	{
+		if (n > capacity())
+			_resize_file(n);
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::shrink_to_fit()
+	{
+		if (count < capacity())
+			_resize_file(count);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::_resize_file(size_type n)
+	{
+		if (!file.is_open())
+			throw std::runtime_error("mmap_vector: no file");
+		// the new pages read as zeros, the file system allocates them on first write
+		file.resize(sizeof(header) + n * sizeof(value_type));
+	}
+
+
+	template <typename T, typename GrowthPolicy>
+	void mmap_vector<T, GrowthPolicy>::_write_size()
+	{
+		if (file.data())
+			_header()->size = count;
+	}
+}
+
+#endif // INCLUDED_MMAP_VECTOR_IMPL_H
@@ -0,0 +1,736 @@
+#ifndef INCLUDED_PERSISTENT_VECTOR_IMPL_H
+#define INCLUDED_PERSISTENT_VECTOR_IMPL_H
+
+#include <stdexcept>	// out_of_range
+#include <type_traits>	// is_integral
+#include <utility>		// std::move, std::forward
+
+#include "../Declaration/algorithm.h"
+#include "../Declaration/persistent_vector.h"
+#include "../Declaration/uninitialized_functions.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// _pvec_tree
+	template <typename T, typename Alloc>
+	_pvec_tree<T, Alloc>::_pvec_tree(const _pvec_tree &x)
+		: root(x.root), tail(x.tail), count(x.count), shift(x.shift)
+	{
+		if (root)
+			_retain(root);
+		if (tail)
+			_retain(tail);
+	}
+
+
+	template <typename T, typename Alloc>
+	_pvec_tree<T, Alloc>::_pvec_tree(_pvec_tree &&x) noexcept
+		: root(x.root), tail(x.tail), count(x.count), shift(x.shift)
+	{
+		x.root = x.tail = nullptr;
+		x.count = 0;
+		x.shift = bits;
+	}
+
+
+	template <typename T, typename Alloc>
+	_pvec_tree<T, Alloc>& _pvec_tree<T, Alloc>::operator=(const _pvec_tree &x)
+	{
+		_pvec_tree tmp(x);
+		swap(tmp);
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc>
+	_pvec_tree<T, Alloc>& _pvec_tree<T, Alloc>::operator=(_pvec_tree &&x) noexcept
+	{
+		if (this != &x)
+		{
+			clear();
+			swap(x);
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc>
+	const T& _pvec_tree<T, Alloc>::operator[](size_type i) const
+	{
+		size_type first;
+		_node *leaf = _leaf_for(i, first);
+		return _elements(leaf)[i - first];
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::_node* _pvec_tree<T, Alloc>::_leaf_for(size_type i, size_type &first) const
+	{
+		first = tail_offset();
+		if (i >= first)
+			return tail;
+		_node *n = root;
+		size_type rel = i;
+		for (unsigned s = shift; s != 0; s -= bits)
+			n = _children(n)[_child_index(n, s, rel)];
+		first = i - rel;
+		return n;
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename V>
+	void _pvec_tree<T, Alloc>::push_back(V &&val)
+	{
+		if (tail && tail->count != width)
+		{
+			tail = _unique(tail, 0);
+			data_allocator::construct(_elements(tail) + tail->count, std::forward<V>(val));
+			++tail->count;
+		}
+		else
+		{
+			_node *leaf = _allocate(leaf_slots);
+			try
+			{
+				data_allocator::construct(_elements(leaf), std::forward<V>(val));
+			}
+			catch (...)
+			{
+				_deallocate(leaf, 0);
+				throw;
+			}
+			leaf->count = 1;
+			if (tail)
+				_push_leaf(tail);
+			tail = leaf;
+		}
+		++count;
+	}
+
+
+	// copies the shared nodes on the path from the root to element i, then assigns it
+	template <typename T, typename Alloc>
+	template <typename V>
+	void _pvec_tree<T, Alloc>::set(size_type i, V &&val)
+	{
+		const size_type offset = tail_offset();
+		if (i >= offset)
+		{
+			tail = _unique(tail, 0);
+			_elements(tail)[i - offset] = std::forward<V>(val);
+			return;
+		}
+		_node **slot = &root;
+		for (unsigned s = shift; ; s -= bits)
+		{
+			*slot = _unique(*slot, s);
+			_node *n = *slot;
+			if (s == 0)
+			{
+				_elements(n)[i] = std::forward<V>(val);
+				return;
+			}
+			slot = _children(n) + _child_index(n, s, i);
+		}
+	}
+
+
+	// the tail of this tree goes into its trie as a leaf, the tries are merged along the seam and
+	// x's tail becomes the tail. Everything is built aside and this tree changes only at the end
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::append(const _pvec_tree &x)
+	{
+		if (x.count == 0)
+			return;
+		if (count == 0)
+		{
+			*this = x;
+			return;
+		}
+		if (!x.root)
+		{
+			// at most one leaf to copy
+			T *first = _elements(x.tail), *last = first + x.tail->count;
+			for (; first != last; ++first)
+				push_back(*first);
+			return;
+		}
+		_pvec_tree left(*this);
+		left._push_leaf(left.tail);
+		left.tail = nullptr;
+		_node *l = left.root, *r = x.root;
+		unsigned ls = left.shift, rs = x.shift;
+		left.root = nullptr;
+		_retain(r);
+		for (; ls < rs; ls += bits)
+			l = _new_path(l, bits);
+		for (; rs < ls; rs += bits)
+			r = _new_path(r, bits);
+
+		_node *out[2];
+		if (_merge(l, r, ls, out) == 2)
+		{
+			out[0] = _make_inner(out, 2, ls + bits);
+			ls += bits;
+		}
+		// drop the single child levels at the top
+		while (ls > bits && out[0]->count == 1)
+		{
+			_node *child = _children(out[0])[0];
+			_retain(child);
+			_release(out[0], ls);
+			out[0] = child;
+			ls -= bits;
+		}
+		_retain(x.tail);
+		const size_type n = count + x.count;
+		clear();
+		root = out[0];
+		tail = x.tail;
+		count = n;
+		shift = ls;
+	}
+
+
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::clear()
+	{
+		if (root)
+			_release(root, shift);
+		if (tail)
+			_release(tail, 0);
+		root = tail = nullptr;
+		count = 0;
+		shift = bits;
+	}
+
+
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::swap(_pvec_tree &x)
+	{
+		_node *tmp = root; root = x.root; x.root = tmp;
+		tmp = tail; tail = x.tail; x.tail = tmp;
+		size_type n = count; count = x.count; x.count = n;
+		unsigned s = shift; shift = x.shift; x.shift = s;
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::_node* _pvec_tree<T, Alloc>::_allocate(size_type slots)
+	{
+		_node *n = reinterpret_cast<_node*>(data_allocator::allocate(slots));
+		n->refs = 1;
+		n->sizes = nullptr;
+		n->count = 0;
+		return n;
+	}
+
+
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_deallocate(_node *n, unsigned s)
+	{
+		if (n->sizes)
+			data_allocator::deallocate(reinterpret_cast<T*>(n->sizes), table_slots);
+		data_allocator::deallocate(reinterpret_cast<T*>(n), s == 0 ? leaf_slots : inner_slots);
+	}
+
+
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_release(_node *n, unsigned s)
+	{
+		if (--n->refs != 0)
+			return;
+		if (s == 0)
+			data_allocator::destroy(_elements(n), _elements(n) + n->count);
+		else
+			_release_all(_children(n), n->count, s - bits);
+		_deallocate(n, s);
+	}
+
+
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_release_all(_node **first, size_type k, unsigned s)
+	{
+		for (size_type j = 0; j != k; ++j)
+			_release(first[j], s);
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::_node* _pvec_tree<T, Alloc>::_clone(_node *n, unsigned s)
+	{
+		_node *c;
+		if (s == 0)
+		{
+			c = _allocate(leaf_slots);
+			try
+			{
+				MySTL::uninitialized_copy(_elements(n), _elements(n) + n->count, _elements(c));
+			}
+			catch (...)
+			{
+				_deallocate(c, 0);
+				throw;
+			}
+		}
+		else
+		{
+			c = _allocate(inner_slots);
+			if (n->sizes)
+			{
+				c->sizes = reinterpret_cast<size_type*>(data_allocator::allocate(table_slots));
+				MySTL::copy(n->sizes, n->sizes + n->count, c->sizes);
+			}
+			_node **from = _children(n), **to = _children(c);
+			for (size_type j = 0; j != n->count; ++j)
+			{
+				to[j] = from[j];
+				_retain(to[j]);
+			}
+		}
+		c->count = n->count;
+		return c;
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::_node* _pvec_tree<T, Alloc>::_unique(_node *n, unsigned s)
+	{
+		if (n->refs == 1)
+			return n;
+		_node *c = _clone(n, s);
+		--n->refs;		// still held by the others
+		return c;
+	}
+
+
+	// a radix node: child i >> s. A relaxed one: i >> s is a lower bound, the size table says where
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::size_type _pvec_tree<T, Alloc>::_child_index(const _node *n, unsigned s, size_type &i)
+	{
+		size_type j = i >> s;
+		if (n->sizes)
+		{
+			while (n->sizes[j] <= i)
+				++j;
+			if (j != 0)
+				i -= n->sizes[j - 1];
+		}
+		else
+			i -= j << s;
+		return j;
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::size_type _pvec_tree<T, Alloc>::_size_of(_node *n, unsigned s)
+	{
+		size_type total = 0;
+		for (; s != 0; s -= bits)
+		{
+			if (n->sizes)
+				return total + n->sizes[n->count - 1];
+			total += (n->count - 1) << s;
+			n = _children(n)[n->count - 1];
+		}
+		return total + n->count;
+	}
+
+
+	template <typename T, typename Alloc>
+	bool _pvec_tree<T, Alloc>::_has_room(_node *n, unsigned s)
+	{
+		for (; s != bits; s -= bits)
+		{
+			if (n->count != width)
+				return true;
+			n = _children(n)[width - 1];
+		}
+		return n->count != width;
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::_node* _pvec_tree<T, Alloc>::_new_path(_node *leaf, unsigned s)
+	{
+		for (; s != 0; s -= bits)
+		{
+			_node *n = _allocate(inner_slots);
+			_children(n)[0] = leaf;
+			n->count = 1;
+			leaf = n;
+		}
+		return leaf;
+	}
+
+
+	// a full child at shift s - bits holds 1 << s elements
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_relax(_node *n, unsigned s)
+	{
+		_node **ch = _children(n);
+		bool radix = true;
+		for (size_type j = 0; radix && j + 1 < n->count; ++j)
+			radix = _size_of(ch[j], s - bits) == (size_type(1) << s);
+		if (radix)
+		{
+			if (n->sizes)
+				data_allocator::deallocate(reinterpret_cast<T*>(n->sizes), table_slots);
+			n->sizes = nullptr;
+			return;
+		}
+		if (!n->sizes)
+			n->sizes = reinterpret_cast<size_type*>(data_allocator::allocate(table_slots));
+		size_type total = 0;
+		for (size_type j = 0; j != n->count; ++j)
+		{
+			total += _size_of(ch[j], s - bits);
+			n->sizes[j] = total;
+		}
+	}
+
+
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_append_child(_node *n, unsigned s, _node *c)
+	{
+		const size_type k = n->count;
+		_children(n)[k] = c;
+		n->count = k + 1;
+		if (n->sizes)
+			n->sizes[k] = n->sizes[k - 1] + _size_of(c, s - bits);
+		else if (k != 0 && _size_of(_children(n)[k - 1], s - bits) != (size_type(1) << s))
+			_relax(n, s);
+	}
+
+
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::_node* _pvec_tree<T, Alloc>::_make_inner(_node **first, size_type k, unsigned s)
+	{
+		_node *n = _allocate(inner_slots);
+		MySTL::copy(first, first + k, _children(n));
+		n->count = k;
+		_relax(n, s);
+		return n;
+	}
+
+
+	// requires _has_room(n, s): the leaf goes under the last child if that has room, else next to it
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_push_tail(_node *&n, unsigned s, _node *leaf)
+	{
+		n = _unique(n, s);
+		_node *&last = _children(n)[n->count - 1];
+		if (s != bits && _has_room(last, s - bits))
+		{
+			const size_type added = leaf->count;
+			_push_tail(last, s - bits, leaf);
+			if (n->sizes)
+				n->sizes[n->count - 1] += added;
+		}
+		else
+			_append_child(n, s, _new_path(leaf, s - bits));
+	}
+
+
+	// a full tail, or any leaf before a concat; the trie grows a level when it has no room
+	template <typename T, typename Alloc>
+	void _pvec_tree<T, Alloc>::_push_leaf(_node *leaf)
+	{
+		if (!root)
+		{
+			root = _new_path(leaf, bits);
+			shift = bits;
+		}
+		else if (_has_room(root, shift))
+			_push_tail(root, shift, leaf);
+		else
+		{
+			_node *r = _allocate(inner_slots);
+			_children(r)[0] = root;
+			r->count = 1;
+			_append_child(r, shift + bits, _new_path(leaf, shift));
+			root = r;
+			shift += bits;
+		}
+	}
+
+
+	// l followed by r, both at shift s, as one or two nodes at shift s in out. Takes over the
+	// references to l and r, also when it throws
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::size_type _pvec_tree<T, Alloc>::_merge(_node *l, _node *r, unsigned s, _node **out)
+	{
+		if (s == 0)
+		{
+			if (l->count + r->count > width)
+			{
+				out[0] = l;
+				out[1] = r;
+				return 2;
+			}
+			_node *leaf = nullptr;
+			try
+			{
+				leaf = _allocate(leaf_slots);
+				T *mid = MySTL::uninitialized_copy(_elements(l), _elements(l) + l->count, _elements(leaf));
+				try
+				{
+					MySTL::uninitialized_copy(_elements(r), _elements(r) + r->count, mid);
+				}
+				catch (...)
+				{
+					data_allocator::destroy(_elements(leaf), mid);
+					throw;
+				}
+			}
+			catch (...)
+			{
+				if (leaf)
+					_deallocate(leaf, 0);
+				_release(l, 0);
+				_release(r, 0);
+				throw;
+			}
+			leaf->count = l->count + r->count;
+			_release(l, 0);
+			_release(r, 0);
+			out[0] = leaf;
+			return 1;
+		}
+
+		// the children of both but the two at the seam, which are merged one level down
+		_node *all[2 * width];
+		_node **lc = _children(l), **rc = _children(r);
+		size_type k = 0;
+		for (; k + 1 != l->count; ++k)
+		{
+			all[k] = lc[k];
+			_retain(all[k]);
+		}
+		_retain(lc[k]);
+		_retain(rc[0]);
+		try
+		{
+			k += _merge(lc[k], rc[0], s - bits, all + k);
+		}
+		catch (...)
+		{
+			_release_all(all, k, s - bits);
+			_release(l, s);
+			_release(r, s);
+			throw;
+		}
+		for (size_type j = 1; j != r->count; ++j)
+		{
+			all[k] = rc[j];
+			_retain(all[k++]);
+		}
+		_release(l, s);
+		_release(r, s);
+
+		k = _rebalance(all, k, s - bits);
+		if (k <= width)
+		{
+			out[0] = _make_inner(all, k, s);
+			return 1;
+		}
+		out[0] = _make_inner(all, width, s);
+		out[1] = _make_inner(all + width, k - width, s);
+		return 2;
+	}
+
+
+	// the concat plan of the RRB tree: while the k nodes at shift s are more than extras above the
+	// fewest that could hold their slots, the first node that is not full has its slots spread
+	// over the ones after it. Nodes the plan leaves as they are are kept, the others rebuilt.
+	// Takes over the references in all, also when it throws
+	template <typename T, typename Alloc>
+	typename _pvec_tree<T, Alloc>::size_type _pvec_tree<T, Alloc>::_rebalance(_node **all, size_type k, unsigned s)
+	{
+		size_type plan[2 * width], total = 0;
+		for (size_type j = 0; j != k; ++j)
+		{
+			plan[j] = all[j]->count;
+			total += plan[j];
+		}
+		const size_type optimal = (total + width - 1) / width;
+		size_type n = k;
+		if (n <= optimal + extras)
+			return k;
+		for (size_type i = 0; n > optimal + extras; --i)
+		{
+			while (plan[i] > width - extras / 2)
+				++i;
+			size_type remaining = plan[i];
+			do
+			{
+				const size_type merged = remaining + plan[i + 1] < width ? remaining + plan[i + 1] : width;
+				remaining = remaining + plan[i + 1] - merged;
+				plan[i++] = merged;
+			} while (remaining != 0);
+			for (size_type j = i; j + 1 < n; ++j)
+				plan[j] = plan[j + 1];
+			--n;
+		}
+
+		_node *result[2 * width];
+		size_type src = 0, offset = 0, p = 0;
+		_node *m = nullptr;
+		try
+		{
+			for (; p != n; ++p)
+			{
+				if (offset == 0 && all[src]->count == plan[p])
+				{
+					result[p] = all[src++];
+					continue;
+				}
+				m = _allocate(s == 0 ? leaf_slots : inner_slots);
+				while (m->count != plan[p])
+				{
+					_node *from = all[src];
+					const size_type take = plan[p] - m->count < from->count - offset ? plan[p] - m->count : from->count - offset;
+					if (s == 0)
+						MySTL::uninitialized_copy(_elements(from) + offset, _elements(from) + offset + take, _elements(m) + m->count);
+					else
+					{
+						_node **to = _children(m) + m->count, **first = _children(from) + offset;
+						for (size_type j = 0; j != take; ++j)
+						{
+							to[j] = first[j];
+							_retain(to[j]);
+						}
+					}
+					m->count += take;
+					offset += take;
+					if (offset == from->count)
+					{
+						_release(from, s);
+						++src;
+						offset = 0;
+					}
+				}
+				if (s != 0)
+					_relax(m, s);
+				result[p] = m;
+				m = nullptr;
+			}
+		}
+		catch (...)
+		{
+			if (m)
+				_release(m, s);
+			_release_all(result, p, s);
+			_release_all(all + src, k - src, s);
+			throw;
+		}
+		MySTL::copy(result, result + n, all);
+		return n;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// persistent_vector
+	template <typename T, typename Alloc>
+	persistent_vector<T, Alloc>::persistent_vector(size_type n, const_reference val)
+	{
+		for (; n != 0; --n)
+			tree.push_back(val);
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename InputIterator>
+	persistent_vector<T, Alloc>::persistent_vector(InputIterator first, InputIterator last)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		_range_initialize(first, last, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc>
+	persistent_vector<T, Alloc>::persistent_vector(std::initializer_list<value_type> il)
+	{
+		_range_initialize(il.begin(), il.end(), std::false_type());
+	}
+
+
+	template <typename T, typename Alloc>
+	typename persistent_vector<T, Alloc>::const_reference persistent_vector<T, Alloc>::at(size_type n) const
+	{
+		if (n >= size())
+			throw std::out_of_range("persistent_vector::at");
+		return tree[n];
+	}
+
+
+	template <typename T, typename Alloc>
+	persistent_vector<T, Alloc> persistent_vector<T, Alloc>::push_back(const_reference val) const
+	{
+		persistent_vector v(*this);
+		v.tree.push_back(val);
+		return v;
+	}
+
+
+	template <typename T, typename Alloc>
+	persistent_vector<T, Alloc> persistent_vector<T, Alloc>::set(size_type n, const_reference val) const
+	{
+		persistent_vector v(*this);
+		v.tree.set(n, val);
+		return v;
+	}
+
+
+	template <typename T, typename Alloc>
+	persistent_vector<T, Alloc> persistent_vector<T, Alloc>::concat(const persistent_vector &x) const
+	{
+		persistent_vector v(*this);
+		v.tree.append(x.tree);
+		return v;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// protected member functions
+	template <typename T, typename Alloc>
+	template <typename Integer>
+	void persistent_vector<T, Alloc>::_range_initialize(Integer n, Integer val, std::true_type)
+	{
+		for (size_type i = static_cast<size_type>(n); i != 0; --i)
+			tree.push_back(static_cast<value_type>(val));
+	}
+
+
+	template <typename T, typename Alloc>
+	template <typename InputIterator>
+	void persistent_vector<T, Alloc>::_range_initialize(InputIterator first, InputIterator last, std::false_type)
+	{
+		for (; first != last; ++first)
+			tree.push_back(*first);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// transient_vector
+	template <typename T, typename Alloc>
+	typename transient_vector<T, Alloc>::persistent_type transient_vector<T, Alloc>::persistent()
+	{
+		persistent_type v;
+		v.tree.swap(tree);
+		return v;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions
+	template <typename T, typename Alloc>
+	bool operator==(const persistent_vector<T, Alloc>& lhs, const persistent_vector<T, Alloc>& rhs)
+	{
+		return lhs.size() == rhs.size() && MySTL::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+}
+
+#endif // INCLUDED_PERSISTENT_VECTOR_IMPL_H
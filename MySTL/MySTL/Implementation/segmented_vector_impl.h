@@ -0,0 +1,212 @@
+#ifndef INCLUDED_SEGMENTED_VECTOR_IMPL_H
+#define INCLUDED_SEGMENTED_VECTOR_IMPL_H
+
+#include <utility>		// std::move, std::forward, std::swap
+#include <stdexcept>	// out_of_range
+#include <cassert>		// assert
+
+#include "../Declaration/segmented_vector.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	segmented_vector<T, FirstSegment, Alloc>::segmented_vector(const segmented_vector &v)
+		: count(0), segments(0)
+	{
+		_clear_table();
+		try
+		{
+			reserve(v.count);
+			for (const_iterator it = v.begin(); it != v.end(); ++it)
+				push_back(*it);
+		}
+		catch (...)
+		{
+			_free();
+			throw;
+		}
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	segmented_vector<T, FirstSegment, Alloc>::segmented_vector(segmented_vector &&v) noexcept
+		: count(0), segments(0)
+	{
+		_clear_table();
+		swap(v);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	segmented_vector<T, FirstSegment, Alloc>& segmented_vector<T, FirstSegment, Alloc>::operator=(const segmented_vector &rhs)
+	{
+		if (this != &rhs)
+		{
+			segmented_vector tmp(rhs);
+			swap(tmp);
+		}
+		return *this;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	segmented_vector<T, FirstSegment, Alloc>& segmented_vector<T, FirstSegment, Alloc>::operator=(segmented_vector &&rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			_free();
+			swap(rhs);
+		}
+		return *this;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	segmented_vector<T, FirstSegment, Alloc>::~segmented_vector()
+	{
+		_free();
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename segmented_vector<T, FirstSegment, Alloc>::reference segmented_vector<T, FirstSegment, Alloc>::at(size_type n)
+	{
+		if (n >= count)
+			throw std::out_of_range("segmented_vector::at");
+		return (*this)[n];
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::push_back(const_reference val)
+	{
+		emplace_back(val);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::push_back(value_type &&val)
+	{
+		emplace_back(std::move(val));
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	template <typename... Args>
+	typename segmented_vector<T, FirstSegment, Alloc>::reference segmented_vector<T, FirstSegment, Alloc>::emplace_back(Args&&... args)
+	{
+		// a new segment leaves the elements where they are, so args may refer to one of them
+		pointer p = _slot_for_back();
+		data_allocator::construct(p, std::forward<Args>(args)...);
+		++count;
+		return *p;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::pop_back()
+	{
+		assert(count > 0);
+		data_allocator::destroy(_address(count - 1));
+		--count;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::clear()
+	{
+		for (size_type k = 0; k < segments && _segment_start(k) < count; ++k)
+		{
+			const size_type used = count - _segment_start(k) < _segment_size(k) ? count - _segment_start(k) : _segment_size(k);
+			data_allocator::destroy(table[k], table[k] + used);
+		}
+		count = 0;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::swap(segmented_vector &v) noexcept
+	{
+		std::swap(count, v.count);
+		std::swap(segments, v.segments);
+		for (size_type k = 0; k < max_segments; ++k)
+			std::swap(table[k], v.table[k]);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::reserve(size_type n)
+	{
+		while (capacity() < n)
+			_add_segment();
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::shrink_to_fit()
+	{
+		// keep the segment of the last element, the ones after it are empty
+		const size_type keep = count == 0 ? 0 : _segment_of(count - 1) + 1;
+		while (segments > keep)
+		{
+			--segments;
+			data_allocator::deallocate(table[segments], _segment_size(segments));
+			table[segments] = nullptr;
+		}
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	typename segmented_vector<T, FirstSegment, Alloc>::pointer segmented_vector<T, FirstSegment, Alloc>::_slot_for_back()
+	{
+		if (count == capacity())
+			_add_segment();
+		return _address(count);
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::_add_segment()
+	{
+		if (segments == max_segments)
+			throw std::length_error("segmented_vector: out of segments");
+		table[segments] = data_allocator::allocate(_segment_size(segments));
+		++segments;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::_clear_table()
+	{
+		for (size_type k = 0; k < max_segments; ++k)
+			table[k] = nullptr;
+	}
+
+
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void segmented_vector<T, FirstSegment, Alloc>::_free()
+	{
+		clear();
+		for (size_type k = 0; k < segments; ++k)
+		{
+			data_allocator::deallocate(table[k], _segment_size(k));
+			table[k] = nullptr;
+		}
+		segments = 0;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions
+	template <typename T, std::size_t FirstSegment, typename Alloc>
+	void swap(segmented_vector<T, FirstSegment, Alloc>& x, segmented_vector<T, FirstSegment, Alloc>& y) noexcept
+	{
+		x.swap(y);
+	}
+}
+
+#endif // INCLUDED_SEGMENTED_VECTOR_IMPL_H
@@ -0,0 +1,504 @@
+#ifndef INCLUDED_SMALL_VECTOR_IMPL_H
+#define INCLUDED_SMALL_VECTOR_IMPL_H
+
+#include <utility>	// std::move
+#include <cassert>	// assert
+
+#include "../Declaration/small_vector.h"
+#include "../Declaration/algorithm.h"
+#include "../Declaration/construct.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>::small_vector(const small_vector &s)
+		: elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N)
+	{
+		assign(s.begin(), s.end());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>::small_vector(small_vector &&s) noexcept(std::is_nothrow_move_constructible<T>::value)
+		: elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N)
+	{
+		_steal(s);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>::small_vector(const size_type n)
+		: elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N)
+	{
+		assign(n, value_type());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>::small_vector(const size_type n, const_reference val)
+		: elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N)
+	{
+		assign(n, val);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>::small_vector(std::initializer_list<T> il)
+		: elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N)
+	{
+		assign(il.begin(), il.end());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	small_vector<T, N, Alloc, GrowthPolicy>::small_vector(InputIterator first, InputIterator second)
+		: elements_start(_inline_data()), first_free(_inline_data()), end_of_storage(_inline_data() + N)
+	{
+		assign(first, second);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>& small_vector<T, N, Alloc, GrowthPolicy>::operator=(const small_vector &rhs)
+	{
+		if (this != &rhs)
+			assign(rhs.begin(), rhs.end());
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>& small_vector<T, N, Alloc, GrowthPolicy>::operator=(small_vector &&rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+	{
+		if (this != &rhs)
+		{
+			_free();
+			_reset_inline();
+			_steal(rhs);
+		}
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>& small_vector<T, N, Alloc, GrowthPolicy>::operator=(std::initializer_list<T> il)
+	{
+		assign(il.begin(), il.end());
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	small_vector<T, N, Alloc, GrowthPolicy>::~small_vector()
+	{
+		_free();
+	}
+
+
+	// Elements Access
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::reference small_vector<T, N, Alloc, GrowthPolicy>::at(size_type n)
+	{
+		assert(n < size());
+		return *(elements_start + n);
+	}
+
+
+	// Modifiers
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::assign(size_type n, const_reference val)
+	{
+		_assign(n, val, std::true_type());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::assign(std::initializer_list<value_type> il)
+	{
+		assign(il.begin(), il.end());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	void small_vector<T, N, Alloc, GrowthPolicy>::assign(InputIterator first, InputIterator last)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		_assign(first, last, IS_INTEGER());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::push_back(const_reference val)
+	{
+		if (first_free == end_of_storage)
+		{
+			value_type val_copy = val;	// val may be one of our elements
+			_grow(1);
+			MySTL::construct(first_free, std::move(val_copy));
+		}
+		else
+			data_allocator::construct(first_free, val);
+		++first_free;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::push_back(value_type &&val)
+	{
+		if (first_free == end_of_storage)
+		{
+			value_type val_copy = std::move(val);
+			_grow(1);
+			MySTL::construct(first_free, std::move(val_copy));
+		}
+		else
+			MySTL::construct(first_free, std::move(val));
+		++first_free;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename... Args>
+	void small_vector<T, N, Alloc, GrowthPolicy>::emplace_back(Args&&... args)
+	{
+		if (first_free == end_of_storage)
+		{
+			value_type tmp(std::forward<Args>(args)...);	// args may refer to our elements
+			_grow(1);
+			MySTL::construct(first_free, std::move(tmp));
+		}
+		else
+			data_allocator::construct(first_free, std::forward<Args>(args)...);
+		++first_free;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::pop_back()
+	{
+		if (!empty())
+			data_allocator::destroy(--first_free);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::insert(iterator position, const_reference val)
+	{
+		return insert(position, 1, val);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::insert(iterator position, size_type n, const_reference val)
+	{
+		return _insert(position, n, val, std::true_type());
+	}
+
+
+	// the new element is built before anything moves, args may refer to an element
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename... Args>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::emplace(iterator position, Args&&... args)
+	{
+		if (position == first_free)
+		{
+			emplace_back(std::forward<Args>(args)...);
+			return first_free - 1;
+		}
+		const difference_type offset = position - elements_start;
+		value_type tmp(std::forward<Args>(args)...);
+		_grow(1);
+		position = elements_start + offset;
+
+		iterator old_end = first_free;
+		MySTL::construct(old_end, std::move(*(old_end - 1)));
+		++first_free;
+		MySTL::move_backward(position, old_end - 1, old_end);
+		*position = std::move(tmp);
+		return position;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::insert(iterator position, InputIterator first, InputIterator second)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		return _insert(position, first, second, IS_INTEGER());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::insert(iterator position, std::initializer_list<T> il)
+	{
+		return insert(position, il.begin(), il.end());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::erase(iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::erase(iterator first, iterator second)
+	{
+		if (first == second)
+			return first;
+		iterator new_end = MySTL::move(second, first_free, first);
+		data_allocator::destroy(new_end, first_free);
+		first_free = new_end;
+		return first;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::clear() noexcept
+	{
+		data_allocator::destroy(elements_start, first_free);
+		first_free = elements_start;
+	}
+
+
+	// heap / heap swaps the pointers, any other combination moves the inline elements across
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::swap(small_vector &x)
+	{
+		if (this == &x)
+			return;
+		if (!is_inline() && !x.is_inline())
+		{
+			using std::swap;
+			swap(elements_start, x.elements_start);
+			swap(first_free, x.first_free);
+			swap(end_of_storage, x.end_of_storage);
+			return;
+		}
+		small_vector tmp(std::move(x));
+		x = std::move(*this);
+		*this = std::move(tmp);
+	}
+
+
+	// capacity
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::resize(size_type n, const_reference val)
+	{
+		if (n < size())
+		{
+			data_allocator::destroy(elements_start + n, first_free);
+			first_free = elements_start + n;
+		}
+		else if (n > size())
+		{
+			value_type val_copy = val;
+			reserve(n);
+			first_free = MySTL::uninitialized_fill_n(first_free, n - size(), val_copy);
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::reserve(size_type n)
+	{
+		if (n > capacity())
+			_relocate(n);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::shrink_to_fit()
+	{
+		if (is_inline() || size() == capacity())
+			return;
+		if (size() > N)
+		{
+			_relocate(size());
+			return;
+		}
+		// back into the inline buffer; at most N elements, too few to be worth streaming
+		iterator old_start = elements_start, old_finish = first_free;
+		size_type old_capacity = capacity();
+		first_free = MySTL::uninitialized_move_if_noexcept(old_start, old_finish, _inline_data(), temporal_copy_tag());
+		elements_start = _inline_data();
+		end_of_storage = _inline_data() + N;
+		data_allocator::destroy(old_start, old_finish);
+		data_allocator::deallocate(old_start, old_capacity);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::_free()
+	{
+		data_allocator::destroy(elements_start, first_free);
+		if (!is_inline())
+			data_allocator::deallocate(elements_start, capacity());
+	}
+
+
+	// heap storage changes hands, inline elements are moved one by one (a plain memcpy for PODs)
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::_steal(small_vector &rhs)
+	{
+		if (rhs.is_inline())
+		{
+			first_free = MySTL::uninitialized_move(rhs.elements_start, rhs.first_free, first_free, temporal_copy_tag());
+			rhs.clear();
+		}
+		else
+		{
+			elements_start = rhs.elements_start;
+			first_free = rhs.first_free;
+			end_of_storage = rhs.end_of_storage;
+			rhs._reset_inline();
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::_relocate(size_type newcapacity)
+	{
+		iterator newdata = data_allocator::allocate(newcapacity);
+		iterator dest;
+		try
+		{
+			dest = MySTL::uninitialized_move_if_noexcept(elements_start, first_free, newdata);
+		}
+		catch (...)
+		{
+			data_allocator::deallocate(newdata, newcapacity);
+			throw;
+		}
+		_free();
+		elements_start = newdata;
+		first_free = dest;
+		end_of_storage = newdata + newcapacity;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::_grow(size_type n)
+	{
+		if (n > static_cast<size_type>(end_of_storage - first_free))
+			_relocate(GrowthPolicy::next_capacity(size(), n, sizeof(value_type)));
+	}
+
+
+	// assign auxiliary
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	void small_vector<T, N, Alloc, GrowthPolicy>::_assign(InputIterator first, InputIterator last, std::false_type)
+	{
+		clear();
+		reserve(static_cast<size_type>(last - first));
+		first_free = MySTL::uninitialized_copy(first, last, elements_start);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void small_vector<T, N, Alloc, GrowthPolicy>::_assign(size_type n, const_reference val, std::true_type)
+	{
+		value_type val_copy = val;
+		clear();
+		reserve(n);
+		first_free = MySTL::uninitialized_fill_n(elements_start, n, val_copy);
+	}
+
+
+	// insert auxiliary: make room first, then open the gap in place (the same steps as vector)
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::_insert(iterator position, InputIterator first, InputIterator second, std::false_type)
+	{
+		const difference_type offset = position - elements_start;
+		const difference_type n = second - first;
+		if (n == 0)
+			return position;	// the moves below would move every element after position onto itself
+		_grow(static_cast<size_type>(n));
+		position = elements_start + offset;
+
+		iterator old_end = first_free;
+		const difference_type elems_after = old_end - position;
+		if (elems_after > n)
+		{
+			first_free = MySTL::uninitialized_move(old_end - n, old_end, old_end);
+			MySTL::move_backward(position, old_end - n, old_end);
+			MySTL::copy(first, second, position);
+		}
+		else
+		{
+			InputIterator mid = first + elems_after;
+			first_free = MySTL::uninitialized_copy(mid, second, old_end);
+			first_free = MySTL::uninitialized_move(position, old_end, first_free);
+			MySTL::copy(first, mid, position);
+		}
+		return position;
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	typename small_vector<T, N, Alloc, GrowthPolicy>::iterator small_vector<T, N, Alloc, GrowthPolicy>::_insert(iterator position, size_type n, const_reference val, std::true_type)
+	{
+		if (n == 0)
+			return position;	// the moves below would move every element after position onto itself
+		const difference_type offset = position - elements_start;
+		value_type val_copy = val;	// val may refer to an element that is about to move
+		_grow(n);
+		position = elements_start + offset;
+
+		iterator old_end = first_free;
+		const size_type elems_after = static_cast<size_type>(old_end - position);
+		if (elems_after > n)
+		{
+			first_free = MySTL::uninitialized_move(old_end - n, old_end, old_end);
+			MySTL::move_backward(position, old_end - n, old_end);
+			MySTL::fill(position, position + n, val_copy);
+		}
+		else
+		{
+			first_free = MySTL::uninitialized_fill_n(old_end, n - elems_after, val_copy);
+			first_free = MySTL::uninitialized_move(position, old_end, first_free);
+			MySTL::fill(position, old_end, val_copy);
+		}
+		return position;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions overloads
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	bool operator==(const small_vector<T, N, Alloc, GrowthPolicy>& lhs, const small_vector<T, N, Alloc, GrowthPolicy>& rhs)
+	{
+		return lhs.size() == rhs.size() && MySTL::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	bool operator!=(const small_vector<T, N, Alloc, GrowthPolicy>& lhs, const small_vector<T, N, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	bool operator<(const small_vector<T, N, Alloc, GrowthPolicy>& lhs, const small_vector<T, N, Alloc, GrowthPolicy>& rhs)
+	{
+		return MySTL::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+
+	template <typename T, std::size_t N, typename Alloc, typename GrowthPolicy>
+	void swap(small_vector<T, N, Alloc, GrowthPolicy>& x, small_vector<T, N, Alloc, GrowthPolicy>& y)
+	{
+		x.swap(y);
+	}
+}
+#endif
@@ -0,0 +1,312 @@
+#ifndef INCLUDED_SOA_VECTOR_IMPL_H
+#define INCLUDED_SOA_VECTOR_IMPL_H
+
+#include <utility>	// std::move, std::forward
+#include <cassert>	// assert
+
+#include "../Declaration/soa_vector.h"
+#include "../Declaration/algorithm.h"
+#include "../Declaration/uninitialized_functions.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename... Ts>
+	soa_vector<Ts...>::soa_vector(const soa_vector &v)
+		: count(0), cap(0)
+	{
+		reserve(v.count);
+		try
+		{
+			_copy_columns(v, column_index<0>());
+		}
+		catch (...)
+		{
+			_free();	// no rows yet, only the arrays go
+			throw;
+		}
+		count = v.count;
+	}
+
+
+	template <typename... Ts>
+	soa_vector<Ts...>::soa_vector(soa_vector &&v) noexcept
+		: data_columns(v.data_columns), count(v.count), cap(v.cap)
+	{
+		v.data_columns = std::tuple<Ts*...>();
+		v.count = v.cap = 0;
+	}
+
+
+	template <typename... Ts>
+	soa_vector<Ts...>& soa_vector<Ts...>::operator=(const soa_vector &rhs)
+	{
+		if (this != &rhs)
+		{
+			soa_vector tmp(rhs);
+			swap(tmp);
+		}
+		return *this;
+	}
+
+
+	template <typename... Ts>
+	soa_vector<Ts...>& soa_vector<Ts...>::operator=(soa_vector &&rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			_free();
+			data_columns = rhs.data_columns;
+			count = rhs.count;
+			cap = rhs.cap;
+			rhs.data_columns = std::tuple<Ts*...>();
+			rhs.count = rhs.cap = 0;
+		}
+		return *this;
+	}
+
+
+	template <typename... Ts>
+	soa_vector<Ts...>::~soa_vector()
+	{
+		_free();
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::push_back(const value_type &val)
+	{
+		_push_back(val, _make_index_sequence<sizeof...(Ts)>());
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::push_back(value_type &&val)
+	{
+		_push_back(std::move(val), _make_index_sequence<sizeof...(Ts)>());
+	}
+
+
+	template <typename... Ts>
+	template <typename... Args>
+	void soa_vector<Ts...>::emplace_back(Args&&... args)
+	{
+		static_assert(sizeof...(Args) == sizeof...(Ts), "emplace_back takes one argument per column");
+		if (count == cap)
+			reserve(double_growth::next_capacity(count, 1, 0));
+		_construct_row(count, column_index<0>(), std::forward<Args>(args)...);
+		++count;
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::pop_back()
+	{
+		assert(count > 0);
+		_destroy(count - 1, count, _make_index_sequence<sizeof...(Ts)>());
+		--count;
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::erase(size_type pos)
+	{
+		erase(pos, pos + 1);
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::erase(size_type first, size_type last)
+	{
+		assert(first <= last && last <= count);
+		if (first == last)
+			return;
+		_erase(first, last, _make_index_sequence<sizeof...(Ts)>());
+		count -= last - first;
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::clear()
+	{
+		_destroy(0, count, _make_index_sequence<sizeof...(Ts)>());
+		count = 0;
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::swap(soa_vector &v) noexcept
+	{
+		std::swap(data_columns, v.data_columns);
+		std::swap(count, v.count);
+		std::swap(cap, v.cap);
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::reserve(size_type n)
+	{
+		if (n <= cap)
+			return;
+		std::tuple<Ts*...> fresh;
+		_relocate_columns(fresh, n, column_index<0>());
+		// every column made it across, release the old arrays
+		_destroy(0, count, _make_index_sequence<sizeof...(Ts)>());
+		_deallocate(_make_index_sequence<sizeof...(Ts)>());
+		data_columns = fresh;
+		cap = n;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename... Ts>
+	template <std::size_t I, typename Arg, typename... Args>
+	void soa_vector<Ts...>::_construct_row(size_type n, column_index<I>, Arg &&arg, Args&&... args)
+	{
+		typedef column_type<I> T;
+		T *p = std::get<I>(data_columns) + n;
+		allocator<T>::construct(p, std::forward<Arg>(arg));
+		try
+		{
+			_construct_row(n, column_index<I + 1>(), std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			allocator<T>::destroy(p);
+			throw;
+		}
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t I>
+	void soa_vector<Ts...>::_relocate_columns(std::tuple<Ts*...> &fresh, size_type n, column_index<I>)
+	{
+		typedef column_type<I> T;
+		T *old = std::get<I>(data_columns);
+		T *p = allocator<T>::allocate(n);
+		try
+		{
+			MySTL::uninitialized_move_if_noexcept(old, old + count, p);
+		}
+		catch (...)
+		{
+			allocator<T>::deallocate(p, n);
+			throw;
+		}
+		try
+		{
+			_relocate_columns(fresh, n, column_index<I + 1>());
+		}
+		catch (...)
+		{
+			allocator<T>::destroy(p, p + count);
+			allocator<T>::deallocate(p, n);
+			throw;
+		}
+		std::get<I>(fresh) = p;
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t I>
+	void soa_vector<Ts...>::_copy_columns(const soa_vector &v, column_index<I>)
+	{
+		typedef column_type<I> T;
+		const T *src = std::get<I>(v.data_columns);
+		T *dst = std::get<I>(data_columns);
+		MySTL::uninitialized_copy(src, src + v.count, dst);
+		try
+		{
+			_copy_columns(v, column_index<I + 1>());
+		}
+		catch (...)
+		{
+			allocator<T>::destroy(dst, dst + v.count);
+			throw;
+		}
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t I>
+	void soa_vector<Ts...>::_erase_column(size_type first, size_type last)
+	{
+		typedef column_type<I> T;
+		T *p = std::get<I>(data_columns);
+		T *new_end = MySTL::move(p + last, p + count, p + first);	// one memmove for trivial columns
+		allocator<T>::destroy(new_end, p + count);
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t I>
+	void soa_vector<Ts...>::_destroy_column(size_type first, size_type last)
+	{
+		typedef column_type<I> T;
+		T *p = std::get<I>(data_columns);
+		allocator<T>::destroy(p + first, p + last);
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t I>
+	void soa_vector<Ts...>::_deallocate_column()
+	{
+		typedef column_type<I> T;
+		allocator<T>::deallocate(std::get<I>(data_columns), cap);
+	}
+
+
+	// the int array only gives the pack expansion a place to happen, in column order
+	template <typename... Ts>
+	template <std::size_t... Is>
+	void soa_vector<Ts...>::_erase(size_type first, size_type last, _index_sequence<Is...>)
+	{
+		int expand[] = { 0, (_erase_column<Is>(first, last), 0)... };
+		(void)expand;
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is>
+	void soa_vector<Ts...>::_destroy(size_type first, size_type last, _index_sequence<Is...>)
+	{
+		int expand[] = { 0, (_destroy_column<Is>(first, last), 0)... };
+		(void)expand;
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is>
+	void soa_vector<Ts...>::_deallocate(_index_sequence<Is...>)
+	{
+		int expand[] = { 0, (_deallocate_column<Is>(), 0)... };
+		(void)expand;
+	}
+
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::_free()
+	{
+		if (cap == 0)
+			return;
+		_destroy(0, count, _make_index_sequence<sizeof...(Ts)>());
+		_deallocate(_make_index_sequence<sizeof...(Ts)>());
+		data_columns = std::tuple<Ts*...>();
+		count = cap = 0;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions
+	template <typename... Ts>
+	void swap(soa_vector<Ts...>& x, soa_vector<Ts...>& y) noexcept
+	{
+		x.swap(y);
+	}
+}
+
+#endif // INCLUDED_SOA_VECTOR_IMPL_H
@@ -32,7 +32,7 @@ namespace MySTL
 	string::size_type string::_strlen(const char* s)
 	{
 		size_type len = 0;
-		for (auto p = s; p != nullptr; ++p, ++len);
+		for (auto p = s; *p != '\0'; ++p, ++len);
 		return len;
 	}
 
@@ -41,8 +41,7 @@ namespace MySTL
 	{
 		if (elements_start)
 		{
-			for (auto p = first_free; p != elements_start;)
-				alloc.destroy(--p);
+			alloc.destroy(elements_start, first_free);	// no-op, char is trivially destructible
 			alloc.deallocate(elements_start, end_of_storage - elements_start);
 		}
 	}
@@ -52,7 +51,7 @@ namespace MySTL
 	void string::alloc_n_copy(const_iterator first, const_iterator second)
 	{
 		auto start = alloc.allocate(second - first);
-		auto finish = std::uninitialized_copy(first, second, elements_start);
+		auto finish = MySTL::uninitialized_copy(first, second, start);
 
 		elements_start = start;
 		first_free = end_of_storage = finish;
@@ -61,7 +60,7 @@ namespace MySTL
 	void string::alloc_n_fill_n(const char &c, size_type n)
 	{
 		auto start = alloc.allocate(n);
-		auto finish = std::uninitialized_fill_n(elements_start, n, c);
+		auto finish = std::uninitialized_fill_n(start, n, c);
 
 		elements_start = start;
 		first_free = end_of_storage = finish;
@@ -128,7 +127,7 @@ namespace MySTL
 		alloc_n_copy(il.begin(), il.end());
 	}
 
-	string::string(string &&str) /*noexcept*/
+	string::string(string &&str) noexcept
 		: elements_start(str.elements_start), first_free(str.first_free), end_of_storage(str.end_of_storage)
 	{
 		str.elements_start = str.first_free = str.end_of_storage = nullptr;
@@ -199,8 +198,8 @@ namespace MySTL
 	{
 		if (n < size())
 		{
-			for (; first_free > elements_start + n;)
-				alloc.destroy(--first_free);
+			alloc.destroy(elements_start + n, first_free);
+			first_free = elements_start + n;
 		}
 		else if (n >= size() && n < capacity())
 		{
@@ -211,7 +210,7 @@ namespace MySTL
 		{
 			auto len_insert = n - size();
 			iterator start = alloc.allocate(n);
-			iterator finish = std::uninitialized_copy(std::make_move_iterator(elements_start), std::make_move_iterator(first_free), start);
+			iterator finish = MySTL::uninitialized_copy(elements_start, first_free, start);
 			finish = std::uninitialized_fill_n(finish, len_insert, c);
 			_free();
 			elements_start = start;
@@ -219,12 +218,18 @@ namespace MySTL
 		}
 	}
 
+	void string::resize_default_init(size_type n)
+	{
+		reserve(n);
+		first_free = elements_start + n;	// char needs no construction, the new bytes stay as they were
+	}
+
 	void string::reserve(size_type n)
 	{
 		if (n <= capacity())
 			return;
 		iterator start = alloc.allocate(n);
-		iterator finish = std::uninitialized_copy(std::make_move_iterator(elements_start), std::make_move_iterator(first_free), start);
+		iterator finish = MySTL::uninitialized_copy(elements_start, first_free, start);
 		_free();
 		elements_start = start;
 		first_free = finish;
@@ -235,8 +240,8 @@ namespace MySTL
 	{
 		if (elements_start)
 		{
-			while (first_free != elements_start)
-				alloc.destroy(--first_free);
+			alloc.destroy(elements_start, first_free);
+			first_free = elements_start;
 		}
 	}
 
@@ -543,15 +548,14 @@ namespace MySTL
 
 	string::iterator string::erase(const_iterator first, const_iterator last)
 	{
-		iterator p = begin() + static_cast<size_type>(last - begin());
-		std::uninitialized_copy(p, first_free, first);
+		iterator dest = const_cast<iterator>(first);
+		MySTL::copy(const_cast<iterator>(last), first_free, dest);	// shift the tail left
 
-		difference_type len = last - first;
-		const_iterator stop = first_free - len;
-		for (; first_free != stop; --first_free)
-			alloc.destroy(first_free);
+		iterator new_end = first_free - (last - first);
+		alloc.destroy(new_end, first_free);
+		first_free = new_end;
 
-		return const_cast<iterator>(first);
+		return dest;
 	}
 
 
@@ -1204,4 +1208,18 @@ namespace MySTL
 	}
 	
 	//std::istream& getline(std::istream&& is, string& str){}
+
+
+	// the range members are defined in this file, so they are instantiated here for the iterators
+	// of a string and of a character array
+	template string::string(char *first, char *last);
+	template string::string(const char *first, const char *last);
+	template string& string::append(char *first, char *last);
+	template string& string::append(const char *first, const char *last);
+	template string& string::assign(char *first, char *last);
+	template string& string::assign(const char *first, const char *last);
+	template string::iterator string::insert(iterator p, char *first, char *last);
+	template string::iterator string::insert(iterator p, const char *first, const char *last);
+	template string& string::replace(const_iterator i1, const_iterator i2, char *first, char *last);
+	template string& string::replace(const_iterator i1, const_iterator i2, const char *first, const char *last);
 }
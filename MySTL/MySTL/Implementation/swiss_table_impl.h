@@ -0,0 +1,342 @@
+#ifndef INCLUDED_SWISS_TABLE_IMPL_H
+#define INCLUDED_SWISS_TABLE_IMPL_H
+
+#include <cstring>		// memset
+#include <tuple>		// forward_as_tuple
+#include <utility>		// std::move, std::forward, std::swap, piecewise_construct
+
+#include "../Declaration/swiss_table.h"
+
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	_swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_swiss_table(size_type bucket_count, const Hash &hf, const KeyEqual &eq)
+		: ctrl(_swiss_empty_group()), slots(nullptr), cap(0), elements(0), growth_left(0), hash_fn(hf), eq(eq)
+	{
+		if (bucket_count != 0)
+			rehash(bucket_count);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	template <typename InputIterator>
+	_swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_swiss_table(InputIterator first, InputIterator last, size_type bucket_count, const Hash &hf, const KeyEqual &eq)
+		: _swiss_table(bucket_count, hf, eq)
+	{
+		insert(first, last);
+	}
+
+
+	// the values are known to be unique: no lookups, each goes to the first free slot of its probe
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	_swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_swiss_table(const _swiss_table &t)
+		: _swiss_table(0, t.hash_fn, t.eq)
+	{
+		reserve(t.elements);
+		for (const_iterator it = t.begin(); it != t.end(); ++it)
+		{
+			const std::size_t h = _hash(KeyOfValue()(*it));
+			const size_type i = _find_first_non_full(h);
+			allocator<Value>::construct(slots + i, *it);
+			_set_ctrl(i, static_cast<signed char>(h & 0x7F));
+			--growth_left;
+			++elements;
+		}
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	_swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_swiss_table(_swiss_table &&t)
+		: ctrl(t.ctrl), slots(t.slots), cap(t.cap), elements(t.elements), growth_left(t.growth_left), hash_fn(t.hash_fn), eq(t.eq)
+	{
+		t.ctrl = _swiss_empty_group();
+		t.slots = nullptr;
+		t.cap = t.elements = t.growth_left = 0;
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::reserve(size_type n)
+	{
+		if (n > elements + growth_left)
+			_resize(_capacity_for(n));
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::rehash(size_type n)
+	{
+		if (n == 0 && elements == 0)
+		{
+			_deallocate();
+			ctrl = _swiss_empty_group();
+			slots = nullptr;
+			cap = growth_left = 0;
+			return;
+		}
+		size_type c = _capacity_for(elements);
+		while (c < n)
+			c = c * 2 + 1;
+		_resize(c);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	template <typename InputIterator>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			_insert_unique(*first);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::iterator _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::erase(const_iterator position)
+	{
+		const size_type i = static_cast<size_type>(position.ctrl - ctrl);
+		_erase_at(i);
+		iterator it = _iter(i);
+		it._skip();
+		return it;
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::clear()
+	{
+		if (cap == 0)
+			return;
+		_destroy();
+		std::memset(ctrl, static_cast<unsigned char>(_ctrl_empty), cap + 16);
+		ctrl[cap] = _ctrl_sentinel;
+		elements = 0;
+		growth_left = _growth(cap);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::swap(_swiss_table &t)
+	{
+		using std::swap;
+		swap(ctrl, t.ctrl);
+		swap(slots, t.slots);
+		swap(cap, t.cap);
+		swap(elements, t.elements);
+		swap(growth_left, t.growth_left);
+		swap(hash_fn, t.hash_fn);
+		swap(eq, t.eq);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// protected member functions
+	// the groups of the probe of h, until one holds the key or an empty slot. Only slots whose
+	// control byte equals H2 get a key comparison
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	template <typename K>
+	typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::size_type _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_find(const K &k, std::size_t h) const
+	{
+		const signed char h2 = static_cast<signed char>(h & 0x7F);
+		size_type pos = (h >> 7) & cap, step = 0;
+		for (;;)
+		{
+			const signed char *group = ctrl + pos;
+			for (unsigned match = _match_bytes16(group, h2); match != 0; match &= match - 1)
+			{
+				const size_type i = (pos + _count_trailing_zeros(match)) & cap;
+				if (eq(KeyOfValue()(slots[i]), k))
+					return i;
+			}
+			if (_match_bytes16(group, _ctrl_empty) != 0)
+				return cap;
+			step += 16;
+			pos = (pos + step) & cap;
+		}
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::size_type _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_find_first_non_full(std::size_t h) const
+	{
+		size_type pos = (h >> 7) & cap, step = 0;
+		for (;;)
+		{
+			const unsigned free = _less_bytes16(ctrl + pos, _ctrl_sentinel);	// empty or deleted
+			if (free != 0)
+				return (pos + _count_trailing_zeros(free)) & cap;
+			step += 16;
+			pos = (pos + step) & cap;
+		}
+	}
+
+
+	// a deleted slot is reused for free; an empty one takes room, and when there is none left the
+	// table grows first (an empty table always lands here: its static group has no real slot)
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::size_type _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_prepare_insert(std::size_t h)
+	{
+		size_type i = _find_first_non_full(h);
+		if (growth_left == 0 && ctrl[i] != _ctrl_deleted)
+		{
+			_grow();
+			i = _find_first_non_full(h);
+		}
+		return i;
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	template <typename V>
+	std::pair<typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::iterator, bool> _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_insert_unique(V &&val)
+	{
+		const std::size_t h = _hash(KeyOfValue()(val));
+		size_type i = _find(KeyOfValue()(val), h);
+		if (i != cap)
+			return std::pair<iterator, bool>(_iter(i), false);
+		i = _prepare_insert(h);
+		allocator<Value>::construct(slots + i, std::forward<V>(val));
+		growth_left -= ctrl[i] == _ctrl_empty;
+		_set_ctrl(i, static_cast<signed char>(h & 0x7F));
+		++elements;
+		return std::pair<iterator, bool>(_iter(i), true);
+	}
+
+
+	// builds the value only when k is absent; the key is hashed once
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	template <typename K, typename... Args>
+	std::pair<typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::iterator, bool> _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_try_emplace(K &&k, Args&&... args)
+	{
+		const std::size_t h = _hash(k);
+		size_type i = _find(k, h);
+		if (i != cap)
+			return std::pair<iterator, bool>(_iter(i), false);
+		i = _prepare_insert(h);
+		allocator<Value>::construct(slots + i, std::piecewise_construct,
+			std::forward_as_tuple(std::forward<K>(k)), std::forward_as_tuple(std::forward<Args>(args)...));
+		growth_left -= ctrl[i] == _ctrl_empty;
+		_set_ctrl(i, static_cast<signed char>(h & 0x7F));
+		++elements;
+		return std::pair<iterator, bool>(_iter(i), true);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	template <typename K>
+	typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::size_type _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_erase_key(const K &k)
+	{
+		const size_type i = _find(k, _hash(k));
+		if (i == cap)
+			return 0;
+		_erase_at(i);
+		return 1;
+	}
+
+
+	// A probe only goes on past a group without empty bytes. If the run of non-empty bytes around
+	// i is shorter than a group, no 16 byte window over i was ever free of empties, so no probe went
+	// past i and the slot can become empty again; otherwise it must stay as a tombstone. A table of
+	// one group is searched whole by every probe
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_erase_at(size_type i)
+	{
+		allocator<Value>::destroy(slots + i);
+		--elements;
+		bool never_full = cap < 16;
+		if (!never_full)
+		{
+			const unsigned empty_after = _match_bytes16(ctrl + i, _ctrl_empty);
+			const unsigned empty_before = _match_bytes16(ctrl + ((i - 16) & cap), _ctrl_empty);
+			never_full = empty_after != 0 && empty_before != 0
+				&& _count_trailing_zeros(empty_after) + (15 - _floor_log2(empty_before)) < 16;
+		}
+		_set_ctrl(i, never_full ? _ctrl_empty : _ctrl_deleted);
+		growth_left += never_full;
+	}
+
+
+	// smallest 2^k - 1 slots, at least one group, that hold n values
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	typename _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::size_type _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_capacity_for(size_type n)
+	{
+		size_type c = 15;
+		while (_growth(c) < n)
+			c = c * 2 + 1;
+		return c;
+	}
+
+
+	// out of room: double, unless the tombstones took the room (at most 25/32 full), then rebuild
+	// at the same size to drop them
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_grow()
+	{
+		if (cap == 0)
+			_resize(15);
+		else if (elements * 32 <= cap * 25)
+			_resize(cap);
+		else
+			_resize(cap * 2 + 1);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_resize(size_type new_cap)
+	{
+		signed char *old_ctrl = ctrl;
+		Value *old_slots = slots;
+		const size_type old_cap = cap;
+		_allocate(new_cap);
+		for (size_type j = 0; j != old_cap; ++j)
+		{
+			if (old_ctrl[j] < 0)
+				continue;
+			const std::size_t h = _hash(KeyOfValue()(old_slots[j]));
+			const size_type i = _find_first_non_full(h);
+			allocator<Value>::construct(slots + i, std::move(old_slots[j]));
+			allocator<Value>::destroy(old_slots + j);
+			_set_ctrl(i, static_cast<signed char>(h & 0x7F));
+		}
+		growth_left -= elements;
+		if (old_cap != 0)
+		{
+			allocator<signed char>::deallocate(old_ctrl, old_cap + 16);
+			allocator<Value>::deallocate(old_slots, old_cap);
+		}
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_allocate(size_type c)
+	{
+		ctrl = allocator<signed char>::allocate(c + 16);
+		slots = allocator<Value>::allocate(c);
+		cap = c;
+		std::memset(ctrl, static_cast<unsigned char>(_ctrl_empty), c + 16);
+		ctrl[c] = _ctrl_sentinel;
+		growth_left = _growth(c);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_destroy()
+	{
+		for (size_type i = 0; i != cap; ++i)
+			if (ctrl[i] >= 0)
+				allocator<Value>::destroy(slots + i);
+	}
+
+
+	template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, bool Mutable>
+	void _swiss_table<Key, Value, KeyOfValue, Hash, KeyEqual, Mutable>::_deallocate()
+	{
+		if (cap == 0)
+			return;
+		allocator<signed char>::deallocate(ctrl, cap + 16);
+		allocator<Value>::deallocate(slots, cap);
+	}
+}
+
+#endif // INCLUDED_SWISS_TABLE_IMPL_H
@@ -0,0 +1,108 @@
+#include <exception>	// exception_ptr, current_exception, rethrow_exception
+
+#include "../Declaration/thread_pool.h"
+
+namespace MySTL
+{
+	thread_pool::thread_pool(size_type n_threads)
+		: n_workers(n_threads > 1 ? n_threads - 1 : 0), job(nullptr), job_tasks(0),
+		  pending(0), generation(0), stopping(false)
+	{
+		workers.reset(new std::thread[n_workers]);
+		for (size_type i = 0; i != n_workers; ++i)
+			workers[i] = std::thread(&thread_pool::worker_loop, this, i + 1);	// the caller is worker 0
+	}
+
+
+	thread_pool::~thread_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			stopping = true;
+		}
+		cv_start.notify_all();
+		for (size_type i = 0; i != n_workers; ++i)
+			workers[i].join();
+	}
+
+
+	thread_pool& thread_pool::instance()
+	{
+		static thread_pool pool;
+		return pool;
+	}
+
+
+	void thread_pool::run(size_type n_tasks, const task_type &task)
+	{
+		if (n_tasks == 0)
+			return;
+
+		std::lock_guard<std::mutex> run_lock(run_mtx);
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			job = &task;
+			job_tasks = n_tasks;
+			pending = n_workers;
+			error = nullptr;
+			++generation;
+		}
+		cv_start.notify_all();
+
+		run_share(0);	// the calling thread takes its own share
+
+		std::unique_lock<std::mutex> lock(mtx);
+		cv_done.wait(lock, [this]() { return pending == 0; });
+		job = nullptr;
+		if (error)
+		{
+			std::exception_ptr e = error;
+			error = nullptr;
+			lock.unlock();
+			std::rethrow_exception(e);
+		}
+	}
+
+
+	// execute tasks id, id + size(), id + 2 * size(), ... of the current job
+	void thread_pool::run_share(size_type id)
+	{
+		for (size_type i = id; i < job_tasks; i += size())
+		{
+			try
+			{
+				(*job)(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+				if (!error)
+					error = std::current_exception();
+			}
+		}
+	}
+
+
+	void thread_pool::worker_loop(size_type id)
+	{
+		unsigned long seen = 0;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mtx);
+				cv_start.wait(lock, [&]() { return stopping || generation != seen; });
+				if (stopping)
+					return;
+				seen = generation;
+			}
+
+			run_share(id);
+
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+				--pending;
+			}
+			cv_done.notify_one();
+		}
+	}
+}
@@ -1,523 +1,866 @@
-#ifndef INCLUDED_VECTOR_IMPL_H
-#define INCLUDED_VECTOR_IMPL_H
-
-
-#include <utility>	// std::move & std::forward & std::pair
-#include <memory>	// std::uninitialized_copy & std::uninitialized_fill
-#include <algorithm>// std::swap, max
-#include <stdexcept>
-#include <cassert>	// assert
-
-#include "../Declaration/vector.h"
-#include "../Declaration/uninitialized_functions.h"
-				
-
-using namespace MySTL;
-namespace MySTL
-{
-	/////////////////////////////////////////////////////////////
-	// public member functions
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(const vector &s)
-	{
-		alloc_n_copy(s.begin(), s.end());
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(vector &&s) /*noexcept*/
-		: elements_start(s.elements_start), first_free(s.first_free), end_of_storage(s.end_of_storage)
-	{
-		s.elements_start = s.first_free = s.end_of_storage = nullptr;
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(const size_type n)
-	{
-		alloc_n_fill_n(n, value_type());
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(const size_type n, const_reference val)
-	{
-		typedef typename std::is_integral<size_type>::type IS_INTEGER;
-		_vector(n, val, IS_INTEGER());
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(std::initializer_list<T> il)
-	{
-		alloc_n_copy(il.begin(), il.end());
-	}
-
-
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	vector<T, Alloc>::vector(InputIterator first, InputIterator second)
-	{
-		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
-		_vector(first, second, IS_INTEGER());
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>& vector<T, Alloc>::operator=(const vector &rhs)
-	{
-		return alloc_n_copy(rhs.begin(), rhs.end());
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>& vector<T, Alloc>::operator=(vector<T, Alloc> &&rhs) /*noexcept*/
-	{
-		if (this != &rhs)
-		{
-			_free();
-			elements_start = rhs.elements_start;
-			first_free = rhs.first_free;
-			end_of_storage = rhs.end_of_storage;
-			rhs.elements_start = rhs.first_free = rhs.elements_start = nullptr;
-		}
-		return *this;
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>& vector<T, Alloc>::operator=(std::initializer_list<T> il)
-	{
-		return alloc_n_copy(il.begin(), il.end());
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::~vector()
-	{
-		_free();
-	}
-
-
-
-	// Elements Access
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::reference vector<T, Alloc>::at(size_type n)
-	{
-		//if (n >= size())
-		//{
-		//	throw std::out_of_range("out of range!");
-		//}
-		assert(n >= 0 && n < size());
-		return *(elements_start + n);
-	}
-
-
-	// Modifiers
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::assign(size_type n, const_reference val)
-	{
-		typedef typename std::is_integral<size_type>::type IS_INTEGER;
-		_assign(n, val, IS_INTEGER());
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::assign(std::initializer_list<value_type> il)
-	{
-		assign(il.begin(), il.end());
-	}
-
-
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	void vector<T, Alloc>::assign(InputIterator first, InputIterator last)
-	{
-		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
-		_assign(first, last, IS_INTEGER());
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::push_back(const_reference s)
-	{
-		chk_n_alloc();
-		data_allocator::construct(first_free++, s);
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::pop_back()
-	{
-		if (elements_start)
-			data_allocator::destroy(--first_free);
-	}
-
-
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, const_reference val)
-	{
-		return vector<T, Alloc>::insert(position, 1, val);
-	}
-
-
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, size_type n, const_reference val)
-	{
-		typedef typename std::is_integral<size_type>::type IS_INTEGER;
-		return _insert(position, n, val, IS_INTEGER());
-	}
-
-
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, InputIterator first, InputIterator second)
-	{
-		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
-		return _insert(position, first, second, IS_INTEGER());
-	}
-
-
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, std::initializer_list<T> il)
-	{
-		return insert<T>(position, il.begin(), il.end());
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::swap(vector &x)
-	{
-		if (this != &x)
-		{
-			using std::swap;
-			swap(elements_start, x.elements_start);
-			swap(first_free, x.first_free);
-			swap(end_of_storage, x.end_of_storage);
-		}
-	}
-
-
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator position)
-	{
-		return vector<T, Alloc>::erase(position, position + 1);
-	}
-
-
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator first, iterator second)
-	{
-		if (first == second)
-			return first;
-
-		difference_type len = second - first;
-		for (auto i = 0; i < len && (second + i) != first_free; ++i)
-			*(first + i) = *(second + i);
-		// destory the objects from second to end() one by one
-		for (iterator ptr = second; ptr != end(); ++ptr)
-			data_allocator::destroy(ptr);
-
-		first_free -= len;
-		return first;
-	}
-
-
-	//template <typename T, typename Alloc>
-	//template <typename... Args>
-	//void vector<T, Alloc>::emplace(const_iterator position, Args&&... args)
-	//{
-	//	chk_n_alloc();
-	//	for (auto curr = end(); curr != position; --curr)
-	//		*curr = *(curr - 1); // move forward
-	//	data_allocator::construct(position, std::forward<Args>(args)...);
-	//	++first_free;
-	//}
-
-
-	//template <typename T, typename Alloc>
-	//template <typename... Args>
-	//void vector<T, Alloc>::emplace_back(Args&&... args)
-	//{
-	//	chk_n_alloc();
-	//	data_allocator::construct(first_free++, std::forward<Args>(args)...);
-	//}
-
-
-	// capacity
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::resize(size_type n, value_type val = value_type())
-	{
-		if (n < size())
-		{
-			for (; first_free > elements_start + n;)
-				data_allocator::destroy(--first_free);
-		}
-		else if (n >= size() && n < capacity())
-		{
-			auto len_insert = n - size();
-			first_free = std::uninitialized_fill_n(first_free, len_insert, val);
-		}
-		else
-		{
-			T *_start = static_cast<T*>(Alloc::allocate(n));
-			auto len_insert = n - size();
-			T *_end = std::uninitialized_copy(begin(), end(), _start);
-			_end = std::uninitialized_fill_n(_end, len_insert, val);
-			_free();
-			elements_start = _start;
-			first_free = end_of_storage = _end;
-		}
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::reserve(size_type n)
-	{
-		if (n <= capacity())
-			return;
-		iterator _start = static_cast<iterator>(data_allocator::allocate(n));
-		iterator _end = std::uninitialized_copy(begin(), end(), _start);
-		_free();
-		elements_start = _start;
-		first_free = _end;
-		end_of_storage = elements_start + n;
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::shrink_to_fit()
-	{
-		data_allocator::deallocate(first_free, static_cast<size_type>(end_of_storage - first_free));
-		end_of_storage = first_free;
-	}
-
-
-	/////////////////////////////////////////////////////////////
-	// private member functions
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::_free()
-	{
-		if (elements_start)
-		{
-			// destroy the object p in vector one by one
-			data_allocator::destroy(elements_start, first_free);
-			// and free the space.
-			data_allocator::deallocate(elements_start, end_of_storage - elements_start);
-		}
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::chk_n_alloc()
-	{
-		if (size() == capacity())
-			_reallocate();
-	}
-
-
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	vector<T, Alloc>& vector<T, Alloc>::alloc_n_copy(InputIterator first, InputIterator last)
-	{
-		_free();
-		elements_start = data_allocator::allocate(last - first);
-		first_free = std::uninitialized_copy(first, last, elements_start);
-		end_of_storage = first_free;
-		return *this;
-	}
-
-
-	template <typename T, typename Alloc>
-	vector<T, Alloc>& vector<T, Alloc>::alloc_n_fill_n(const size_type n, const_reference val)
-	{
-		_free();
-		auto newdata = data_allocator::allocate(n);
-		std::uninitialized_fill_n(newdata, n, val);
-		elements_start = newdata;
-		first_free = end_of_storage = elements_start + n;
-		return *this;
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::_reallocate()
-	{
-		size_type newcapacity = size() ? 2 * size() : 1;
-		auto newdata = data_allocator::allocate(newcapacity);
-
-		auto dest = newdata;
-		auto elem = elements_start;
-		for (size_type i = 0; i != size(); ++i)
-		{
-			data_allocator::construct(dest++, std::move(*elem++));
-		}
-		// or
-		// dest = std::uninitialized_copy(std::make_move_iterator(begin()), std::make_move_iterator(end()), newdata);
-
-		_free();
-		elements_start = newdata;
-		first_free = dest;
-		end_of_storage = elements_start + newcapacity;
-	}
-
-
-	// constructor auxiliary functions, (std::true_type / std::false_type) were regarded as the symbol of overloads.
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	void vector<T, Alloc>::_vector(InputIterator first, InputIterator second, std::false_type)
-	{
-		alloc_n_copy(first, second);
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::_vector(const size_type n, const_reference val, std::true_type)
-	{
-		alloc_n_fill_n(n, val);
-	}
-
-
-	// insert auxiliary
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::_insert(iterator position, InputIterator first, InputIterator second, std::false_type)
-	{
-		difference_type space_left = end_of_storage - first_free;
-		difference_type space_required = second - first;
-		if (space_left >= space_required)
-		{
-			std::uninitialized_copy(position, end(), end() + space_required);
-			std::uninitialized_copy(first, second, position);// insert
-			first_free += space_required;
-		}
-		else
-		{
-			using std::max;
-			const size_type len = size() + max(size(), static_cast<size_type>(space_required));
-			iterator _start = static_cast<iterator>(data_allocator::allocate(len));
-			iterator _end = std::uninitialized_copy(begin(), position, _start);
-			_end = std::uninitialized_copy(first, second, _end); // insert
-			_end = std::uninitialized_copy(position, end(), _end);
-			_free();
-			elements_start = _start;
-			first_free = _end;
-			end_of_storage = elements_start + len;
-		}
-		return position;
-	}
-
-
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::iterator vector<T, Alloc>::_insert(iterator position, size_type n, const_reference val, std::true_type)
-	{
-		auto space_left = end_of_storage - first_free;
-		if (n <= static_cast<size_type>(space_left))
-		{
-			for (auto curr = end() - 1; curr != position; --curr)
-				*(curr + n) = *curr;
-			std::uninitialized_fill_n(position, n, val);
-			first_free += n;
-		}
-		else
-		{
-			using std::max;
-			const size_type len = size() + max(size(), n);
-			iterator _start = data_allocator::allocate(static_cast<size_type>(len));
-			iterator _end = std::uninitialized_copy(begin(), position, _start);
-			_end = std::uninitialized_fill_n(_end, n, val); // _end point to next free space
-			_end = std::uninitialized_copy(position, end(), _end);
-			_free();
-			elements_start = _start;
-			first_free = _end;
-			end_of_storage = elements_start + len;
-		}
-		return position;
-	}
-
-
-	// assign auxiliary
-	template <typename T, typename Alloc>
-	template <typename InputIterator>
-	void vector<T, Alloc>::_assign(InputIterator first, InputIterator last, std::false_type)
-	{
-		alloc_n_copy(first, last);
-	}
-
-
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::_assign(size_type n, const_reference val, std::true_type)
-	{
-		alloc_n_fill_n(n, val);
-	}
-
-
-
-	/////////////////////////////////////////////////////////////
-	// non-member functions overloads
-	template <typename T, typename Alloc>
-	bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-	{
-		if (lhs.size() != rhs.size())
-			return false;
-		for (auto ptr1 = lhs.begin(), ptr2 = rhs.begin(); ptr1 != lhs.end() && ptr2 != rhs.end(); ++ptr1, ++ptr2)
-		{
-			if (*ptr1 != *ptr2)
-				return false;
-		}
-		return true;
-	}
-
-
-	template <typename T, typename Alloc>
-	bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-	{
-		return !(rhs == rhs);
-	}
-
-
-	template <typename T, typename Alloc>
-	bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-	{
-		for (auto ptr1 = lhs.begin(), ptr2 = rhs.begin(); ptr1 != lhs.end() && ptr2 != rhs.end(); ++ptr1, ++ptr2)
-		{
-			if (*ptr1 >= *ptr2)
-				return false;
-		}
-		return true;
-	}
-
-
-	template <typename T, typename Alloc>
-	bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-	{
-		return lhs < rhs || lhs == rhs;
-	}
-
-
-	template <typename T, typename Alloc>
-	bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-	{
-		for (auto ptr1 = lhs.begin(), ptr2 = rhs.begin(); ptr1 != lhs.end() && ptr2 != rhs.end(); ++ptr1, ++ptr2)
-		{
-			if (*ptr1 >= *ptr2)
-				return false;
-		}
-		return true;
-	}
-
-
-	template <typename T, typename Alloc>
-	bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
-	{
-		return lhs > rhs || lhs == rhs;
-	}
-
-
-	template <typename T, typename Alloc>
-	void swap(vector<T, Alloc>& x, vector<T, Alloc>& y)
-	{
-		x.swap(y);
-	}
-}
+#ifndef INCLUDED_VECTOR_IMPL_H
+#define INCLUDED_VECTOR_IMPL_H
+
+
+#include <utility>	// std::move & std::forward & std::pair
+#include <memory>	// std::uninitialized_copy & std::uninitialized_fill
+#include <algorithm>// std::swap, max
+#include <stdexcept>
+#include <cassert>	// assert
+#include <cstring>	// memmove
+
+#include "../Declaration/vector.h"
+#include "../Declaration/uninitialized_functions.h"
+#include "../Declaration/algorithm.h"
+				
+
+using namespace MySTL;
+namespace MySTL
+{
+	/////////////////////////////////////////////////////////////
+	// public member functions
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(const vector &s)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		alloc_n_copy(s.begin(), s.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(vector &&s) noexcept
+		: elements_start(s.elements_start), first_free(s.first_free), end_of_storage(s.end_of_storage)
+	{
+		s.elements_start = s.first_free = s.end_of_storage = nullptr;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(const size_type n)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		alloc_n_fill_n(n, value_type());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(const size_type n, const_reference val)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		typedef typename std::is_integral<size_type>::type IS_INTEGER;
+		_vector(n, val, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(std::initializer_list<T> il)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		alloc_n_copy(il.begin(), il.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	vector<T, Alloc, GrowthPolicy>::vector(InputIterator first, InputIterator second)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		_vector(first, second, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(const parallel_policy &policy, const vector &s)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		alloc_n_copy(policy, s.begin(), s.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(const parallel_policy &policy, const size_type n)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		alloc_n_fill_n(policy, n, value_type());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::vector(const parallel_policy &policy, const size_type n, const_reference val)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		alloc_n_fill_n(policy, n, val);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename RandomAccessIterator>
+	vector<T, Alloc, GrowthPolicy>::vector(const parallel_policy &policy, RandomAccessIterator first, RandomAccessIterator second)
+		: elements_start(nullptr), first_free(nullptr), end_of_storage(nullptr)
+	{
+		typedef typename std::is_integral<RandomAccessIterator>::type IS_INTEGER;
+		_vector(policy, first, second, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::operator=(const vector &rhs)
+	{
+		return alloc_n_copy(rhs.begin(), rhs.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::operator=(vector<T, Alloc, GrowthPolicy> &&rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			_free();
+			elements_start = rhs.elements_start;
+			first_free = rhs.first_free;
+			end_of_storage = rhs.end_of_storage;
+			rhs.elements_start = rhs.first_free = rhs.end_of_storage = nullptr;
+		}
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::operator=(std::initializer_list<T> il)
+	{
+		return alloc_n_copy(il.begin(), il.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>::~vector()
+	{
+		_free();
+	}
+
+
+
+	// Elements Access
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::reference vector<T, Alloc, GrowthPolicy>::at(size_type n)
+	{
+		//if (n >= size())
+		//{
+		//	throw std::out_of_range("out of range!");
+		//}
+		assert(n >= 0 && n < size());
+		return *(elements_start + n);
+	}
+
+
+	// Modifiers
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::assign(size_type n, const_reference val)
+	{
+		typedef typename std::is_integral<size_type>::type IS_INTEGER;
+		_assign(n, val, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::assign(std::initializer_list<value_type> il)
+	{
+		assign(il.begin(), il.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	void vector<T, Alloc, GrowthPolicy>::assign(InputIterator first, InputIterator last)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		_assign(first, last, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::assign(const parallel_policy &policy, size_type n, const_reference val)
+	{
+		alloc_n_fill_n(policy, n, val);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename RandomAccessIterator>
+	void vector<T, Alloc, GrowthPolicy>::assign(const parallel_policy &policy, RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef typename std::is_integral<RandomAccessIterator>::type IS_INTEGER;
+		_assign(policy, first, last, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::push_back(const_reference s)
+	{
+		emplace_back(s);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::push_back(value_type &&s)
+	{
+		emplace_back(std::move(s));
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::pop_back()
+	{
+		if (elements_start)
+			data_allocator::destroy(--first_free);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::insert(iterator position, const_reference val)
+	{
+		return vector<T, Alloc, GrowthPolicy>::insert(position, 1, val);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::insert(iterator position, value_type &&val)
+	{
+		return emplace(position, std::move(val));
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::insert(iterator position, size_type n, const_reference val)
+	{
+		typedef typename std::is_integral<size_type>::type IS_INTEGER;
+		return _insert(position, n, val, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::insert(iterator position, InputIterator first, InputIterator second)
+	{
+		typedef typename std::is_integral<InputIterator>::type IS_INTEGER;
+		return _insert(position, first, second, IS_INTEGER());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::insert(iterator position, std::initializer_list<T> il)
+	{
+		return insert(position, il.begin(), il.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::swap(vector &x)
+	{
+		if (this != &x)
+		{
+			using std::swap;
+			swap(elements_start, x.elements_start);
+			swap(first_free, x.first_free);
+			swap(end_of_storage, x.end_of_storage);
+		}
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::erase(iterator position)
+	{
+		return vector<T, Alloc, GrowthPolicy>::erase(position, position + 1);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::erase(iterator first, iterator second)
+	{
+		if (first == second)
+			return first;
+
+		// one memmove for trivially copyable types, a move-assign shift otherwise
+		iterator new_end = MySTL::move(second, first_free, first);
+		// destory the trailing objects, a no-op for trivially destructible types
+		data_allocator::destroy(new_end, first_free);
+
+		first_free = new_end;
+		return first;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename... Args>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::emplace(const_iterator position, Args&&... args)
+	{
+		iterator pos = const_cast<iterator>(position);
+		if (first_free == end_of_storage)
+			return _realloc_emplace(pos, std::forward<Args>(args)...);
+		if (pos == first_free)
+		{
+			data_allocator::construct(first_free, std::forward<Args>(args)...);
+			++first_free;
+			return pos;
+		}
+		value_type tmp(std::forward<Args>(args)...);	// args may refer to an element that is about to move
+		typedef typename std::is_trivially_copyable<value_type>::type TRIVIALLY_COPYABLE;
+		iterator old_end = first_free;
+		if (_open_gap(pos, 1, TRIVIALLY_COPYABLE()) == pos)
+			data_allocator::construct(pos, std::move(tmp));
+		else
+			*pos = std::move(tmp);
+		first_free = old_end + 1;
+		return pos;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename... Args>
+	void vector<T, Alloc, GrowthPolicy>::emplace_back(Args&&... args)
+	{
+		if (first_free != end_of_storage)
+		{
+			data_allocator::construct(first_free, std::forward<Args>(args)...);
+			++first_free;
+		}
+		else
+			_realloc_emplace(first_free, std::forward<Args>(args)...);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::pointer vector<T, Alloc, GrowthPolicy>::reserve_back(size_type n)
+	{
+		if (static_cast<size_type>(end_of_storage - first_free) < n)
+			reserve(_next_capacity(n));
+		return first_free;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::commit_back(size_type n)
+	{
+		assert(n <= static_cast<size_type>(end_of_storage - first_free));
+		first_free += n;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::unchecked_push_back(const_reference val)
+	{
+		assert(first_free != end_of_storage);
+		data_allocator::construct(first_free, val);
+		++first_free;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename... Args>
+	void vector<T, Alloc, GrowthPolicy>::unchecked_emplace_back(Args&&... args)
+	{
+		assert(first_free != end_of_storage);
+		data_allocator::construct(first_free, std::forward<Args>(args)...);
+		++first_free;
+	}
+
+
+	// capacity
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::resize(size_type n, value_type val)
+	{
+		if (n < size())
+		{
+			data_allocator::destroy(elements_start + n, first_free);
+			first_free = elements_start + n;
+		}
+		else if (n <= capacity())
+		{
+			auto len_insert = n - size();
+			first_free = std::uninitialized_fill_n(first_free, len_insert, val);
+		}
+		else
+		{
+			T *_start = static_cast<T*>(Alloc::allocate(n));
+			auto len_insert = n - size();
+			T *_end = _start;
+			try
+			{
+				_end = MySTL::uninitialized_move_if_noexcept(begin(), end(), _start);
+				_end = std::uninitialized_fill_n(_end, len_insert, val);
+			}
+			catch (...)
+			{
+				data_allocator::destroy(_start, _end);	// the step that threw has undone its own part
+				data_allocator::deallocate(_start, n);
+				throw;
+			}
+			_free();
+			elements_start = _start;
+			first_free = end_of_storage = _end;
+		}
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::resize_default_init(size_type n)
+	{
+		if (n <= size())
+		{
+			data_allocator::destroy(elements_start + n, first_free);
+			first_free = elements_start + n;
+			return;
+		}
+		reserve(n);
+		typedef typename std::is_trivially_default_constructible<value_type>::type TRIVIAL_DEFAULT_CTOR;
+		first_free = _default_init_n(first_free, n - size(), TRIVIAL_DEFAULT_CTOR());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename Operation>
+	void vector<T, Alloc, GrowthPolicy>::resize_and_overwrite(size_type n, Operation op)
+	{
+		static_assert(std::is_trivial<value_type>::value, "resize_and_overwrite requires a trivial value_type");
+		reserve(n);
+		size_type new_size = static_cast<size_type>(op(elements_start, n));
+		assert(new_size <= n);
+		first_free = elements_start + new_size;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_default_init_n(iterator first, size_type n, std::true_type)
+	{
+		// default-initialization of a trivial object does nothing, the memory keeps whatever it held
+		return first + n;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_default_init_n(iterator first, size_type n, std::false_type)
+	{
+		iterator cur = first;
+		try
+		{
+			for (; n > 0; --n, ++cur)
+				::new (static_cast<void*>(cur)) value_type;	// no parentheses: default-, not value-initialized
+		}
+		catch (...)
+		{
+			data_allocator::destroy(first, cur);
+			throw;
+		}
+		return cur;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::reserve(size_type n)
+	{
+		if (n <= capacity())
+			return;
+		iterator _start = static_cast<iterator>(data_allocator::allocate(n));
+		iterator _end;
+		try
+		{
+			_end = MySTL::uninitialized_move_if_noexcept(begin(), end(), _start);
+		}
+		catch (...)
+		{
+			data_allocator::deallocate(_start, n);
+			throw;
+		}
+		_free();
+		elements_start = _start;
+		first_free = _end;
+		end_of_storage = elements_start + n;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::shrink_to_fit()
+	{
+		if (first_free == end_of_storage)
+			return;
+		// the spare room can't be handed back on its own, move the elements into a block of their size
+		const size_type n = size();
+		T *_start = n == 0 ? nullptr : static_cast<T*>(Alloc::allocate(n));
+		T *_end;
+		try
+		{
+			_end = MySTL::uninitialized_move_if_noexcept(begin(), end(), _start);
+		}
+		catch (...)
+		{
+			if (_start)
+				data_allocator::deallocate(_start, n);
+			throw;
+		}
+		_free();
+		elements_start = _start;
+		first_free = end_of_storage = _end;
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// private member functions
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::_free()
+	{
+		if (elements_start)
+		{
+			// destroy the objects in vector (compiles away for trivially destructible types)
+			data_allocator::destroy(elements_start, first_free);
+			// and free the space.
+			data_allocator::deallocate(elements_start, end_of_storage - elements_start);
+		}
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::alloc_n_copy(InputIterator first, InputIterator last)
+	{
+		_free();
+		elements_start = data_allocator::allocate(last - first);
+		first_free = MySTL::uninitialized_copy(first, last, elements_start);
+		end_of_storage = first_free;
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::alloc_n_fill_n(const size_type n, const_reference val)
+	{
+		_free();
+		auto newdata = data_allocator::allocate(n);
+		std::uninitialized_fill_n(newdata, n, val);
+		elements_start = newdata;
+		first_free = end_of_storage = elements_start + n;
+		return *this;
+	}
+
+
+	// the pages of the new storage are first touched by the pool threads that construct them
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename RandomAccessIterator>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::alloc_n_copy(const parallel_policy &policy, RandomAccessIterator first, RandomAccessIterator last)
+	{
+		_free();
+		elements_start = data_allocator::allocate(last - first);
+		first_free = MySTL::uninitialized_copy(policy, first, last, elements_start);
+		end_of_storage = first_free;
+		return *this;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	vector<T, Alloc, GrowthPolicy>& vector<T, Alloc, GrowthPolicy>::alloc_n_fill_n(const parallel_policy &policy, const size_type n, const_reference val)
+	{
+		_free();
+		auto newdata = data_allocator::allocate(n);
+		MySTL::uninitialized_fill_n(policy, newdata, n, val);
+		elements_start = newdata;
+		first_free = end_of_storage = elements_start + n;
+		return *this;
+	}
+
+
+	// The new element is constructed first, in the new storage, so that args may still refer
+	// to the old elements; then the old elements are relocated around it.
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename... Args>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_realloc_emplace(iterator position, Args&&... args)
+	{
+		const size_type len = _next_capacity(1);
+		iterator _start = data_allocator::allocate(len);
+		iterator inserted = _start + (position - begin());
+		try
+		{
+			data_allocator::construct(inserted, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			data_allocator::deallocate(_start, len);
+			throw;
+		}
+
+		iterator _end = inserted + 1;
+		try
+		{
+			MySTL::uninitialized_move_if_noexcept(begin(), position, _start);
+		}
+		catch (...)
+		{
+			data_allocator::destroy(inserted);
+			data_allocator::deallocate(_start, len);
+			throw;
+		}
+		try
+		{
+			_end = MySTL::uninitialized_move_if_noexcept(position, end(), _end);
+		}
+		catch (...)
+		{
+			data_allocator::destroy(_start, inserted + 1);
+			data_allocator::deallocate(_start, len);
+			throw;
+		}
+
+		_free();
+		elements_start = _start;
+		first_free = _end;
+		end_of_storage = elements_start + len;
+		return inserted;
+	}
+
+
+	// constructor auxiliary functions, (std::true_type / std::false_type) were regarded as the symbol of overloads.
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	void vector<T, Alloc, GrowthPolicy>::_vector(InputIterator first, InputIterator second, std::false_type)
+	{
+		alloc_n_copy(first, second);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::_vector(const size_type n, const_reference val, std::true_type)
+	{
+		alloc_n_fill_n(n, val);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename RandomAccessIterator>
+	void vector<T, Alloc, GrowthPolicy>::_vector(const parallel_policy &policy, RandomAccessIterator first, RandomAccessIterator second, std::false_type)
+	{
+		alloc_n_copy(policy, first, second);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::_vector(const parallel_policy &policy, const size_type n, const_reference val, std::true_type)
+	{
+		alloc_n_fill_n(policy, n, val);
+	}
+
+
+	// Shift [position, end()) n slots to the right, leaving end() unchanged (the caller fills the
+	// gap and then moves first_free). Returns where the raw memory of the gap starts:
+	// [position, returned) still holds moved-from objects to assign to,
+	// [returned, position + n) has to be constructed.
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_open_gap(iterator position, size_type n, std::true_type)
+	{
+		// trivially copyable: one memmove, the whole gap counts as raw memory
+		std::memmove(static_cast<void*>(position + n), static_cast<const void*>(position),
+			sizeof(value_type) * static_cast<size_type>(first_free - position));
+		return position;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_open_gap(iterator position, size_type n, std::false_type)
+	{
+		// the elements that land beyond end() are move constructed, the others move assigned
+		iterator old_end = first_free;
+		if (static_cast<size_type>(old_end - position) > n)
+		{
+			MySTL::uninitialized_move(old_end - n, old_end, old_end);
+			MySTL::move_backward(position, old_end - n, old_end);
+			return position + n;
+		}
+		MySTL::uninitialized_move(position, old_end, position + n);
+		return old_end;
+	}
+
+
+	// insert auxiliary
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_insert(iterator position, InputIterator first, InputIterator second, std::false_type)
+	{
+		difference_type space_left = end_of_storage - first_free;
+		difference_type space_required = second - first;
+		if (space_required == 0)
+			return position;	// _open_gap(position, 0) would move every element onto itself
+		if (space_left >= space_required)
+		{
+			typedef typename std::is_trivially_copyable<value_type>::type TRIVIALLY_COPYABLE;
+			iterator old_end = end();
+			iterator raw = _open_gap(position, static_cast<size_type>(space_required), TRIVIALLY_COPYABLE());
+			InputIterator mid = first + (raw - position);
+			MySTL::copy(first, mid, position);				// insert, over the moved-from elements
+			MySTL::uninitialized_copy(mid, second, raw);	// insert, into raw memory
+			first_free = old_end + space_required;
+			return position;
+		}
+		else
+		{
+			const size_type len = _next_capacity(static_cast<size_type>(space_required));
+			iterator _start = static_cast<iterator>(data_allocator::allocate(len));
+			iterator _end = _start;
+			iterator inserted = _start + (position - begin());
+			try
+			{
+				_end = MySTL::uninitialized_move_if_noexcept(begin(), position, _start);
+				_end = MySTL::uninitialized_copy(first, second, _end); // insert
+				_end = MySTL::uninitialized_move_if_noexcept(position, end(), _end);
+			}
+			catch (...)
+			{
+				data_allocator::destroy(_start, _end);	// the step that threw has undone its own part
+				data_allocator::deallocate(_start, len);
+				throw;
+			}
+			_free();
+			elements_start = _start;
+			first_free = _end;
+			end_of_storage = elements_start + len;
+			return inserted;	// position points into the released storage
+		}
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	typename vector<T, Alloc, GrowthPolicy>::iterator vector<T, Alloc, GrowthPolicy>::_insert(iterator position, size_type n, const_reference val, std::true_type)
+	{
+		auto space_left = end_of_storage - first_free;
+		if (n == 0)
+			return position;	// _open_gap(position, 0) would move every element onto itself
+		if (n <= static_cast<size_type>(space_left))
+		{
+			value_type val_copy = val;	// val may refer to an element that is about to move
+			typedef typename std::is_trivially_copyable<value_type>::type TRIVIALLY_COPYABLE;
+			iterator old_end = end();
+			iterator raw = _open_gap(position, n, TRIVIALLY_COPYABLE());
+			MySTL::fill(position, raw, val_copy);
+			MySTL::uninitialized_fill_n(raw, static_cast<size_type>(position + n - raw), val_copy);
+			first_free = old_end + n;
+			return position;
+		}
+		else
+		{
+			const size_type len = _next_capacity(n);
+			iterator _start = data_allocator::allocate(static_cast<size_type>(len));
+			iterator _end = _start;
+			iterator inserted = _start + (position - begin());
+			try
+			{
+				_end = MySTL::uninitialized_move_if_noexcept(begin(), position, _start);
+				_end = MySTL::uninitialized_fill_n(_end, n, val); // _end point to next free space
+				_end = MySTL::uninitialized_move_if_noexcept(position, end(), _end);
+			}
+			catch (...)
+			{
+				data_allocator::destroy(_start, _end);	// the step that threw has undone its own part
+				data_allocator::deallocate(_start, len);
+				throw;
+			}
+			_free();
+			elements_start = _start;
+			first_free = _end;
+			end_of_storage = elements_start + len;
+			return inserted;	// position points into the released storage
+		}
+	}
+
+
+	// assign auxiliary
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename InputIterator>
+	void vector<T, Alloc, GrowthPolicy>::_assign(InputIterator first, InputIterator last, std::false_type)
+	{
+		alloc_n_copy(first, last);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::_assign(size_type n, const_reference val, std::true_type)
+	{
+		alloc_n_fill_n(n, val);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	template <typename RandomAccessIterator>
+	void vector<T, Alloc, GrowthPolicy>::_assign(const parallel_policy &policy, RandomAccessIterator first, RandomAccessIterator last, std::false_type)
+	{
+		alloc_n_copy(policy, first, last);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void vector<T, Alloc, GrowthPolicy>::_assign(const parallel_policy &policy, size_type n, const_reference val, std::true_type)
+	{
+		alloc_n_fill_n(policy, n, val);
+	}
+
+
+
+	/////////////////////////////////////////////////////////////
+	// non-member functions overloads
+	// relational operators: MySTL::equal and MySTL::lexicographical_compare lower to memcmp and the
+	// SIMD mismatch kernel for integral elements, and fall back to element-wise operator== / operator<
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator==(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs)
+	{
+		return lhs.size() == rhs.size() && MySTL::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator!=(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator<(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs)
+	{
+		return MySTL::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator<=(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator>(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs)
+	{
+		return rhs < lhs;
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	bool operator>=(const vector<T, Alloc, GrowthPolicy>& lhs, const vector<T, Alloc, GrowthPolicy>& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy>
+	void swap(vector<T, Alloc, GrowthPolicy>& x, vector<T, Alloc, GrowthPolicy>& y)
+	{
+		x.swap(y);
+	}
+
+
+	template <typename T, typename Alloc, typename GrowthPolicy, typename Predicate>
+	typename vector<T, Alloc, GrowthPolicy>::size_type erase_if(vector<T, Alloc, GrowthPolicy>& c, Predicate pred)
+	{
+		typename vector<T, Alloc, GrowthPolicy>::iterator new_end = MySTL::remove_if(c.begin(), c.end(), pred);
+		typename vector<T, Alloc, GrowthPolicy>::size_type removed = static_cast<typename vector<T, Alloc, GrowthPolicy>::size_type>(c.end() - new_end);
+		c.erase(new_end, c.end());
+		return removed;
+	}
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,139 @@
+#ifndef INCLUDED_TEST_ALGORITHM
+#define INCLUDED_TEST_ALGORITHM
+
+#include <iostream>
+#include <string>
+#include <list>
+
+#include "../Declaration/algorithm.h"
+#include "../Declaration/reverse_iterator.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace TestAlgorithm
+	{
+		inline void tc_contiguous_category()
+		{
+			std::cout << "-----\t contiguous_iterator_tag" << '\n';
+			std::cout << std::boolalpha
+				<< _is_contiguous_iterator<int*>::value << ' '									// true
+				<< _is_contiguous_iterator<const char*>::value << ' '							// true
+				<< _is_contiguous_iterator<MySTL::vector<int>::iterator>::value << ' '			// true
+				<< _is_contiguous_iterator<MySTL::reverse_iterator<int*> >::value << ' '		// false
+				<< _is_contiguous_iterator<std::list<int>::iterator>::value << '\n'				// false
+				<< std::noboolalpha;
+		}
+
+		inline void tc_copy()
+		{
+			std::cout << "-----\t copy / copy_backward" << '\n';
+			int a[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+			MySTL::copy(a, a + 5, a + 3);					// overlapping, memmove
+			for (int x : a)
+				std::cout << x << ' ';
+			std::cout << '\n';								// 0 1 2 0 1 2 3 4
+
+			int b[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+			MySTL::copy_backward(b, b + 5, b + 8);
+			for (int x : b)
+				std::cout << x << ' ';
+			std::cout << '\n';								// 0 1 2 0 1 2 3 4
+
+			std::string s[] = { "a", "b", "c" }, t[3];
+			std::string *finish = MySTL::copy(s, s + 3, t);	// element-wise
+			std::cout << t[0] << t[1] << t[2] << ' ' << (finish - t) << '\n';	// abc 3
+
+			std::list<int> l(a, a + 3);
+			int c[3] = { 0 };
+			MySTL::copy(l.begin(), l.end(), c);				// not contiguous
+			std::cout << c[0] << c[1] << c[2] << '\n';		// 012
+		}
+
+		inline void tc_fill()
+		{
+			std::cout << "-----\t fill / fill_n" << '\n';
+			char buf[8];
+			MySTL::fill(buf, buf + 7, 'x');					// memset
+			buf[7] = '\0';
+			std::cout << buf << '\n';						// xxxxxxx
+
+			unsigned char bytes[4];
+			MySTL::fill_n(bytes, 4, 300);					// converted to unsigned char first
+			std::cout << int(bytes[0]) << ' ' << int(bytes[3]) << '\n';	// 44 44
+
+			int ints[4];
+			MySTL::fill(ints, ints + 4, -1);
+			std::cout << ints[0] << ' ' << ints[3] << '\n';	// -1 -1
+		}
+
+		inline void tc_compare()
+		{
+			std::cout << "-----\t equal / mismatch / lexicographical_compare" << '\n';
+			MySTL::vector<int> v1, v2;
+			for (int i = 0; i != 100; ++i)
+			{
+				v1.push_back(i);
+				v2.push_back(i);
+			}
+			std::cout << MySTL::equal(v1.begin(), v1.end(), v2.begin()) << ' ';		// 1
+			v2[77] = -1;
+			std::cout << MySTL::equal(v1.begin(), v1.end(), v2.begin()) << ' ';		// 0
+			std::cout << (MySTL::mismatch(v1.begin(), v1.end(), v2.begin()).first - v1.begin()) << ' ';	// 77
+			std::cout << MySTL::lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end()) << ' ';	// 0
+			std::cout << MySTL::lexicographical_compare(v2.begin(), v2.end(), v1.begin(), v1.end()) << '\n';	// 1
+
+			// a prefix compares less; memcmp order would be wrong for signed and multi-byte elements
+			int p[] = { 1, 2 }, q[] = { 1, 2, 3 }, r[] = { 1, 256 };
+			std::cout << MySTL::lexicographical_compare(p, p + 2, q, q + 3) << ' '	// 1
+				<< MySTL::lexicographical_compare(q, q + 3, p, p + 2) << ' '		// 0
+				<< MySTL::lexicographical_compare(q, q + 3, r, r + 2) << ' '		// 1
+				<< MySTL::lexicographical_compare(p, p + 2, p, p + 2) << '\n';		// 0
+			signed char m[] = { -1 }, n[] = { 1 };
+			std::cout << MySTL::lexicographical_compare(m, m + 1, n, n + 1) << '\n';	// 1
+
+			// floating point takes the element-wise path: -0.0 == 0.0
+			double d1[] = { 0.0 }, d2[] = { -0.0 };
+			std::cout << MySTL::equal(d1, d1 + 1, d2) << '\n';						// 1
+		}
+
+		inline void tc_find_search()
+		{
+			std::cout << "-----\t find / search" << '\n';
+			const char text[] = "the quick brown fox jumps over the lazy dog";
+			const char *end = text + sizeof(text) - 1;
+			const char word[] = "lazy";
+			std::cout << (MySTL::find(text, end, 'q') - text) << ' '				// 4
+				<< (MySTL::find(text, end, 'Z') - text) << ' '						// 43
+				<< (MySTL::find(text, end, 1000) - text) << ' '						// 43
+				<< (MySTL::search(text, end, word, word + 4) - text) << ' '			// 35
+				<< (MySTL::search(text, end, word, word + 3) - text) << ' '			// 35
+				<< (MySTL::search(text, end, "dogs", "dogs" + 4) - text) << '\n';	// 43
+
+			MySTL::vector<int> v;
+			for (int i = 0; i != 1000; ++i)
+				v.push_back(i * 3);
+			int pattern[] = { 300, 303, 306 };
+			std::cout << (MySTL::find(v.begin(), v.end(), 2997) - v.begin()) << ' '	// 999
+				<< (MySTL::find(v.begin(), v.end(), 1) - v.begin()) << ' '				// 1000
+				<< (MySTL::search(v.begin(), v.end(), pattern, pattern + 3) - v.begin()) << '\n';	// 100
+
+			std::string strs[] = { "a", "b", "c" }, sub[] = { "b", "c" };
+			std::cout << (MySTL::find(strs, strs + 3, std::string("c")) - strs) << ' '	// 2
+				<< (MySTL::search(strs, strs + 3, sub, sub + 2) - strs) << '\n';		// 1
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test algorithm----------" << std::endl;
+			tc_contiguous_category();
+			tc_copy();
+			tc_fill();
+			tc_compare();
+			tc_find_search();
+			std::cout << "----------test algorithm success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
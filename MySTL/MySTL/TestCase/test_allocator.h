@@ -6,6 +6,7 @@
 #include <iostream>
 #include <ctime>
 #include <cstdlib>
+#include <type_traits>
 
 #include "../Declaration/allocator.h"
 
@@ -38,6 +39,35 @@ namespace MySTL
 			std::cout << vv.size() << std::endl;
 			std::cout << "----------test allocator success----------\n" << std::endl;
 		}
+
+		struct point { int x, y; };			// trivially destructible
+		struct tracked						// counts destructor calls
+		{
+			static int& destroyed() { static int n = 0; return n; }
+			~tracked() { ++destroyed(); }
+		};
+
+		inline void tc_destroy()
+		{
+			std::cout << "----------test allocator destroy----------" << std::endl;
+			std::cout << "point has trivial destructor: "
+				<< std::is_same<_type_traits<point>::has_trivial_destructor, _true_type>::value << '\n';	// 1
+			std::cout << "tracked has trivial destructor: "
+				<< std::is_same<_type_traits<tracked>::has_trivial_destructor, _true_type>::value << '\n';	// 0
+
+			const std::size_t n = 100;
+			tracked *p = MySTL::allocator<tracked>::allocate(n);
+			for (std::size_t i = 0; i != n; ++i)
+				MySTL::allocator<tracked>::construct(p + i);
+			MySTL::allocator<tracked>::destroy(p, p + n);
+			MySTL::allocator<tracked>::deallocate(p, n);
+			std::cout << "destructors run: " << tracked::destroyed() << '\n';	// 100
+
+			point *q = MySTL::allocator<point>::allocate(n);
+			MySTL::allocator<point>::destroy(q, q + n);	// nothing to run
+			MySTL::allocator<point>::deallocate(q, n);
+			std::cout << "----------test allocator destroy success----------\n" << std::endl;
+		}
 	}
 }
 #endif
\ No newline at end of file
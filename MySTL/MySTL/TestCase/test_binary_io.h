@@ -0,0 +1,227 @@
+#ifndef INCLUDED_TEST_BINARY_IO
+#define INCLUDED_TEST_BINARY_IO
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cstring>		// memcpy
+#include <cstddef>		// offsetof
+#include <cstdio>		// remove
+#include <stdexcept>
+
+#include "../Declaration/binary_io.h"
+#include "../Declaration/mapped_file.h"
+
+namespace MySTL
+{
+	namespace TestBinaryIO
+	{
+		struct point
+		{
+			int x;
+			double y;
+		};
+
+		// the bytes of a stream, in a buffer aligned like a mapping would be
+		inline MySTL::vector<std::uint64_t> aligned_copy(const std::string &bytes)
+		{
+			MySTL::vector<std::uint64_t> buffer(bytes.size() / sizeof(std::uint64_t) + 1, 0);
+			std::memcpy(buffer.begin(), bytes.data(), bytes.size());
+			return buffer;
+		}
+
+		inline void print_chars(const char *first, std::size_t n)
+		{
+			std::cout << '"';
+			std::cout.write(first, static_cast<std::streamsize>(n));
+			std::cout << '"';
+		}
+
+		inline void tc_round_trip()
+		{
+			std::cout << "-----\t save_binary / load_binary" << '\n';
+			std::stringstream ss;
+			MySTL::vector<int> ints;
+			for (int i = 0; i < 5; ++i)
+				ints.push_back(i * i);
+			MySTL::vector<point> points;
+			point p = { 3, 0.25 };
+			points.push_back(p);
+			MySTL::string s("zero copy");
+			MySTL::vector<MySTL::string> words;
+			words.push_back(MySTL::string("alpha"));
+			words.emplace_back();
+			words.push_back(MySTL::string("gamma"));
+			save_binary(ss, ints);
+			save_binary(ss, points);
+			save_binary(ss, s);
+			save_binary(ss, words);
+
+			MySTL::vector<int> ints2(2, 7);
+			MySTL::vector<point> points2;
+			MySTL::string s2("old contents");
+			MySTL::vector<MySTL::string> words2(4, MySTL::string("x"));
+			load_binary(ss, ints2);
+			load_binary(ss, points2);
+			load_binary(ss, s2);
+			load_binary(ss, words2);
+			std::cout << (ints2 == ints) << ' ' << points2.size() << ' ' << points2[0].x << ' ' << points2[0].y << '\n';	// 1 1 3 0.25
+			print_chars(s2.begin(), s2.size());
+			std::cout << ' ' << words2.size();
+			for (auto it = words2.begin(); it != words2.end(); ++it)
+			{
+				std::cout << ' ';
+				print_chars(it->begin(), it->size());
+			}
+			std::cout << '\n';							// "zero copy" 3 "alpha" "" "gamma"
+
+			MySTL::vector<int> empty, empty2(3, 1);
+			std::stringstream ss2;
+			save_binary(ss2, empty);
+			load_binary(ss2, empty2);
+			std::cout << empty2.size() << '\n';			// 0
+		}
+
+		inline void tc_views()
+		{
+			std::cout << "-----\t view_binary_*" << '\n';
+			std::stringstream ss;
+			MySTL::vector<double> values;
+			for (int i = 1; i <= 4; ++i)
+				values.push_back(i * 0.5);
+			save_binary(ss, values);
+			MySTL::vector<std::uint64_t> buffer = aligned_copy(ss.str());
+			span<const double> view = view_binary_array<double>(buffer.begin(), ss.str().size());
+			std::cout << view.size() << ' ' << view[0] << ' ' << view.back() << '\n';	// 4 0.5 2
+
+			std::stringstream ss2;
+			MySTL::vector<MySTL::string> words;
+			words.push_back(MySTL::string("mapped"));
+			words.push_back(MySTL::string("strings"));
+			save_binary(ss2, words);
+			buffer = aligned_copy(ss2.str());
+			string_table_view table = view_binary_string_table(buffer.begin(), ss2.str().size());
+			std::cout << table.size() << ' ';
+			print_chars(table[1].data(), table[1].size());
+			std::cout << '\n';							// 2 "strings"
+
+			// straight out of a mapped file
+			const char path[] = "binary_io_test.bin";
+			{
+				std::stringstream ss3;
+				save_binary(ss3, MySTL::string("from disk"));
+				const std::string bytes = ss3.str();
+				mapped_file file;
+				file.open(path, true);
+				file.resize(bytes.size());
+				std::memcpy(file.data(), bytes.data(), bytes.size());
+			}
+			{
+				mapped_file file;
+				file.open(path, false);
+				span<const char> chars = view_binary_string(file.data(), file.size());
+				print_chars(chars.data(), chars.size());
+				std::cout << '\n';						// "from disk"
+			}
+			std::remove(path);
+		}
+
+		inline void tc_mismatch()
+		{
+			std::cout << "-----\t header checks" << '\n';
+			std::stringstream ss;
+			MySTL::vector<int> ints(3, 1);
+			save_binary(ss, ints);
+			const std::string bytes = ss.str();
+			try
+			{
+				MySTL::vector<double> wrong;
+				std::stringstream in(bytes);
+				load_binary(in, wrong);
+				std::cout << "loaded\n";
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "element type mismatch rejected\n";	// element type mismatch rejected
+			}
+			try
+			{
+				MySTL::vector<std::uint64_t> buffer = aligned_copy(bytes);
+				view_binary_array<int>(buffer.begin(), bytes.size() - 1);
+				std::cout << "viewed\n";
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "short buffer rejected\n";	// short buffer rejected
+			}
+			try
+			{
+				MySTL::vector<int> truncated;
+				std::stringstream in(bytes.substr(0, bytes.size() - 2));
+				load_binary(in, truncated);
+				std::cout << "loaded\n";
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "truncated payload rejected\n";	// truncated payload rejected
+			}
+
+			// a count raised without the payload: the view would be sized past the buffer
+			try
+			{
+				std::string forged(bytes);
+				const std::uint64_t count = 4;
+				std::memcpy(&forged[offsetof(binary_header, count)], &count, sizeof(count));
+				MySTL::vector<std::uint64_t> buffer = aligned_copy(forged);
+				view_binary_array<int>(buffer.begin(), forged.size());
+				std::cout << "viewed\n";
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "forged count rejected\n";	// forged count rejected
+			}
+
+			// string offsets out of order, both for a view and a load
+			std::stringstream ss2;
+			MySTL::vector<MySTL::string> words(2, MySTL::string("abc"));
+			save_binary(ss2, words);
+			std::string table(ss2.str());
+			binary_header h;
+			std::memcpy(&h, table.data(), sizeof(h));
+			const std::uint64_t offset = 7;			// offsets 0 7 6: the second string would be -1 long
+			std::memcpy(&table[h.payload_offset() + sizeof(std::uint64_t)], &offset, sizeof(offset));
+			int rejected = 0;
+			try
+			{
+				MySTL::vector<std::uint64_t> buffer = aligned_copy(table);
+				view_binary_string_table(buffer.begin(), table.size());
+			}
+			catch (const std::runtime_error &)
+			{
+				++rejected;
+			}
+			try
+			{
+				MySTL::vector<MySTL::string> loaded;
+				std::stringstream in(table);
+				load_binary(in, loaded);
+			}
+			catch (const std::runtime_error &)
+			{
+				++rejected;
+			}
+			std::cout << rejected << " bad offset tables rejected\n";	// 2 bad offset tables rejected
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test binary_io----------" << std::endl;
+			tc_round_trip();
+			tc_views();
+			tc_mismatch();
+			std::cout << "----------test binary_io success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
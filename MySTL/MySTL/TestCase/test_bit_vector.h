@@ -0,0 +1,104 @@
+#ifndef INCLUDED_TEST_BIT_VECTOR
+#define INCLUDED_TEST_BIT_VECTOR
+
+#include <iostream>
+#include <utility>		// move
+#include <stdexcept>
+
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace TestBitVector
+	{
+		typedef MySTL::vector<bool> bits;
+
+		inline void print(const char *name, const bits &v)
+		{
+			std::cout << name << ": ";
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_vector_interface()
+		{
+			std::cout << "-----\t proxy references / iterators / modifiers" << '\n';
+			bits v = { true, false, true };
+			v.push_back(true);
+			v[1] = v[0];
+			v[2].flip();
+			print("v", v);								// v: 1101
+			std::cout << sizeof(bits::word_type) * 8 << ' ' << v.capacity() << ' ' << v.words()[0] << '\n';	// 64 64 11
+
+			for (int i = 0; i < 100; ++i)
+				v.push_back(i % 3 == 0);				// across the word boundary
+			std::cout << v.size() << ' ' << v.word_count() << ' ' << v[67] << v[68] << v.back() << '\n';	// 104 2 101
+			auto it = v.begin() + 70;
+			std::cout << *it << ' ' << it[-66] << ' ' << (v.end() - it) << ' ' << *(it - 3) << '\n';	// 1 1 34 1
+
+			v.erase(v.begin() + 1, v.begin() + 100);
+			print("erase", v);							// erase: 11001
+			v.insert(v.begin() + 2, 3, true);
+			print("insert", v);							// insert: 11111001
+			v.resize(70, true);
+			v.resize(9);
+			v.pop_back();
+			print("resize", v);							// resize: 11111001
+			std::cout << erase_if(v, [](bool b) { return b; }) << ' ' << v.size() << '\n';	// 6 2
+
+			bits a(130, true), b(a), c;
+			c = a;
+			c[129] = false;
+			std::cout << (a == b) << (a == c) << (a != c) << (c < a) << '\n';	// 1011
+			bits p(70), q(70), prefix(69);
+			q[65] = true;								// differs in the second word only
+			std::cout << (p < q) << (q > p) << (p <= p) << (q >= p) << (q < p) << (prefix < p) << (p <= prefix) << '\n';	// 1111010
+			bits moved(std::move(c));
+			std::cout << moved.size() << ' ' << c.size() << '\n';	// 130 0
+			try
+			{
+				moved.at(130);
+			}
+			catch (const std::out_of_range &)
+			{
+				std::cout << "out of range" << '\n';	// out of range
+			}
+		}
+
+		inline void tc_word_operations()
+		{
+			std::cout << "-----\t count / find / set / reset / bitwise" << '\n';
+			bits v(200);
+			std::cout << v.count() << ' ' << v.none() << ' ' << (v.find_first() == bits::npos) << '\n';	// 0 1 1
+			v.set(3, 5).set(60, 131);
+			std::cout << v.count() << ' ' << v.find_first() << ' ' << v.find_next(4) << ' ' << (v.find_next(130) == bits::npos) << '\n';	// 73 3 60 1
+			v.reset(62, 128);
+			std::cout << v.count() << ' ' << v.find_next(61) << '\n';	// 7 128
+			v.flip();
+			std::cout << v.count() << ' ' << v.test(199) << ' ' << v.test(3) << '\n';	// 193 1 0
+			v.reset().set(199, 200);
+			std::cout << v.count() << ' ' << v.find_first() << ' ' << (v.find_next(199) == bits::npos) << '\n';	// 1 199 1
+
+			bits x(150), y(150);
+			for (int i = 0; i < 150; ++i)
+			{
+				x[i] = i % 2 == 0;
+				y[i] = i % 3 == 0;
+			}
+			std::cout << (x & y).count() << ' ' << (x | y).count() << ' ' << (x ^ y).count() << '\n';	// 25 100 75
+			x ^= x;
+			std::cout << x.none() << ' ' << (x.set() == bits(150, true)) << '\n';	// 1 1
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test vector<bool>----------" << std::endl;
+			tc_vector_interface();
+			tc_word_operations();
+			std::cout << "----------test vector<bool> success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef INCLUDED_TEST_COMPRESSED_INT_VECTOR
+#define INCLUDED_TEST_COMPRESSED_INT_VECTOR
+
+#include <iostream>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../Declaration/compressed_int_vector.h"
+
+namespace MySTL
+{
+	namespace TestCompressedIntVector
+	{
+		// the decoded values against the source, through every access path
+		template <typename T>
+		inline bool same(const MySTL::compressed_int_vector<T> &c, MySTL::vector<T> &v)
+		{
+			if (c.size() != v.size())
+				return false;
+			bool ok = true;
+			std::size_t i = 0;
+			for (auto it = c.begin(); it != c.end(); ++it, ++i)
+				ok = ok && *it == v[i];
+			i = 0;
+			c.for_each([&](T x) { ok = ok && x == v[i++]; });
+			MySTL::vector<T> out(c.size());
+			c.decode(out.begin());
+			for (i = 0; i < v.size(); i += 7)
+				ok = ok && c[i] == v[i];
+			return ok && out == v;
+		}
+
+		inline void tc_sorted_ids()
+		{
+			std::cout << "-----\t sorted ids: delta blocks, outliers" << '\n';
+			MySTL::vector<std::uint32_t> ids;
+			std::uint32_t id = 1000, x = 2463534242u;
+			for (int i = 0; i < 10000; ++i)
+			{
+				x ^= x << 13; x ^= x >> 17; x ^= x << 5;	// xorshift
+				id += x % 16;
+				if (i % 1000 == 999)
+					id += 1u << 24;							// an outlier gap now and then
+				ids.push_back(id);
+			}
+			MySTL::compressed_int_vector<std::uint32_t> c(ids.begin(), ids.end());
+			std::cout << same(c, ids) << ' ' << c.size() << ' ' << c.block_count() << '\n';	// 1 10000 79
+			c.shrink_to_fit();
+			std::cout << (c.memory_bytes() * 5 < ids.size() * sizeof(std::uint32_t)) << '\n';	// 1
+			std::cout << (c.lower_bound(ids[5000]) == 5000) << ' ' << (c.lower_bound(ids[9999] + 1) == c.size())
+				<< ' ' << c.lower_bound(0) << ' ' << (c.lower_bound(ids[127] + 1) == 128) << '\n';	// 1 1 0 1
+			std::cout << c.front() << ' ' << (c.back() == ids.back()) << '\n';	// 1003 1
+			try
+			{
+				c.at(c.size());
+			}
+			catch (const std::out_of_range &)
+			{
+				std::cout << "out of range" << '\n';	// out of range
+			}
+		}
+
+		// runs of one value across block boundaries: lower_bound is the first of the run
+		inline void tc_duplicates()
+		{
+			std::cout << "-----\t duplicates across blocks" << '\n';
+			MySTL::vector<std::uint32_t> v;
+			for (std::uint32_t i = 0; i < 120; ++i)
+				v.push_back(i);
+			for (int i = 0; i < 300; ++i)
+				v.push_back(1000);							// 120..419, over blocks 0 to 3
+			for (int i = 0; i < 256; ++i)
+				v.push_back(2000);							// 420..675, starts block 4 at 512
+			MySTL::compressed_int_vector<std::uint32_t> c(v.begin(), v.end());
+			std::cout << same(c, v) << ' ' << c.lower_bound(999) << ' ' << c.lower_bound(1000) << ' ' << c.lower_bound(1001) << '\n';	// 1 120 120 420
+			std::cout << c.lower_bound(2000) << ' ' << c.lower_bound(2001) << ' ' << c.lower_bound(119) << '\n';	// 420 676 119
+		}
+
+		inline void tc_other_blocks()
+		{
+			std::cout << "-----\t unsorted / incompressible / 64-bit" << '\n';
+			MySTL::vector<std::uint32_t> frames, noise;
+			MySTL::vector<std::uint64_t> wide;
+			std::uint64_t x = 88172645463325252ULL;
+			for (int i = 0; i < 1000; ++i)
+			{
+				x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+				frames.push_back(static_cast<std::uint32_t>(7000000 + x % 300));	// frame of reference
+				noise.push_back(static_cast<std::uint32_t>(x));						// raw blocks
+				wide.push_back((std::uint64_t(1) << 40) + i * 3 + (i == 500 ? (std::uint64_t(1) << 50) : 0));
+			}
+			MySTL::compressed_int_vector<std::uint32_t> f(frames.begin(), frames.end()), n(noise.begin(), noise.end());
+			MySTL::compressed_int_vector<std::uint64_t> w(wide.begin(), wide.end());
+			std::cout << same(f, frames) << same(n, noise) << same(w, wide) << '\n';	// 111
+			f.shrink_to_fit();
+			n.shrink_to_fit();
+			w.shrink_to_fit();
+			std::cout << (f.memory_bytes() * 2 < 1000 * 4) << ' ' << (n.memory_bytes() > 1000 * 4) << ' ' << (w.memory_bytes() * 3 < 1000 * 8) << '\n';	// 1 1 1
+
+			MySTL::compressed_int_vector<std::uint32_t> c;
+			std::cout << c.empty() << ' ' << (c.begin() == c.end()) << ' ' << c.lower_bound(5) << '\n';	// 1 1 0
+			for (std::uint32_t i = 0; i < 200; ++i)
+				c.push_back(42);							// width 0 blocks
+			c.swap(f);
+			std::cout << f.size() << ' ' << f[150] << ' ' << f.block_count() << ' ' << c.size() << '\n';	// 200 42 2 1000
+			f.clear();
+			std::cout << f.size() << ' ' << f.block_count() << '\n';	// 0 0
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test compressed_int_vector----------" << std::endl;
+			tc_sorted_ids();
+			tc_duplicates();
+			tc_other_blocks();
+			std::cout << "----------test compressed_int_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
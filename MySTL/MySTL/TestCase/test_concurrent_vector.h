@@ -0,0 +1,130 @@
+#ifndef INCLUDED_TEST_CONCURRENT_VECTOR
+#define INCLUDED_TEST_CONCURRENT_VECTOR
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <algorithm>	// std::sort
+#include <stdexcept>
+
+#include "../Declaration/concurrent_vector.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace TestConcurrentVector
+	{
+		// an element a reader can check: torn or unconstructed slots fail check()
+		struct stamped
+		{
+			std::size_t value, inverse;
+			stamped(std::size_t v = 0) : value(v), inverse(~v) {}
+			bool check() const { return inverse == ~value; }
+		};
+
+		// throws when asked to build a negative number
+		struct picky
+		{
+			int x;
+			picky(int x) : x(x) { if (x < 0) throw std::invalid_argument("picky"); }
+		};
+
+		inline void tc_single_thread()
+		{
+			std::cout << "-----\t push_back / grow_by / iterate" << '\n';
+			MySTL::concurrent_vector<std::string, 4> v;
+			v.push_back("a");
+			v.emplace_back(2, 'b');
+			const std::string src[] = { "c", "d", "e" };
+			std::cout << v.grow_by(src, src + 3) << ' ' << v.grow_by(3, "f") << ' ' << v.grow_by(2) << '\n';	// 2 5 8
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << '[' << *it << ']';
+			std::cout << '\n';									// [a][bb][c][d][e][f][f][f][][]
+			std::cout << v.size() << ' ' << v.capacity() << ' ' << v.at(6) << '\n';	// 10 12 f
+			v.clear();
+			std::cout << v.size() << ' ' << v.empty() << ' ' << v.capacity() << '\n';	// 0 1 12
+
+			MySTL::concurrent_vector<picky> p;
+			p.push_back(1);
+			try
+			{
+				p.emplace_back(-1);				// the slot is claimed, then the constructor throws
+			}
+			catch (const std::invalid_argument &)
+			{
+				std::cout << "throw" << '\n';					// throw
+			}
+			p.push_back(3);
+			std::cout << p.grow_by(2, picky(4)) << '\n';					// 3
+			std::cout << p.size() << ' ' << p.claimed_size() << ' ' << p.pending_size() << '\n';	// 1 5 4
+			for (std::size_t i = p.size(); i != p.claimed_size(); ++i)	// the pushes behind the hole are still there
+				if (p.is_ready(i))
+					std::cout << '[' << p[i].x << ']';
+				else
+					std::cout << "[hole]";
+			std::cout << '\n';									// [hole][3][4][4]
+		}
+
+		inline void tc_threads()
+		{
+			std::cout << "-----\t 8 writers, 1 reader" << '\n';
+			const std::size_t writers = 8, per_writer = 20000;
+			MySTL::concurrent_vector<stamped> v;
+			std::atomic<bool> done(false);
+			std::atomic<std::size_t> bad(0), scans(0);
+
+			// the reader walks the published prefix over and over while it grows
+			std::thread reader([&]()
+			{
+				while (!done.load())
+				{
+					for (auto it = v.begin(), last = v.end(); it != last; ++it)
+						if (!it->check())
+							++bad;
+					++scans;
+				}
+			});
+			MySTL::vector<std::thread> threads;
+			threads.reserve(writers);	// no allocation while the writers run
+			for (std::size_t t = 0; t < writers; ++t)
+				threads.push_back(std::thread([&v, t, per_writer]()
+				{
+					// half single pushes, half batches of 10
+					for (std::size_t i = 0; i < per_writer / 2; ++i)
+						v.push_back(stamped(t * per_writer + i));
+					for (std::size_t i = per_writer / 2; i < per_writer; i += 10)
+					{
+						stamped batch[10];	// not a MySTL::vector: the pool allocator is not thread-safe
+						for (std::size_t k = 0; k < 10; ++k)
+							batch[k] = stamped(t * per_writer + i + k);
+						v.grow_by(batch, batch + 10);
+					}
+				}));
+			for (auto it = threads.begin(); it != threads.end(); ++it)
+				it->join();
+			done = true;
+			reader.join();
+
+			// every value exactly once
+			MySTL::vector<std::size_t> values;
+			for (auto it = v.begin(); it != v.end(); ++it)
+				values.push_back(it->value);
+			std::sort(values.begin(), values.end());
+			bool all = values.size() == writers * per_writer;
+			for (std::size_t i = 0; all && i < values.size(); ++i)
+				all = values[i] == i;
+			std::cout << v.size() << ' ' << all << ' ' << bad.load() << ' ' << (scans.load() > 0) << '\n';	// 160000 1 0 1
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test concurrent_vector----------" << std::endl;
+			tc_single_thread();
+			tc_threads();
+			std::cout << "----------test concurrent_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef INCLUDED_TEST_COW_VECTOR
+#define INCLUDED_TEST_COW_VECTOR
+
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "../Declaration/cow_vector.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace TestCowVector
+	{
+		template <typename Vector>
+		inline void print(const char *name, const Vector &v)
+		{
+			std::cout << name << ':';
+			for (auto it = v.cbegin(); it != v.cend(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_sharing()
+		{
+			std::cout << "-----\t sharing" << '\n';
+			MySTL::cow_vector<int> a = { 1, 2, 3 };
+			MySTL::cow_vector<int> b(a), c;
+			c = b;
+			std::cout << a.use_count() << ' ' << (a.cbegin() == c.cbegin()) << ' ' << (a == c) << '\n';	// 3 1 1
+
+			// const access reads the shared buffer, non-const access makes it private
+			const MySTL::cow_vector<int> &cb = b;
+			std::cout << cb[1] << ' ' << cb.back() << ' ' << b.use_count() << '\n';	// 2 3 3
+			b[1] = 20;
+			std::cout << a.use_count() << ' ' << b.use_count() << ' ' << (a.cbegin() == b.cbegin()) << '\n';	// 2 1 0
+			c.push_back(4);
+			print("a", a);	// a: 1 2 3
+			print("b", b);	// b: 1 20 3
+			print("c", c);	// c: 1 2 3 4
+			std::cout << a.unique() << ' ' << (a != b) << ' ' << (a < b) << '\n';	// 1 1 1
+
+			// a private buffer is written in place
+			const int *before = b.cbegin();
+			b[0] = 10;
+			std::cout << (b.cbegin() == before) << '\n';	// 1
+		}
+
+		inline void tc_modifiers()
+		{
+			std::cout << "-----\t modifiers" << '\n';
+			MySTL::vector<std::string> words;
+			words.push_back("x");
+			words.push_back("y");
+			MySTL::cow_vector<std::string> v(words);
+			MySTL::cow_vector<std::string> snap(v);
+			v.insert(v.cbegin() + 1, "m");
+			v.insert(v.cend(), v.front());	// an element of the vector itself
+			v.emplace_back(2, 'z');
+			print("v", v);	// v: x m y x zz
+			v.erase(v.cbegin());
+			v.pop_back();
+			print("v", v);	// v: m y x
+			print("snap", snap);	// snap: x y
+
+			MySTL::cow_vector<std::string> w(snap);
+			w.resize(4, "r");
+			print("w", w);	// w: x y r r
+			w.resize(1);
+			std::cout << w.size() << ' ' << snap.size() << ' ' << snap.use_count() << '\n';	// 1 2 1
+
+			// clearing a shared buffer lets it go without copying it
+			w = snap;
+			w.clear();
+			std::cout << w.empty() << ' ' << w.capacity() << ' ' << snap.use_count() << ' ' << snap.size() << '\n';	// 1 0 1 2
+
+			MySTL::cow_vector<int> n(3, 7), m(2, 5);
+			n.swap(m);
+			print("n", n);	// n: 5 5
+			try
+			{
+				n.at(2);
+			}
+			catch (const std::out_of_range &)
+			{
+				std::cout << "out of range" << '\n';	// out of range
+			}
+		}
+
+		// a publisher swaps in new versions while readers snapshot the current one, check it is
+		// consistent (every element equal), then change their own copy
+		inline void tc_threads()
+		{
+			std::cout << "-----\t threads" << '\n';
+			MySTL::cow_vector<int> current(1000, 0);
+			std::mutex current_mutex;		// guards the object current, not the buffer
+			std::atomic<bool> stop(false);
+			std::atomic<int> torn(0);
+
+			auto reader = [&]() {
+				while (!stop.load())
+				{
+					MySTL::cow_vector<int> snap;
+					{
+						std::lock_guard<std::mutex> lock(current_mutex);
+						snap = current;		// O(1)
+					}
+					const MySTL::cow_vector<int> &view = snap;
+					for (std::size_t i = 0; i != view.size(); ++i)
+						if (view[i] != view[0])
+							++torn;
+					MySTL::cow_vector<int> mine(snap);
+					mine[0] = -1;
+					mine.push_back(-1);
+					if (view[0] == -1 || view.size() != 1000)
+						++torn;
+				}
+			};
+			std::thread readers[3] = { std::thread(reader), std::thread(reader), std::thread(reader) };
+			for (int version = 1; version <= 200; ++version)
+			{
+				MySTL::cow_vector<int> next;
+				{
+					std::lock_guard<std::mutex> lock(current_mutex);
+					next = current;
+				}
+				for (auto it = next.begin(); it != next.end(); ++it)	// copies: the readers may hold it
+					*it = version;
+				std::lock_guard<std::mutex> lock(current_mutex);
+				current = std::move(next);
+			}
+			stop = true;
+			for (int i = 0; i != 3; ++i)
+				readers[i].join();
+			std::cout << torn.load() << ' ' << current[999] << ' ' << current.use_count() << '\n';	// 0 200 1
+
+			// many threads copying one vector at once, as with shared_ptr
+			const MySTL::cow_vector<int> base(current);
+			auto copier = [&base]() {
+				for (int i = 0; i != 20000; ++i)
+				{
+					MySTL::cow_vector<int> copy(base);
+					MySTL::cow_vector<int> again(copy);
+				}
+			};
+			std::thread copiers[4] = { std::thread(copier), std::thread(copier), std::thread(copier), std::thread(copier) };
+			for (int i = 0; i != 4; ++i)
+				copiers[i].join();
+			std::cout << base.use_count() << '\n';	// 2
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test cow_vector----------" << std::endl;
+			tc_sharing();
+			tc_modifiers();
+			tc_threads();
+			std::cout << "----------test cow_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef INCLUDED_TEST_FLAT_MAP
+#define INCLUDED_TEST_FLAT_MAP
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>	// is_const, remove_pointer
+
+#include "../Declaration/flat_map.h"
+#include "../Declaration/flat_set.h"
+
+namespace MySTL
+{
+	namespace TestFlatMap
+	{
+		template <typename Map>
+		inline void print_map(const char *name, const Map &m)
+		{
+			std::cout << name << ':';
+			for (auto it = m.begin(); it != m.end(); ++it)
+				std::cout << ' ' << it->first << '=' << it->second;
+			std::cout << '\n';
+		}
+
+		template <typename Set>
+		inline void print_set(const char *name, const Set &s)
+		{
+			std::cout << name << ':';
+			for (auto it = s.begin(); it != s.end(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		// counts the mapped values operator[] builds
+		struct built
+		{
+			static int& count() { static int n = 0; return n; }
+			int value;
+			built() : value(0) { ++count(); }
+		};
+
+		inline void tc_flat_map()
+		{
+			std::cout << "-----\t flat_map" << '\n';
+			typedef std::pair<int, std::string> entry;
+			const entry input[] = { entry(5, "e"), entry(1, "a"), entry(3, "c"), entry(1, "a"), entry(4, "d"), entry(3, "c") };
+			MySTL::flat_map<int, std::string> m(input, input + 6);
+			std::cout << m.size() << ' ' << m.count(3) << ' ' << m.count(2) << ' ' << (m.find(6) == m.end()) << '\n';	// 4 1 0 1
+			std::cout << m.lower_bound(2)->first << ' ' << m.upper_bound(4)->first << ' ' << (m.upper_bound(5) == m.end()) << '\n';	// 3 5 1
+
+			// batched insert: 1 and 5 exist already and keep their values
+			const entry more[] = { entry(9, "i"), entry(0, "z"), entry(5, "q"), entry(2, "b"), entry(1, "q"), entry(2, "w") };
+			m.insert(more, more + 6);
+			std::cout << m.size() << ' ' << m.at(5) << ' ' << m.at(0) << ' ' << m.at(9) << '\n';	// 7 e z i
+			m[7] = "g";
+			m[3] += "!";
+			std::cout << m.insert(entry(4, "?")).second << ' ' << m.insert_or_assign(4, "D").second << ' ' << m.erase(2) << ' ' << m.erase(2) << '\n';	// 0 0 1 0
+			m.erase(m.begin());
+			print_map("map", m);	// map: 1=a 3=c! 4=D 5=e 7=g 9=i
+			try
+			{
+				m.at(2);
+			}
+			catch (const std::out_of_range &)
+			{
+				std::cout << "out of range" << '\n';	// out of range
+			}
+			const entry sorted[] = { entry(1, "a"), entry(3, "c!"), entry(4, "D"), entry(5, "e"), entry(7, "g"), entry(9, "i") };
+			std::cout << (m == MySTL::flat_map<int, std::string>(MySTL::sorted_unique, sorted, sorted + 6)) << '\n';	// 1
+
+			// operator[] on a key that is present builds no mapped value
+			MySTL::flat_map<int, built> counts;
+			for (int i = 0; i < 10; ++i)
+				++counts[i % 3].value;
+			std::cout << built::count() << ' ' << counts[0].value << ' ' << counts[2].value << '\n';	// 3 4 3
+		}
+
+		inline void tc_heterogeneous()
+		{
+			std::cout << "-----\t heterogeneous lookup" << '\n';
+			MySTL::flat_map<std::string, int, MySTL::transparent_less> m = { { "pear", 3 }, { "apple", 1 }, { "fig", 2 } };
+			const char *key = "fig";	// no std::string is built for the lookups
+			std::cout << m.find(key)->second << ' ' << m.contains("kiwi") << ' ' << m.count("pear") << ' ' << m.lower_bound("b")->first << '\n';	// 2 0 1 fig
+		}
+
+		inline void tc_flat_set()
+		{
+			std::cout << "-----\t flat_set" << '\n';
+			MySTL::flat_set<int> s = { 8, 3, 5, 3, 1, 8 };
+			print_set("set", s);	// set: 1 3 5 8
+			const int more[] = { 9, 0, 5, 4 };
+			s.insert(more, more + 4);
+			std::cout << s.insert(4).second << ' ' << *s.insert(2).first << ' ' << *s.lower_bound(6) << '\n';	// 0 2 8
+			s.erase(s.find(5));
+			print_set("set", s);	// set: 0 1 2 3 4 8 9
+			std::cout << std::is_const<std::remove_pointer<MySTL::flat_set<int>::iterator>::type>::value
+				<< !std::is_const<std::remove_pointer<MySTL::flat_map<int, int>::iterator>::type>::value << '\n';	// 11
+
+			// a merge that interleaves the whole range
+			MySTL::flat_set<int> evens, odds;
+			for (int i = 0; i < 1000; i += 2)
+				evens.insert(i);
+			MySTL::vector<int> v;
+			for (int i = 999; i > 0; i -= 2)
+				v.push_back(i);
+			evens.insert(v.begin(), v.end());
+			bool ok = evens.size() == 1000;
+			int expect = 0;
+			for (auto it = evens.begin(); it != evens.end(); ++it)
+				ok = ok && *it == expect++;
+			std::cout << ok << '\n';	// 1
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test flat_map----------" << std::endl;
+			tc_flat_map();
+			tc_heterogeneous();
+			tc_flat_set();
+			std::cout << "----------test flat_map success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
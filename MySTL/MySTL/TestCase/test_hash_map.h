@@ -0,0 +1,145 @@
+#ifndef INCLUDED_TEST_HASH_MAP
+#define INCLUDED_TEST_HASH_MAP
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>	// std::sort
+
+#include "../Declaration/hash_map.h"
+#include "../Declaration/hash_set.h"
+#include "../Declaration/string.h"
+#include "../Declaration/span.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace TestHashMap
+	{
+		// the keys in order, the table has none
+		template <typename Set>
+		inline void print_sorted(const char *name, const Set &s)
+		{
+			MySTL::vector<typename Set::value_type> keys;
+			for (auto it = s.begin(); it != s.end(); ++it)
+				keys.push_back(*it);
+			std::sort(keys.begin(), keys.end());
+			std::cout << name << ':';
+			for (auto it = keys.begin(); it != keys.end(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_hash_map()
+		{
+			std::cout << "-----\t hash_map" << '\n';
+			typedef std::pair<int, std::string> entry;
+			const entry input[] = { entry(5, "e"), entry(1, "a"), entry(3, "c"), entry(1, "x"), entry(4, "d") };
+			MySTL::hash_map<int, std::string> m(input, input + 5);
+			std::cout << m.size() << ' ' << m.at(1) << ' ' << m.count(3) << ' ' << m.count(2) << ' ' << (m.find(6) == m.end()) << '\n';	// 4 a 1 0 1
+			m[7] = "g";
+			m[3] += "!";
+			std::cout << m.insert(entry(4, "?")).second << ' ' << m.insert_or_assign(4, "D").second << ' ' << m.try_emplace(4, "??").second
+				<< ' ' << m.erase(5) << ' ' << m.erase(5) << '\n';	// 0 0 0 1 0
+			m.erase(m.find(1));
+			std::cout << m.size() << ' ' << m.at(3) << ' ' << m.at(4) << ' ' << m.at(7) << '\n';	// 3 c! D g
+			try
+			{
+				m.at(2);
+			}
+			catch (const std::out_of_range &)
+			{
+				std::cout << "out of range" << '\n';	// out of range
+			}
+			MySTL::hash_map<int, std::string> copy(m);
+			copy[4] = "d";
+			std::cout << (copy == m) << ' ' << (copy != m) << '\n';	// 0 1
+			copy[4] = "D";
+			std::cout << (copy == m) << '\n';	// 1
+		}
+
+		inline void tc_heterogeneous()
+		{
+			std::cout << "-----\t heterogeneous lookup" << '\n';
+			MySTL::hash_map<MySTL::string, int> m = { { MySTL::string("pear"), 3 }, { MySTL::string("apple"), 1 }, { MySTL::string("fig"), 2 } };
+			const char *key = "fig";	// no string is built for the lookups
+			const char buffer[] = "kiwi,pear";
+			MySTL::span<const char> pear(buffer + 5, 4);
+			std::cout << m.find(key)->second << ' ' << m.contains("kiwi") << ' ' << m.count(MySTL::span<const char>(buffer, 4))
+				<< ' ' << m.find(pear)->second << '\n';	// 2 0 0 3
+			std::cout << m.erase("apple") << ' ' << m.size() << '\n';	// 1 2
+
+			MySTL::hash_map<std::string, int> s = { { "one", 1 } };
+			std::cout << s.find("one")->second << ' ' << (MySTL::hash<std::string>()("one") == MySTL::hash<MySTL::string>()(MySTL::string("one"))) << '\n';	// 1 1
+		}
+
+		inline void tc_hash_policy()
+		{
+			std::cout << "-----\t hash policy" << '\n';
+			MySTL::hash_set<int> s;
+			std::cout << s.bucket_count() << ' ' << (s.begin() == s.end()) << ' ' << s.contains(0) << '\n';	// 0 1 0
+			s.reserve(100);
+			const std::size_t buckets = s.bucket_count();
+			for (int i = 0; i < 100; ++i)
+				s.insert(i);
+			std::cout << buckets << ' ' << (s.bucket_count() == buckets) << ' ' << (s.load_factor() <= s.max_load_factor()) << '\n';	// 127 1 1
+
+			// churn through tombstones: the size stays about the same, the table must not grow
+			bool ok = true;
+			for (int i = 100; i < 100000; ++i)
+			{
+				s.erase(i - 100);
+				s.insert(i);
+				ok = ok && s.size() == 100 && s.contains(i) && !s.contains(i - 100);
+			}
+			std::cout << ok << ' ' << s.bucket_count() << '\n';	// 1 127
+
+			s.rehash(1000);
+			std::cout << s.bucket_count() << ' ' << s.size() << ' ' << s.contains(99999) << '\n';	// 1023 100 1
+			s.clear();
+			s.rehash(0);
+			std::cout << s.bucket_count() << ' ' << s.empty() << '\n';	// 0 1
+		}
+
+		inline void tc_hash_set()
+		{
+			std::cout << "-----\t hash_set" << '\n';
+			MySTL::hash_set<int> s = { 8, 3, 5, 3, 1, 8 };
+			print_sorted("set", s);	// set: 1 3 5 8
+			const int more[] = { 9, 0, 5, 4 };
+			s.insert(more, more + 4);
+			std::cout << s.insert(4).second << ' ' << *s.insert(2).first << ' ' << s.size() << '\n';	// 0 2 8
+			s.erase(s.find(5));
+			print_sorted("set", s);	// set: 0 1 2 3 4 8 9
+
+			// many keys, half erased, erase while iterating
+			MySTL::hash_set<unsigned> big;
+			for (unsigned i = 0; i < 50000; ++i)
+				big.insert(i * 2654435761u);
+			for (auto it = big.begin(); it != big.end(); )
+				it = (*it & 1) ? big.erase(it) : ++it;
+			bool ok = true;
+			std::size_t n = 0;
+			for (unsigned i = 0; i < 50000; ++i)
+			{
+				const unsigned k = i * 2654435761u;
+				ok = ok && big.contains(k) == !(k & 1);
+				n += !(k & 1);
+			}
+			std::cout << ok << ' ' << (big.size() == n) << '\n';	// 1 1
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test hash_map----------" << std::endl;
+			tc_hash_map();
+			tc_heterogeneous();
+			tc_hash_policy();
+			tc_hash_set();
+			std::cout << "----------test hash_map success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
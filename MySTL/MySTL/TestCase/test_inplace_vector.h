@@ -0,0 +1,116 @@
+#ifndef INCLUDED_TEST_INPLACE_VECTOR
+#define INCLUDED_TEST_INPLACE_VECTOR
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <new>			// bad_alloc
+#include <type_traits>	// is_trivially_copyable
+
+#include "../Declaration/inplace_vector.h"
+
+namespace MySTL
+{
+	namespace TestInplaceVector
+	{
+		template <typename InplaceVector>
+		inline void print(const char *name, const InplaceVector &v)
+		{
+			std::cout << name << ':';
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_fixed_capacity()
+		{
+			std::cout << "-----\t fixed capacity / try_push_back" << '\n';
+			MySTL::inplace_vector<int, 4> v;
+			for (int i = 0; i < 4; ++i)
+				v.push_back(i);
+			print("4 elements", v);								// 4 elements: 0 1 2 3
+			std::cout << v.full() << ' ' << (v.try_push_back(4) == nullptr) << ' ' << v.size() << '\n';	// 1 1 4
+			try
+			{
+				v.push_back(4);
+			}
+			catch (const std::bad_alloc &)
+			{
+				std::cout << "bad_alloc" << '\n';				// bad_alloc
+			}
+			try
+			{
+				v.insert(v.begin(), 2, 7);
+			}
+			catch (const std::bad_alloc &)
+			{
+				print("insert past N", v);						// insert past N: 0 1 2 3
+			}
+
+			v.erase(v.begin() + 1, v.begin() + 3);
+			std::cout << *v.try_push_back(5) << ' ' << v.try_emplace_back(6) - v.data() << '\n';	// 5 3
+			print("erase / try", v);							// erase / try: 0 3 5 6
+			v.pop_back();
+			v.insert(v.begin() + 1, v[2]);						// the value is one of the elements
+			print("insert", v);									// insert: 0 5 3 5
+			v.resize(1);
+			v.insert(v.end(), { 8, 9 });
+			v.resize(4, 1);
+			print("resize", v);									// resize: 0 8 9 1
+			std::cout << v.capacity() << ' ' << MySTL::inplace_vector<int, 4>::max_size() << '\n';	// 4 4
+		}
+
+		inline void tc_copy_and_move()
+		{
+			std::cout << "-----\t copy / move / swap" << '\n';
+			std::cout << std::is_trivially_copyable<MySTL::inplace_vector<int, 8> >::value << ' '
+				<< std::is_trivially_copyable<MySTL::inplace_vector<std::string, 8> >::value << ' '
+				<< (sizeof(MySTL::inplace_vector<char, 15>) == 16) << '\n';	// 1 0 1
+
+			MySTL::inplace_vector<std::string, 3> a = { "a", "b", "c" };
+			MySTL::inplace_vector<std::string, 3> b(a);
+			MySTL::inplace_vector<std::string, 3> c(std::move(a));
+			print("copy", b);									// copy: a b c
+			print("move", c);									// move: a b c
+			std::cout << "source: " << a.size() << '\n';		// source: 0
+
+			a = { "x" };
+			b = a;
+			c = std::move(a);
+			print("assigned", b);								// assigned: x
+			b.emplace_back("y");
+			b.emplace(b.begin(), "w");
+			c.swap(b);
+			print("swap", c);									// swap: w x y
+			print("swap", b);									// swap: x
+			std::cout << (b < c) << ' ' << (b == MySTL::inplace_vector<std::string, 3>(1, "x")) << '\n';	// 0 1
+
+			MySTL::inplace_vector<int, 3> t = { 1, 2 }, u;
+			u = t;												// trivially copyable: the implicit copy
+			t[0] = 5;
+			print("trivial copy", u);							// trivial copy: 1 2
+		}
+
+		inline void tc_empty_insert()
+		{
+			std::cout << "-----\t empty insert" << '\n';
+			MySTL::inplace_vector<std::string, 8> v = { "a", "b", "c" };
+			const std::string none[1] = { "z" };
+			v.insert(v.begin(), none, none);					// empty range: the tail must stay put
+			v.insert(v.begin() + 1, 0, std::string("y"));
+			print("after", v);									// after: a b c
+			std::cout << v.size() << '\n';						// 3
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test inplace_vector----------" << std::endl;
+			tc_fixed_capacity();
+			tc_copy_and_move();
+			tc_empty_insert();
+			std::cout << "----------test inplace_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef INCLUDED_TEST_MMAP_VECTOR
+#define INCLUDED_TEST_MMAP_VECTOR
+
+#include <iostream>
+#include <cstdio>		// remove, fopen
+#include <cstdint>
+#include <stdexcept>
+
+#include "../Declaration/mmap_vector.h"
+
+namespace MySTL
+{
+	namespace TestMmapVector
+	{
+		const char test_file[] = "mmap_vector_test.bin";
+
+		struct sample
+		{
+			int id;
+			double value;
+		};
+
+		template <typename MmapVector>
+		inline void print(const char *name, const MmapVector &v)
+		{
+			std::cout << name << ':';
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_grow_and_modify()
+		{
+			std::cout << "-----\t push_back / insert / erase / resize" << '\n';
+			MySTL::mmap_vector<int> v(test_file, MySTL::mmap_vector<int>::truncate);
+			for (int i = 0; i < 10000; ++i)
+				v.push_back(i);
+			std::cout << v.size() << ' ' << (v.capacity() >= 10000) << ' ' << v[9999] << '\n';	// 10000 1 9999
+			v.erase(v.begin() + 3, v.end());
+			v.insert(v.begin() + 1, 42);
+			v.emplace_back(7);
+			print("elements", v);						// elements: 0 42 1 2 7
+			v.resize(7, -1);
+			v.shrink_to_fit();
+			print("resized", v);						// resized: 0 42 1 2 7 -1 -1
+			std::cout << v.capacity() << '\n';			// 7
+		}
+
+		inline void tc_persistence()
+		{
+			std::cout << "-----\t reopen / flush / advise" << '\n';
+			{
+				MySTL::mmap_vector<int> v(test_file);	// the elements of tc_grow_and_modify
+				print("reopened", v);					// reopened: 0 42 1 2 7 -1 -1
+				v.pop_back();
+				v.advise(MySTL::mapped_file::sequential);
+				v.flush();
+			}
+			MySTL::mmap_vector<int> v(test_file);
+			std::cout << v.size() << ' ' << v.back() << '\n';	// 6 -1
+
+			try
+			{
+				v.close();
+				MySTL::mmap_vector<sample> wrong(test_file);	// the file holds ints
+				std::cout << "opened\n";
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "element size mismatch rejected\n";	// element size mismatch rejected
+			}
+
+			MySTL::mmap_vector<sample> s(test_file, MySTL::mmap_vector<sample>::truncate);
+			sample x = { 1, 0.5 };
+			s.push_back(x);
+			MySTL::mmap_vector<sample> moved(std::move(s));
+			std::cout << moved.size() << ' ' << moved[0].value << ' ' << s.is_open() << '\n';	// 1 0.5 0
+			moved.close();
+
+			// a header that claims more elements than the file holds
+			const std::uint64_t forged = 1000000;
+			std::FILE *f = std::fopen(test_file, "r+b");
+			std::fseek(f, 2 * sizeof(std::uint64_t), SEEK_SET);	// magic, element size, size
+			std::fwrite(&forged, sizeof(forged), 1, f);
+			std::fclose(f);
+			try
+			{
+				MySTL::mmap_vector<sample> truncated(test_file);
+				std::cout << "opened\n";
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "size beyond the file rejected\n";	// size beyond the file rejected
+			}
+			std::remove(test_file);
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test mmap_vector----------" << std::endl;
+			tc_grow_and_modify();
+			tc_persistence();
+			std::cout << "----------test mmap_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
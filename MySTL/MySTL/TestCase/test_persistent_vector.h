@@ -0,0 +1,188 @@
+#ifndef INCLUDED_TEST_PERSISTENT_VECTOR
+#define INCLUDED_TEST_PERSISTENT_VECTOR
+
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+#include "../Declaration/persistent_vector.h"
+#include "../Declaration/vector.h"
+
+namespace MySTL
+{
+	namespace TestPersistentVector
+	{
+		template <typename Vector>
+		inline void print(const char *name, const Vector &v)
+		{
+			std::cout << name << ':';
+			for (auto it = v.cbegin(); it != v.cend(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		// v holds exactly the elements of ref, read by index and by iterator
+		template <typename Vector>
+		inline bool same(const Vector &v, const MySTL::vector<int> &ref)
+		{
+			if (v.size() != ref.size())
+				return false;
+			for (std::size_t i = 0; i != ref.size(); ++i)
+				if (v[i] != ref.begin()[i])
+					return false;
+			std::size_t i = 0;
+			for (auto it = v.cbegin(); it != v.cend(); ++it, ++i)
+				if (*it != ref.begin()[i])
+					return false;
+			return true;
+		}
+
+		inline void tc_versions()
+		{
+			std::cout << "-----\t versions" << '\n';
+			const MySTL::persistent_vector<int> a = { 1, 2, 3 };
+			const MySTL::persistent_vector<int> b = a.push_back(4);
+			const MySTL::persistent_vector<int> c = b.set(0, 10);
+			print("a", a);	// a: 1 2 3
+			print("b", b);	// b: 1 2 3 4
+			print("c", c);	// c: 10 2 3 4
+			std::cout << c.front() << ' ' << c.back() << ' ' << c.at(3) << ' ' << (a == b) << ' ' << (b != c) << '\n';	// 10 4 4 0 1
+
+			// every version of a history of 2000 pushes and sets keeps its own content
+			MySTL::vector<MySTL::persistent_vector<int> > history;
+			MySTL::vector<int> ref;
+			history.push_back(MySTL::persistent_vector<int>());
+			for (int i = 0; i != 2000; ++i)
+				history.push_back(history.back().push_back(i));
+			for (int i = 0; i < 2000; i += 7)
+				history.push_back(history.back().set(i, -i));
+			bool ok = true;
+			for (int i = 0; i <= 2000; ++i)
+			{
+				ok = ok && same(history.begin()[i], ref);
+				ref.push_back(i);
+			}
+			ref.pop_back();
+			for (std::size_t v = 2001, i = 0; v != history.size(); ++v, i += 7)
+			{
+				ref.begin()[i] = -static_cast<int>(i);
+				ok = ok && same(history.begin()[v], ref);
+			}
+			std::cout << ok << ' ' << history.size() << '\n';	// 1 2287
+
+			MySTL::persistent_vector<std::string> words(3, "w");
+			const MySTL::persistent_vector<std::string> more = words.push_back("x").set(1, "y");
+			print("words", words);	// words: w w w
+			print("more", more);	// more: w y w x
+			try
+			{
+				more.at(4);
+			}
+			catch (const std::out_of_range &)
+			{
+				std::cout << "out of range" << '\n';	// out of range
+			}
+		}
+
+		inline void tc_concat()
+		{
+			std::cout << "-----\t concat" << '\n';
+			const MySTL::persistent_vector<int> x = { 1, 2 }, y = { 3 };
+			print("x ++ y", x.concat(y));	// x ++ y: 1 2 3
+			print("x ++ x", x.concat(x));	// x ++ x: 1 2 1 2
+
+			// pieces of every size up to a few levels deep, joined in a chain and in a tree; the
+			// results are read back, then pushed to and set to check the relaxed nodes take edits
+			const std::size_t sizes[] = { 1, 5, 31, 32, 33, 64, 100, 1000, 1024, 1057, 5000, 40000 };
+			const std::size_t n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+			MySTL::vector<MySTL::persistent_vector<int> > pieces;
+			MySTL::vector<MySTL::vector<int> > refs;
+			int next = 0;
+			for (std::size_t s = 0; s != n_sizes; ++s)
+			{
+				MySTL::persistent_vector<int> p;
+				MySTL::vector<int> r;
+				for (std::size_t i = 0; i != sizes[s]; ++i, ++next)
+				{
+					p = p.push_back(next);
+					r.push_back(next);
+				}
+				pieces.push_back(p);
+				refs.push_back(r);
+			}
+			bool ok = true;
+			MySTL::persistent_vector<int> chain;
+			MySTL::vector<int> chain_ref;
+			for (std::size_t round = 0; round != 3; ++round)
+			{
+				for (std::size_t a = 0; a != n_sizes; ++a)
+				{
+					const std::size_t s = (a * 5 + round) % n_sizes;
+					chain = chain.concat(pieces.begin()[s]);
+					chain_ref.insert(chain_ref.end(), refs.begin()[s].begin(), refs.begin()[s].end());
+					ok = ok && same(chain, chain_ref);
+				}
+			}
+			for (std::size_t a = 0; a != n_sizes; ++a)
+				for (std::size_t b = 0; b != n_sizes; ++b)
+				{
+					MySTL::vector<int> r(refs.begin()[a]);
+					r.insert(r.end(), refs.begin()[b].begin(), refs.begin()[b].end());
+					MySTL::persistent_vector<int> joined = pieces.begin()[a].concat(pieces.begin()[b]);
+					ok = ok && same(joined, r);
+					for (int i = 0; i != 70; ++i)
+					{
+						joined = joined.push_back(-i);
+						r.push_back(-i);
+					}
+					for (std::size_t i = 0; i < r.size(); i += 37)
+					{
+						joined = joined.set(i, 7);
+						r.begin()[i] = 7;
+					}
+					ok = ok && same(joined, r);
+				}
+			for (std::size_t s = 0; s != n_sizes; ++s)		// the pieces themselves are untouched
+				ok = ok && same(pieces.begin()[s], refs.begin()[s]);
+			std::cout << ok << ' ' << chain.size() << '\n';	// 1 145041
+		}
+
+		inline void tc_transient()
+		{
+			std::cout << "-----\t transient" << '\n';
+			MySTL::persistent_vector<int> base;
+			for (int i = 0; i != 100; ++i)
+				base = base.push_back(i);
+
+			MySTL::transient_vector<int> t = base.transient();
+			for (int i = 100; i != 5000; ++i)
+				t.push_back(i);
+			for (std::size_t i = 0; i < t.size(); i += 3)
+				t.set(i, -1);
+			t.append(base);
+			const MySTL::persistent_vector<int> edited = t.persistent();
+			MySTL::vector<int> ref;
+			for (int i = 0; i != 5000; ++i)
+				ref.push_back(i % 3 == 0 ? -1 : i);
+			for (int i = 0; i != 100; ++i)
+				ref.push_back(i);
+			std::cout << same(edited, ref) << ' ' << t.size() << ' ' << base.size() << ' ' << base[99] << ' ' << base[3] << '\n';	// 1 0 100 99 3
+
+			MySTL::transient_vector<std::string> words = MySTL::persistent_vector<std::string>(2, "a").transient();
+			words.push_back("b");
+			words.set(0, "c");
+			print("words", words.persistent());	// words: c a b
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test persistent_vector----------" << std::endl;
+			tc_versions();
+			tc_concat();
+			tc_transient();
+			std::cout << "----------test persistent_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
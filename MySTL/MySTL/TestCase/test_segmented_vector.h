@@ -0,0 +1,96 @@
+#ifndef INCLUDED_TEST_SEGMENTED_VECTOR
+#define INCLUDED_TEST_SEGMENTED_VECTOR
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "../Declaration/segmented_vector.h"
+
+namespace MySTL
+{
+	namespace TestSegmentedVector
+	{
+		template <typename SegmentedVector>
+		inline void print(const char *name, const SegmentedVector &v)
+		{
+			std::cout << name << ':';
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_segments()
+		{
+			std::cout << "-----\t segments / random access" << '\n';
+			MySTL::segmented_vector<int, 4> v;
+			for (int i = 0; i < 4; ++i)
+				v.push_back(i);
+			std::cout << v.segment_count() << ' ' << v.capacity() << '\n';		// 1 4
+			v.push_back(4);
+			std::cout << v.segment_count() << ' ' << v.capacity() << '\n';		// 2 12
+			for (int i = 5; i < 100; ++i)
+				v.push_back(i);
+			std::cout << v.segment_count() << ' ' << v.capacity() << '\n';		// 5 124
+
+			bool ok = true;
+			for (int i = 0; i < 100; ++i)
+				ok = ok && v[i] == i;
+			auto it = v.begin() + 50;
+			std::cout << ok << ' ' << *it << ' ' << it[-47] << ' ' << (v.end() - it) << ' ' << v.back() << '\n';	// 1 50 3 50 99
+
+			int sum = 0;
+			for (int x : v)
+				sum += x;
+			std::cout << sum << '\n';											// 4950
+		}
+
+		inline void tc_stable_references()
+		{
+			std::cout << "-----\t references survive growth" << '\n';
+			MySTL::segmented_vector<std::string, 2> v;
+			v.push_back("first");
+			std::string *p = &v[0];
+			const std::string &r = v.emplace_back("second");
+			for (int i = 0; i < 1000; ++i)
+				v.push_back(v[0]);						// the argument is one of the elements
+			std::cout << (p == &v[0]) << ' ' << *p << ' ' << r << ' ' << v.size() << '\n';	// 1 first second 1002
+
+			v.pop_back();
+			v.shrink_to_fit();
+			std::cout << v.size() << ' ' << v.capacity() << '\n';				// 1001 1022
+			v.clear();
+			v.shrink_to_fit();
+			std::cout << v.empty() << ' ' << v.segment_count() << '\n';			// 1 0
+		}
+
+		inline void tc_copy_move()
+		{
+			std::cout << "-----\t copy / move / swap" << '\n';
+			MySTL::segmented_vector<std::string, 2> a, b;
+			a.push_back("a");
+			a.push_back("b");
+			a.push_back("c");
+			b = a;
+			b.push_back("d");
+			MySTL::segmented_vector<std::string, 2> c(std::move(b));
+			print("a", a);								// a: a b c
+			print("c", c);								// c: a b c d
+			std::cout << b.size() << '\n';				// 0
+			MySTL::swap(a, c);
+			print("swapped a", a);						// swapped a: a b c d
+			std::cout << c.at(2) << '\n';				// c
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test segmented_vector----------" << std::endl;
+			tc_segments();
+			tc_stable_references();
+			tc_copy_move();
+			std::cout << "----------test segmented_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef INCLUDED_TEST_SMALL_VECTOR
+#define INCLUDED_TEST_SMALL_VECTOR
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "../Declaration/small_vector.h"
+
+namespace MySTL
+{
+	namespace TestSmallVector
+	{
+		template <typename SmallVector>
+		inline void print(const char *name, const SmallVector &v)
+		{
+			std::cout << name << (v.is_inline() ? " (inline):" : " (heap):");
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << ' ' << *it;
+			std::cout << '\n';
+		}
+
+		inline void tc_inline_and_spill()
+		{
+			std::cout << "-----\t inline storage / spill" << '\n';
+			MySTL::small_vector<int, 4> v;
+			for (int i = 0; i < 4; ++i)
+				v.push_back(i);
+			print("4 elements", v);							// (inline): 0 1 2 3
+			v.push_back(4);
+			print("5 elements", v);							// (heap): 0 1 2 3 4
+			std::cout << "capacity: " << v.capacity() << '\n';	// 8
+
+			v.erase(v.begin() + 1, v.begin() + 4);
+			v.shrink_to_fit();
+			print("shrink_to_fit", v);						// (inline): 0 4
+
+			v.insert(v.begin() + 1, 3, 9);
+			print("insert fill", v);						// (heap): 0 9 9 9 4
+			int arr[] = { 7, 8 };
+			v.insert(v.end(), arr, arr + 2);
+			v.insert(v.begin(), v[4]);						// the value is one of the elements
+			print("insert range", v);						// (heap): 4 0 9 9 9 4 7 8
+
+			v.resize(2);
+			v.resize(3, 5);
+			print("resize", v);								// (heap): 4 0 5
+		}
+
+		inline void tc_move()
+		{
+			std::cout << "-----\t move / copy in both modes" << '\n';
+			MySTL::small_vector<std::string, 2> small = { "a", "b" };
+			MySTL::small_vector<std::string, 2> large = { "c", "d", "e" };
+
+			MySTL::small_vector<std::string, 2> from_small(std::move(small));
+			MySTL::small_vector<std::string, 2> from_large(std::move(large));
+			print("moved inline", from_small);				// (inline): a b
+			print("moved heap", from_large);				// (heap): c d e
+			std::cout << "sources: " << small.size() << ' ' << large.size() << ' '
+				<< large.is_inline() << '\n';				// 0 0 1
+
+			MySTL::small_vector<std::string, 2> copy(from_large);
+			copy = from_small;
+			print("copy assigned", copy);					// (heap): a b
+			copy = std::move(from_large);
+			print("move assigned", copy);					// (heap): c d e
+			std::cout << (copy == MySTL::small_vector<std::string, 2>{ "c", "d", "e" }) << '\n';	// 1
+		}
+
+		inline void tc_emplace_and_empty_insert()
+		{
+			std::cout << "-----\t emplace / insert of nothing" << '\n';
+			MySTL::small_vector<std::string, 4> v = { "a", "c" };
+			v.emplace(v.begin() + 1, 1, 'b');
+			v.emplace_back("d");
+			print("emplace", v);							// (inline): a b c d
+			v.emplace(v.begin(), v[3]);						// spills, the value is one of the elements
+			v.emplace(v.end(), 2, 'e');
+			print("emplace spill", v);						// (heap): d a b c d ee
+
+			const std::string none[] = { "x" };
+			v.insert(v.begin() + 1, none, none);			// the elements after the insert point stay as they are
+			v.insert(v.begin() + 2, 0, std::string("y"));
+			print("insert nothing", v);						// (heap): d a b c d ee
+		}
+
+		inline void tc_swap()
+		{
+			std::cout << "-----\t swap in both modes" << '\n';
+			MySTL::small_vector<int, 3> a = { 1, 2 }, b = { 3 }, c = { 4, 5, 6, 7 }, d = { 8, 9, 10, 11, 12 };
+			a.swap(b);
+			print("inline a", a);							// (inline): 3
+			print("inline b", b);							// (inline): 1 2
+			a.swap(c);
+			print("mixed a", a);							// (heap): 4 5 6 7
+			print("mixed c", c);							// (inline): 3
+			MySTL::swap(a, d);
+			print("heap a", a);								// (heap): 8 9 10 11 12
+			print("heap d", d);								// (heap): 4 5 6 7
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test small_vector----------" << std::endl;
+			tc_inline_and_spill();
+			tc_move();
+			tc_swap();
+			tc_emplace_and_empty_insert();
+			std::cout << "----------test small_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef INCLUDED_TEST_SOA_VECTOR
+#define INCLUDED_TEST_SOA_VECTOR
+
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "../Declaration/soa_vector.h"
+
+namespace MySTL
+{
+	namespace TestSoaVector
+	{
+		typedef MySTL::soa_vector<int, double, std::string> records;
+
+		inline void print(const char *name, const records &v)
+		{
+			std::cout << name << ':';
+			for (records::size_type i = 0; i != v.size(); ++i)
+				std::cout << " (" << v[i].get<0>() << ", " << v[i].get<1>() << ", " << v[i].get<2>() << ')';
+			std::cout << '\n';
+		}
+
+		inline void tc_push_and_columns()
+		{
+			std::cout << "-----\t push_back / emplace_back / columns" << '\n';
+			records v;
+			v.emplace_back(1, 0.5, "one");
+			v.push_back(std::make_tuple(2, 1.5, std::string("two")));
+			std::tuple<int, double, std::string> t(3, 2.5, "three");
+			v.push_back(t);
+			print("rows", v);								// rows: (1, 0.5, one) (2, 1.5, two) (3, 2.5, three)
+			for (int i = 4; i <= 10; ++i)
+				v.emplace_back(i, i + 0.5, std::string(i, 'x'));
+			std::cout << v.size() << ' ' << (v.capacity() >= 10) << ' ' << v[9].get<2>() << '\n';	// 10 1 xxxxxxxxxx
+
+			double sum = 0;
+			for (double x : v.column<1>())
+				sum += x;
+			std::cout << sum << ' ' << v.column<0>().back() << ' ' << (v.data<0>() == v.column<0>().data()) << '\n';	// 57 10 1
+		}
+
+		inline void tc_row_reference()
+		{
+			std::cout << "-----\t proxy row reference" << '\n';
+			records v;
+			v.emplace_back(1, 1.0, "a");
+			v.emplace_back(2, 2.0, "b");
+			v[0].get<0>() = 10;								// the proxy writes through
+			MySTL::get<2>(v[1]) += "!";
+			v[1] = std::make_tuple(20, 20.0, std::string("b!!"));
+			std::tuple<int, double, std::string> row = v[0];
+			std::cout << std::get<0>(row) << ' ' << std::get<2>(row) << '\n';	// 10 a
+			v[0] = v[1];									// copies the fields, not the references
+			v[1].get<0>() = 30;
+			print("rows", v);								// rows: (20, 20, b!!) (30, 20, b!!)
+		}
+
+		inline void tc_erase_copy_move()
+		{
+			std::cout << "-----\t erase / copy / move" << '\n';
+			records v;
+			for (int i = 0; i < 6; ++i)
+				v.emplace_back(i, i * 1.0, std::string(1, static_cast<char>('a' + i)));
+			v.erase(1);
+			v.erase(2, 4);
+			print("erased", v);								// erased: (0, 0, a) (2, 2, c) (5, 5, f)
+
+			records c(v);
+			v.pop_back();
+			records m(std::move(c));
+			std::cout << v.size() << ' ' << c.size() << ' ' << m.size() << '\n';	// 2 0 3
+			c = m;
+			m.clear();
+			MySTL::swap(m, v);
+			print("copy assigned", c);						// copy assigned: (0, 0, a) (2, 2, c) (5, 5, f)
+			print("swapped", m);							// swapped: (0, 0, a) (2, 2, c)
+			std::cout << v.empty() << '\n';					// 1
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test soa_vector----------" << std::endl;
+			tc_push_and_columns();
+			tc_row_reference();
+			tc_erase_copy_move();
+			std::cout << "----------test soa_vector success----------\n" << std::endl;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef INCLUDED_TEST_UNINITIALIZED_FUNCTIONS
+#define INCLUDED_TEST_UNINITIALIZED_FUNCTIONS
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <atomic>
+
+#include "../Declaration/uninitialized_functions.h"
+#include "../Declaration/parallel_uninitialized_functions.h"
+#include "../Declaration/string.h"
+
+namespace MySTL
+{
+	namespace TestUninitialized
+	{
+		// copy @n bytes starting at @offset under @policy and compare with the source
+		template <typename CopyPolicy>
+		inline bool check_copy(std::size_t n, std::size_t offset, CopyPolicy policy)
+		{
+			char *src = static_cast<char*>(std::malloc(n + 64));
+			char *dst = static_cast<char*>(std::malloc(n + 64));
+			for (std::size_t i = 0; i != n + 64; ++i)
+				src[i] = static_cast<char>(i * 7 + 3);
+
+			char *finish = MySTL::uninitialized_copy(src + offset, src + offset + n, dst + offset, policy);
+			bool ok = finish == dst + offset + n && std::memcmp(src + offset, dst + offset, n) == 0;
+
+			std::free(src);
+			std::free(dst);
+			return ok;
+		}
+
+		inline void tc_uninitialized_copy()
+		{
+			std::cout << "-----\t uninitialized_copy" << '\n';
+			const std::size_t sizes[] = { 0, 1, 15, 16, 63, 64, 65, 1000, 4096 + 17, 5 * 1024 * 1024 + 3 };
+			bool ok = true;
+			for (std::size_t n : sizes)
+			{
+				for (std::size_t offset = 0; offset < 17; offset += 4)
+				{
+					ok = ok && check_copy(n, offset, temporal_copy_tag());
+					ok = ok && check_copy(n, offset, streaming_copy_tag());
+					ok = ok && check_copy(n, offset, adaptive_copy_tag());
+				}
+			}
+			std::cout << "POD copy under every policy: " << (ok ? "passed" : "FAILED") << '\n';
+
+			int ints[] = { 1, 2, 3, 4, 5 };
+			int copied[5];
+			MySTL::uninitialized_copy(ints, ints + 5, copied);
+			std::cout << "int copy:";
+			for (int x : copied)
+				std::cout << ' ' << x;
+			std::cout << '\n';
+
+			std::string strs[] = { "non", "trivially", "copyable" };
+			std::string *raw = static_cast<std::string*>(std::malloc(sizeof(strs)));
+			std::string *finish = MySTL::uninitialized_copy(strs, strs + 3, raw, streaming_copy_tag());
+			std::cout << "string copy:";
+			for (std::string *p = raw; p != finish; ++p)
+			{
+				std::cout << ' ' << *p;
+				p->~basic_string();
+			}
+			std::cout << '\n';
+			std::free(raw);
+		}
+
+		inline void tc_uninitialized_fill()
+		{
+			std::cout << "-----\t uninitialized_fill / uninitialized_fill_n" << '\n';
+			int ints[6];
+			MySTL::uninitialized_fill(ints, ints + 3, 7);
+			MySTL::uninitialized_fill_n(ints + 3, 3, 9);
+			std::cout << "ints:";
+			for (int x : ints)
+				std::cout << ' ' << x;
+			std::cout << '\n';
+
+			std::string *raw = static_cast<std::string*>(std::malloc(3 * sizeof(std::string)));
+			std::string *finish = MySTL::uninitialized_fill_n(raw, 3, std::string("abc"));
+			std::cout << "strings:";
+			for (std::string *p = raw; p != finish; ++p)
+			{
+				std::cout << ' ' << *p;
+				p->~basic_string();
+			}
+			std::cout << '\n';
+			std::free(raw);
+		}
+
+		// throws from its copy constructor once the global budget runs out, counts live objects
+		struct fragile
+		{
+			static std::atomic<int>& live() { static std::atomic<int> n(0); return n; }
+			static std::atomic<int>& budget() { static std::atomic<int> n(-1); return n; }
+			int value;
+
+			fragile(int v) : value(v) { ++live(); }
+			fragile(const fragile &x) : value(x.value)
+			{
+				if (budget()-- == 0)
+					throw std::runtime_error("copy failed");
+				++live();
+			}
+			~fragile() { --live(); }
+		};
+
+		inline void tc_parallel_uninitialized()
+		{
+			std::cout << "-----\t parallel uninitialized_copy / uninitialized_fill_n" << '\n';
+			MySTL::thread_pool pool(4);		// not instance(): parallel whatever the machine has
+			const std::size_t n = 1 << 20;
+			int *src = new int[n];
+			for (std::size_t i = 0; i != n; ++i)
+				src[i] = static_cast<int>(i);
+
+			int *dst = static_cast<int*>(std::malloc(n * sizeof(int)));
+			MySTL::uninitialized_copy(MySTL::par, pool, src, src + n, dst);
+			std::cout << "parallel copy: " << (std::memcmp(src, dst, n * sizeof(int)) == 0 ? "passed" : "FAILED") << '\n';
+
+			MySTL::uninitialized_fill_n(MySTL::par, pool, dst, n, 5);
+			bool ok = true;
+			for (std::size_t i = 0; i != n; ++i)
+				ok = ok && dst[i] == 5;
+			std::cout << "parallel fill_n: " << (ok ? "passed" : "FAILED") << '\n';
+			std::free(dst);
+			delete[] src;
+
+			// a copy in the middle of the range throws: every chunk constructed must be destroyed
+			const std::size_t m = 1 << 19;	// above PARALLEL_THRESHOLD
+			fragile *raw = static_cast<fragile*>(std::malloc(m * sizeof(fragile)));
+			fragile proto(1);
+			fragile::budget() = static_cast<int>(m / 2);
+			try
+			{
+				MySTL::_parallel_construct(pool, raw, m, [&](std::size_t b, std::size_t e)
+				{
+					MySTL::uninitialized_fill_n(raw + b, e - b, proto);
+				});
+				std::cout << "rollback: FAILED, no exception" << '\n';
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "rollback: " << (fragile::live() == 1 ? "passed" : "FAILED") << '\n';	// only proto is alive
+			}
+
+			// not trivially copyable: built in this thread, and rolled back the same
+			fragile::budget() = static_cast<int>(m / 2);
+			try
+			{
+				MySTL::uninitialized_fill_n(MySTL::par, pool, raw, m, proto);
+				std::cout << "sequential rollback: FAILED, no exception" << '\n';
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "sequential rollback: " << (fragile::live() == 1 ? "passed" : "FAILED") << '\n';
+			}
+			fragile::budget() = -1;
+			std::free(raw);
+
+			// strings allocate from the pool allocator, which must not be entered from the workers
+			const std::size_t k = 1 << 16;
+			MySTL::string *strs = static_cast<MySTL::string*>(std::malloc(k * sizeof(MySTL::string)));
+			MySTL::uninitialized_fill_n(MySTL::par, pool, strs, k, MySTL::string("pooled"));
+			ok = true;
+			for (std::size_t i = 0; i != k; ++i)
+				ok = ok && strs[i] == MySTL::string("pooled");
+			MySTL::destory(strs, strs + k);
+			std::free(strs);
+			std::cout << "string fill_n: " << (ok ? "passed" : "FAILED") << '\n';
+		}
+
+		// counts copies and moves; moves may throw unless NOTHROW
+		template <bool NOTHROW>
+		struct tracked
+		{
+			static int& copies() { static int n = 0; return n; }
+			static int& moves() { static int n = 0; return n; }
+			std::string value;
+
+			tracked() : value("default") {}
+			tracked(const char *s) : value(s) {}
+			tracked(const tracked &x) : value(x.value) { ++copies(); }
+			tracked(tracked &&x) noexcept(NOTHROW) : value(std::move(x.value)) { ++moves(); }
+		};
+
+		inline void tc_uninitialized_move()
+		{
+			std::cout << "-----\t uninitialized_move / uninitialized_move_n / uninitialized_move_if_noexcept" << '\n';
+			typedef tracked<true> safe;
+			typedef tracked<false> risky;
+
+			safe src[3] = { "a", "b", "c" };
+			safe *raw = static_cast<safe*>(std::malloc(3 * sizeof(safe)));
+			safe *finish = MySTL::uninitialized_move(src, src + 3, raw);
+			std::cout << "move: " << raw[0].value << raw[1].value << raw[2].value
+				<< ", copies " << safe::copies() << ", moves " << safe::moves() << '\n';	// abc, copies 0, moves 3
+			MySTL::destory(raw, finish);
+
+			std::pair<safe*, safe*> r = MySTL::uninitialized_move_n(src, 2, raw);
+			std::cout << "move_n: consumed " << (r.first - src) << ", constructed " << (r.second - raw) << '\n';
+			MySTL::destory(raw, r.second);
+
+			safe::moves() = 0;
+			finish = MySTL::uninitialized_move_if_noexcept(src, src + 3, raw);
+			std::cout << "move_if_noexcept, nothrow move: copies " << safe::copies() << ", moves " << safe::moves() << '\n';
+			MySTL::destory(raw, finish);
+			std::free(raw);
+
+			risky rsrc[3] = { "x", "y", "z" };
+			risky *rraw = static_cast<risky*>(std::malloc(3 * sizeof(risky)));
+			risky *rfinish = MySTL::uninitialized_move_if_noexcept(rsrc, rsrc + 3, rraw);
+			std::cout << "move_if_noexcept, throwing move: copies " << risky::copies() << ", moves " << risky::moves()
+				<< ", source kept " << rsrc[0].value << rsrc[1].value << rsrc[2].value << '\n';	// copies 3, moves 0, xyz
+			MySTL::destory(rraw, rfinish);
+			std::free(rraw);
+
+			int ints[] = { 1, 2, 3 };
+			int moved[3];
+			MySTL::uninitialized_move(ints, ints + 3, moved);
+			std::cout << "int move: " << moved[0] << ' ' << moved[1] << ' ' << moved[2] << '\n';
+
+			// a range of another type is constructed element by element, never assigned into raw memory
+			const char *words[] = { "built", "in", "place" };
+			std::string *sraw = static_cast<std::string*>(std::malloc(3 * sizeof(std::string)));
+			std::string *sfinish = MySTL::uninitialized_move(words, words + 3, sraw);
+			std::cout << "c-string into string move: " << sraw[0] << ' ' << sraw[1] << ' ' << sraw[2] << '\n';	// built in place
+			MySTL::destory(sraw, sfinish);
+			std::free(sraw);
+		}
+
+		inline void tc_uninitialized_default_construct()
+		{
+			std::cout << "-----\t uninitialized_default_construct" << '\n';
+			tracked<true> *raw = static_cast<tracked<true>*>(std::malloc(2 * sizeof(tracked<true>)));
+			MySTL::uninitialized_default_construct(raw, raw + 2);
+			std::cout << "objects: " << raw[0].value << ' ' << raw[1].value << '\n';
+			MySTL::destory(raw, raw + 2);
+			std::free(raw);
+
+			int ints[4];
+			MySTL::uninitialized_default_construct(ints, ints + 4);	// no-op for trivial types
+			std::cout << "ints left uninitialized" << '\n';
+		}
+
+		inline void test_all()
+		{
+			std::cout << "----------test uninitialized functions----------" << std::endl;
+			tc_uninitialized_copy();
+			tc_uninitialized_fill();
+			tc_uninitialized_move();
+			tc_uninitialized_default_construct();
+			tc_parallel_uninitialized();
+			std::cout << "----------test uninitialized functions success----------\n" << std::endl;
+		}
+	}
+}
+#endif
@@ -1,465 +1,850 @@
-#include <string>
-#include <iostream>
-#include <ctime>
-
-#include "test_vector.h"
-
-namespace MySTL
-{
-	namespace TestVector
-	{
-		template <typename T>
-		void printvector(vector<T> &v)
-		{
-			for (vector<int>::iterator it = v.begin(); it != v.end(); ++it)
-				std::cout << *it << '\t';
-			std::cout << std::endl;
-		}
-
-		void tc_constructor()
-		{
-			std::cout << "-----\t constructor" << '\n';
-			vector<int> v1;		// constructor: default
-			v1 = { 1, 2, 3, 4, 5 };		// assign content: initializer list
-			printvector(v1);
-
-			vector<int> v2(5, 10);	// constructor: fill
-			printvector(v2);
-
-			vector<int> v3({ 4, 5, 6, 7, 8 });	// constructor: initializer list
-			printvector(v3);
-
-			vector<int> v4(v1);		// copy constructor
-			printvector(v4);
-
-			vector<int> v5 = v1;	// assign content: copy
-			printvector(v5);
-
-			// the iterator constructor can also be used to construct from arrays:
-			int myints[] = { 16, 2, 77, 29 };
-			MySTL::vector<int> v6(myints, myints + sizeof(myints) / sizeof(int));
-			printvector(v6);
-		}
-
-		void tc_assignment()
-		{
-			std::cout << "-----\t assignment" << '\n';
-			MySTL::vector<int> foo(3, 0);
-			MySTL::vector<int> bar(5, 0);
-
-			bar = foo;
-			foo = MySTL::vector<int>();
-
-			std::cout << "Size of foo: " << int(foo.size()) << '\n';	// 0
-			std::cout << "Size of bar: " << int(bar.size()) << '\n';	// 3
-		}
-
-		// iterator
-		void tc_iterators()
-		{
-			std::cout << "-----\t iterators" << '\n';
-			MySTL::vector<int> myvector(5);  // 5 default-constructed ints
-
-			auto i = 0;
-
-			//MySTL::vector<int>::reverse_iterator rit = myvector.rbegin();
-			//for (; rit != myvector.rend(); ++rit)
-			//	*rit = ++i;
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		// capacity
-		void tc_size()
-		{
-			std::cout << "-----\t size" << '\n';
-			MySTL::vector<int> myvector;
-
-			// set some content in the vector:
-			for (int i = 0; i < 100; i++) myvector.push_back(i);
-
-			std::cout << "size: " << myvector.size() << "\n";
-			std::cout << "capacity: " << myvector.capacity() << "\n";
-			std::cout << "max_size: " << myvector.max_size() << "\n";
-		}
-
-		void tc_empty()
-		{
-			std::cout << "-----\t empty" << '\n';
-			MySTL::vector<int> myvector;
-			int sum(0);
-
-			for (int i = 1; i <= 10; i++) myvector.push_back(i);
-
-			while (!myvector.empty())
-			{
-				sum += myvector.back();
-				myvector.pop_back();
-			}
-
-			std::cout << "total: " << sum << '\n';
-		}
-
-		void tc_resize()
-		{
-			std::cout << "-----\t resize" << '\n';
-			MySTL::vector<int> myvector;
-
-			// set some initial content:
-			for (int i = 1; i < 10; i++) myvector.push_back(i);
-
-			myvector.resize(5);
-			myvector.resize(8, 100);
-			myvector.resize(12);
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		void tc_reserve()
-		{
-			std::cout << "-----\t reserve" << '\n';
-			MySTL::vector<int>::size_type sz;
-
-			MySTL::vector<int> foo;
-			sz = foo.capacity();
-			std::cout << "making foo grow:\n";
-			for (int i = 0; i < 100; ++i)
-			{
-				foo.push_back(i);
-				if (sz != foo.capacity())
-				{
-					sz = foo.capacity();
-					std::cout << "capacity changed: " << sz << '\n';
-				}
-			}
-
-			MySTL::vector<int> bar;
-			sz = bar.capacity();
-			bar.reserve(100);   // this is the only difference with foo above
-			std::cout << "making bar grow:\n";
-			for (int i = 0; i < 100; ++i)
-			{
-				bar.push_back(i);
-				if (sz != bar.capacity())
-				{
-					sz = bar.capacity();
-					std::cout << "capacity changed: " << sz << '\n';
-				}
-			}
-		}
-
-		void tc_shrink_to_fit()
-		{
-			std::cout << "-----\t shrink_to_fit" << '\n';
-			MySTL::vector<int> myvector(100);
-			std::cout << "1. capacity of myvector: " << myvector.capacity() << '\n';
-
-			myvector.resize(10);
-			std::cout << "2. capacity of myvector: " << myvector.capacity() << '\n';
-
-			//myvector.shrink_to_fit();
-			//std::cout << "3. capacity of myvector: " << myvector.capacity() << '\n';
-		}
-
-		// element access
-		void tc_elementAccess()
-		{
-			std::cout << "-----\t element access" << '\n';
-			MySTL::vector<int> myvector(10);   // 10 zero-initialized elements
-
-			MySTL::vector<int>::size_type sz = myvector.size();
-
-			// assign some values:
-			for (unsigned i = 0; i < sz; i++) myvector[i] = i;
-
-			// reverse vector using operator[]:
-			for (unsigned i = 0; i < sz / 2; i++)
-			{
-				int temp;
-				temp = myvector[sz - 1 - i];
-				myvector[sz - 1 - i] = myvector[i];
-				myvector[i] = temp;
-			}
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		void tc_at()
-		{
-			std::cout << "-----\t at" << '\n';
-			MySTL::vector<int> myvector(10);   // 10 zero-initialized ints
-
-			// assign some values:
-			for (unsigned i = 0; i < myvector.size(); i++)
-				myvector.at(i) = i;
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		void tc_front_back()
-		{
-			std::cout << "-----\t front back" << '\n';
-			MySTL::vector<int> myvector;
-
-			myvector.push_back(78);
-			myvector.push_back(16);
-
-			// now front equals 78, and back 16
-
-			myvector.front() -= myvector.back();
-
-			std::cout << "myvector.front() is now " << myvector.front() << '\n';
-			std::cout << "myvector.back() is now " << myvector.back() << '\n';
-		}
-
-		void tc_data()
-		{
-			std::cout << "-----\t data" << '\n';
-			MySTL::vector<int> myvector(5);
-
-			int* p = myvector.data();
-
-			*p = 10;
-			++p;
-			*p = 20;
-			p[2] = 100;
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		// modifiers
-		void tc_assign()
-		{
-			std::cout << "-----\t assign" << '\n';
-			MySTL::vector<int> first;
-			MySTL::vector<int> second;
-			MySTL::vector<int> third;
-
-			first.assign(7, 100);             // 7 ints with a value of 100
-
-			MySTL::vector<int>::iterator it;
-			it = first.begin() + 1;
-
-			second.assign(it, first.end() - 1); // the 5 central values of first
-
-			int myints[] = { 1776, 7, 4 };
-			third.assign(myints, myints + 3);   // assigning from array.
-
-			std::cout << "Size of first: " << int(first.size()) << '\n';
-			std::cout << "Size of second: " << int(second.size()) << '\n';
-			std::cout << "Size of third: " << int(third.size()) << '\n';
-		}
-
-		void tc_push_back()
-		{
-			std::cout << "-----\t push_back" << '\n';
-			MySTL::vector<int> myvector;
-
-			for (auto i = 0; i < 10; ++i)
-			{
-				srand(static_cast<unsigned>(time(nullptr)));
-				myvector.push_back(rand());
-			}
-			printvector(myvector);
-		}
-
-		void tc_pop_back()
-		{
-			std::cout << "-----\t pop_back" << '\n';
-			MySTL::vector<int> myvector;
-			int sum(0);
-			myvector.push_back(100);
-			myvector.push_back(200);
-			myvector.push_back(300);
-
-			while (!myvector.empty())
-			{
-				sum += myvector.back();
-				myvector.pop_back();
-			}
-			std::cout << "The elements of myvector add up to " << sum << '\n';
-		}
-
-		void tc_insert()
-		{
-			std::cout << "-----\t insert" << '\n';
-			MySTL::vector<int> myvector(3, 100);
-			MySTL::vector<int>::iterator it;
-
-			it = myvector.begin();
-			it = myvector.insert(it, 200);
-
-			myvector.insert(it, 2, 300);
-
-			// "it" no longer valid, get a new one:
-			it = myvector.begin();
-
-			MySTL::vector<int> anothervector(2, 400);
-			myvector.insert(it + 2, anothervector.begin(), anothervector.end());
-
-			int myarray[] = { 501, 502, 503 };
-			myvector.insert(myvector.begin(), myarray, myarray + 3);
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		void tc_erase()
-		{
-			std::cout << "-----\t erase" << '\n';
-			MySTL::vector<int> myvector;
-
-			// set some values (from 1 to 10)
-			for (int i = 1; i <= 10; i++) myvector.push_back(i);
-
-			// erase the 6th element
-			myvector.erase(myvector.begin() + 5);
-
-			// erase the first 3 elements:
-			myvector.erase(myvector.begin(), myvector.begin() + 3);
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-		void tc_swap()
-		{
-			std::cout << "-----\t swap" << '\n';
-			MySTL::vector<int> foo(3, 100);   // three ints with a value of 100
-			MySTL::vector<int> bar(5, 200);   // five ints with a value of 200
-
-			foo.swap(bar);
-
-			std::cout << "foo contains:";
-			printvector(foo);
-
-			std::cout << "bar contains:";
-			printvector(bar);
-		}
-
-		void tc_clear()
-		{
-			std::cout << "-----\t clear" << '\n';
-			MySTL::vector<int> myvector;
-			myvector.push_back(100);
-			myvector.push_back(200);
-			myvector.push_back(300);
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-
-			myvector.clear();
-			myvector.push_back(1101);
-			myvector.push_back(2202);
-
-			std::cout << "myvector contains:";
-			printvector(myvector);
-		}
-
-
-        /*
-		void tc_emplace()
-		{
-			std::cout << "-----\t emplace" << '\n';
-			MySTL::vector<int> myvector = { 10, 20, 30 };
-
-			myvector.emplace(myvector.begin() + 1, 100);
-			myvector.emplace(myvector.end(), 300);
-
-			std::cout << "myvector contains:";
-			for (auto& x : myvector)
-				std::cout << ' ' << x;
-			std::cout << '\n';
-		}
-
-		void tc_emplace_back()
-		{
-			std::cout << "-----\t emplace_back" << '\n';
-			MySTL::vector<int> myvector = { 10, 20, 30 };
-
-			myvector.emplace_back(100);
-			myvector.emplace_back(200);
-
-			std::cout << "myvector contains:";
-			for (auto& x : myvector)
-				std::cout << ' ' << x;
-			std::cout << '\n';
-		}*/
-
-
-		// allocator
-		/*
-		void tc_get_allocator()
-		{
-		MySTL::vector<int> myvector;
-		int * p;
-		unsigned int i;
-
-		// allocate an array with space for 5 elements using vector's allocator:
-		p = myvector.get_allocator().allocate(5);
-
-		// construct values in-place on the array:
-		for (i = 0; i < 5; i++) myvector.get_allocator().construct(&p[i], i);
-
-		std::cout << "The allocated array contains:";
-		for (i = 0; i < 5; i++) std::cout << ' ' << p[i];
-		std::cout << '\n';
-
-		// destroy and deallocate:
-		for (i = 0; i < 5; i++) myvector.get_allocator().destroy(&p[i]);
-		myvector.get_allocator().deallocate(p, 5);
-		}
-		*/
-
-
-		void tc_relationalOperators()
-		{
-			std::cout << "-----\t relational operators" << '\n';
-			MySTL::vector<int> foo(3, 100);   // three ints with a value of 100
-			MySTL::vector<int> bar(2, 200);   // two ints with a value of 200
-
-			if (foo == bar) std::cout << "foo and bar are equal\n";
-			if (foo != bar) std::cout << "foo and bar are not equal\n";
-			if (foo < bar) std::cout << "foo is less than bar\n";
-			if (foo > bar) std::cout << "foo is greater than bar\n";
-			if (foo <= bar) std::cout << "foo is less than or equal to bar\n";
-			if (foo >= bar) std::cout << "foo is greater than or equal to bar\n";
-		}
-
-
-		void test_all()
-		{
-			std::cout << "----------test vector----------" << std::endl;
-			tc_constructor();
-			tc_assignment();
-			tc_size();
-			tc_empty();
-			tc_resize();
-			tc_reserve();
-			tc_shrink_to_fit();
-			tc_elementAccess();
-			tc_at();
-			tc_front_back();
-			tc_data();
-			tc_assign();
-			tc_push_back();
-			tc_pop_back();
-			tc_insert();
-			tc_erase();
-			tc_swap();
-			tc_clear();
-			//tc_emplace();
-			//tc_emplace_back();
-			//tc_get_allocator();
-			tc_relationalOperators();
-			std::cout << "----------test vector success----------\n" << std::endl;
-		}
-
-	}
-}
-
+#include <string>
+#include <iostream>
+#include <ctime>
+#include <atomic>
+#include <stdexcept>
+
+#include "test_vector.h"
+
+namespace MySTL
+{
+	namespace TestVector
+	{
+		template <typename T>
+		void printvector(vector<T> &v)
+		{
+			for (vector<int>::iterator it = v.begin(); it != v.end(); ++it)
+				std::cout << *it << '\t';
+			std::cout << std::endl;
+		}
+
+		void tc_constructor()
+		{
+			std::cout << "-----\t constructor" << '\n';
+			vector<int> v1;		// constructor: default
+			v1 = { 1, 2, 3, 4, 5 };		// assign content: initializer list
+			printvector(v1);
+
+			vector<int> v2(5, 10);	// constructor: fill
+			printvector(v2);
+
+			vector<int> v3({ 4, 5, 6, 7, 8 });	// constructor: initializer list
+			printvector(v3);
+
+			vector<int> v4(v1);		// copy constructor
+			printvector(v4);
+
+			vector<int> v5 = v1;	// assign content: copy
+			printvector(v5);
+
+			// the iterator constructor can also be used to construct from arrays:
+			int myints[] = { 16, 2, 77, 29 };
+			MySTL::vector<int> v6(myints, myints + sizeof(myints) / sizeof(int));
+			printvector(v6);
+
+			// a range of another type: each element is constructed from its source
+			const char *words[] = { "converted", "from", "c-strings" };
+			MySTL::vector<std::string> v7(words, words + 3);
+			v7.assign(words + 1, words + 3);
+			v7.insert(v7.begin(), words, words + 1);
+			double halves[] = { 0.5, 1.5 };
+			MySTL::vector<int> v8(halves, halves + 2);
+			std::cout << v7[0] << ' ' << v7[1] << ' ' << v7[2] << ' ' << v7.size() << ' ' << v8[0] << v8[1] << '\n';	// converted from c-strings 3 01
+		}
+
+		void tc_assignment()
+		{
+			std::cout << "-----\t assignment" << '\n';
+			MySTL::vector<int> foo(3, 0);
+			MySTL::vector<int> bar(5, 0);
+
+			bar = foo;
+			foo = MySTL::vector<int>();
+
+			std::cout << "Size of foo: " << int(foo.size()) << '\n';	// 0
+			std::cout << "Size of bar: " << int(bar.size()) << '\n';	// 3
+		}
+
+		// iterator
+		void tc_iterators()
+		{
+			std::cout << "-----\t iterators" << '\n';
+			MySTL::vector<int> myvector(5);  // 5 default-constructed ints
+
+			auto i = 0;
+
+			//MySTL::vector<int>::reverse_iterator rit = myvector.rbegin();
+			//for (; rit != myvector.rend(); ++rit)
+			//	*rit = ++i;
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		// capacity
+		void tc_size()
+		{
+			std::cout << "-----\t size" << '\n';
+			MySTL::vector<int> myvector;
+
+			// set some content in the vector:
+			for (int i = 0; i < 100; i++) myvector.push_back(i);
+
+			std::cout << "size: " << myvector.size() << "\n";
+			std::cout << "capacity: " << myvector.capacity() << "\n";
+			std::cout << "max_size: " << myvector.max_size() << "\n";
+		}
+
+		void tc_empty()
+		{
+			std::cout << "-----\t empty" << '\n';
+			MySTL::vector<int> myvector;
+			int sum(0);
+
+			for (int i = 1; i <= 10; i++) myvector.push_back(i);
+
+			while (!myvector.empty())
+			{
+				sum += myvector.back();
+				myvector.pop_back();
+			}
+
+			std::cout << "total: " << sum << '\n';
+		}
+
+		void tc_resize()
+		{
+			std::cout << "-----\t resize" << '\n';
+			MySTL::vector<int> myvector;
+
+			// set some initial content:
+			for (int i = 1; i < 10; i++) myvector.push_back(i);
+
+			myvector.resize(5);
+			myvector.resize(8, 100);
+			myvector.resize(12);
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		void tc_reserve()
+		{
+			std::cout << "-----\t reserve" << '\n';
+			MySTL::vector<int>::size_type sz;
+
+			MySTL::vector<int> foo;
+			sz = foo.capacity();
+			std::cout << "making foo grow:\n";
+			for (int i = 0; i < 100; ++i)
+			{
+				foo.push_back(i);
+				if (sz != foo.capacity())
+				{
+					sz = foo.capacity();
+					std::cout << "capacity changed: " << sz << '\n';
+				}
+			}
+
+			MySTL::vector<int> bar;
+			sz = bar.capacity();
+			bar.reserve(100);   // this is the only difference with foo above
+			std::cout << "making bar grow:\n";
+			for (int i = 0; i < 100; ++i)
+			{
+				bar.push_back(i);
+				if (sz != bar.capacity())
+				{
+					sz = bar.capacity();
+					std::cout << "capacity changed: " << sz << '\n';
+				}
+			}
+		}
+
+		void tc_shrink_to_fit()
+		{
+			std::cout << "-----\t shrink_to_fit" << '\n';
+			MySTL::vector<int> myvector(100);
+			std::cout << "1. capacity of myvector: " << myvector.capacity() << '\n';
+
+			myvector.resize(10);
+			std::cout << "2. capacity of myvector: " << myvector.capacity() << '\n';
+
+			myvector.shrink_to_fit();
+			std::cout << "3. capacity of myvector: " << myvector.capacity() << '\n';	// 10
+			std::cout << myvector.size() << ' ' << myvector[9] << '\n';					// 10 0
+		}
+
+		// element access
+		void tc_elementAccess()
+		{
+			std::cout << "-----\t element access" << '\n';
+			MySTL::vector<int> myvector(10);   // 10 zero-initialized elements
+
+			MySTL::vector<int>::size_type sz = myvector.size();
+
+			// assign some values:
+			for (unsigned i = 0; i < sz; i++) myvector[i] = i;
+
+			// reverse vector using operator[]:
+			for (unsigned i = 0; i < sz / 2; i++)
+			{
+				int temp;
+				temp = myvector[sz - 1 - i];
+				myvector[sz - 1 - i] = myvector[i];
+				myvector[i] = temp;
+			}
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		void tc_at()
+		{
+			std::cout << "-----\t at" << '\n';
+			MySTL::vector<int> myvector(10);   // 10 zero-initialized ints
+
+			// assign some values:
+			for (unsigned i = 0; i < myvector.size(); i++)
+				myvector.at(i) = i;
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		void tc_front_back()
+		{
+			std::cout << "-----\t front back" << '\n';
+			MySTL::vector<int> myvector;
+
+			myvector.push_back(78);
+			myvector.push_back(16);
+
+			// now front equals 78, and back 16
+
+			myvector.front() -= myvector.back();
+
+			std::cout << "myvector.front() is now " << myvector.front() << '\n';
+			std::cout << "myvector.back() is now " << myvector.back() << '\n';
+		}
+
+		void tc_data()
+		{
+			std::cout << "-----\t data" << '\n';
+			MySTL::vector<int> myvector(5);
+
+			int* p = myvector.data();
+
+			*p = 10;
+			++p;
+			*p = 20;
+			p[2] = 100;
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		// modifiers
+		void tc_assign()
+		{
+			std::cout << "-----\t assign" << '\n';
+			MySTL::vector<int> first;
+			MySTL::vector<int> second;
+			MySTL::vector<int> third;
+
+			first.assign(7, 100);             // 7 ints with a value of 100
+
+			MySTL::vector<int>::iterator it;
+			it = first.begin() + 1;
+
+			second.assign(it, first.end() - 1); // the 5 central values of first
+
+			int myints[] = { 1776, 7, 4 };
+			third.assign(myints, myints + 3);   // assigning from array.
+
+			std::cout << "Size of first: " << int(first.size()) << '\n';
+			std::cout << "Size of second: " << int(second.size()) << '\n';
+			std::cout << "Size of third: " << int(third.size()) << '\n';
+		}
+
+		void tc_push_back()
+		{
+			std::cout << "-----\t push_back" << '\n';
+			MySTL::vector<int> myvector;
+
+			for (auto i = 0; i < 10; ++i)
+			{
+				srand(static_cast<unsigned>(time(nullptr)));
+				myvector.push_back(rand());
+			}
+			printvector(myvector);
+		}
+
+		void tc_pop_back()
+		{
+			std::cout << "-----\t pop_back" << '\n';
+			MySTL::vector<int> myvector;
+			int sum(0);
+			myvector.push_back(100);
+			myvector.push_back(200);
+			myvector.push_back(300);
+
+			while (!myvector.empty())
+			{
+				sum += myvector.back();
+				myvector.pop_back();
+			}
+			std::cout << "The elements of myvector add up to " << sum << '\n';
+		}
+
+		void tc_insert()
+		{
+			std::cout << "-----\t insert" << '\n';
+			MySTL::vector<int> myvector(3, 100);
+			MySTL::vector<int>::iterator it;
+
+			it = myvector.begin();
+			it = myvector.insert(it, 200);
+
+			myvector.insert(it, 2, 300);
+
+			// "it" no longer valid, get a new one:
+			it = myvector.begin();
+
+			MySTL::vector<int> anothervector(2, 400);
+			myvector.insert(it + 2, anothervector.begin(), anothervector.end());
+
+			int myarray[] = { 501, 502, 503 };
+			myvector.insert(myvector.begin(), myarray, myarray + 3);
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		void tc_empty_insert()
+		{
+			std::cout << "-----\t insert of nothing" << '\n';
+			MySTL::vector<std::string> v;
+			v.reserve(8);
+			v.push_back("a");
+			v.push_back("b");
+			v.push_back("c");
+			const std::string none[] = { "x" };
+			v.insert(v.begin() + 1, none, none);			// the elements after the insert point stay as they are
+			v.insert(v.begin(), 0, std::string("y"));
+			v.insert(v.end(), none, none);
+			for (auto &e : v)
+				std::cout << e << ' ';
+			std::cout << v.size() << '\n';					// a b c 3
+		}
+
+		void tc_erase()
+		{
+			std::cout << "-----\t erase" << '\n';
+			MySTL::vector<int> myvector;
+
+			// set some values (from 1 to 10)
+			for (int i = 1; i <= 10; i++) myvector.push_back(i);
+
+			// erase the 6th element
+			myvector.erase(myvector.begin() + 5);
+
+			// erase the first 3 elements:
+			myvector.erase(myvector.begin(), myvector.begin() + 3);
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+		void tc_swap()
+		{
+			std::cout << "-----\t swap" << '\n';
+			MySTL::vector<int> foo(3, 100);   // three ints with a value of 100
+			MySTL::vector<int> bar(5, 200);   // five ints with a value of 200
+
+			foo.swap(bar);
+
+			std::cout << "foo contains:";
+			printvector(foo);
+
+			std::cout << "bar contains:";
+			printvector(bar);
+		}
+
+		void tc_clear()
+		{
+			std::cout << "-----\t clear" << '\n';
+			MySTL::vector<int> myvector;
+			myvector.push_back(100);
+			myvector.push_back(200);
+			myvector.push_back(300);
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+
+			myvector.clear();
+			myvector.push_back(1101);
+			myvector.push_back(2202);
+
+			std::cout << "myvector contains:";
+			printvector(myvector);
+		}
+
+
+		void tc_emplace()
+		{
+			std::cout << "-----\t emplace" << '\n';
+			MySTL::vector<int> myvector = { 10, 20, 30 };
+
+			myvector.emplace(myvector.begin() + 1, 100);
+			myvector.emplace(myvector.end(), 300);
+
+			std::cout << "myvector contains:";
+			for (auto& x : myvector)
+				std::cout << ' ' << x;
+			std::cout << '\n';
+		}
+
+		void tc_emplace_back()
+		{
+			std::cout << "-----\t emplace_back" << '\n';
+			MySTL::vector<int> myvector = { 10, 20, 30 };
+
+			myvector.emplace_back(100);
+			myvector.emplace_back(200);
+
+			std::cout << "myvector contains:";
+			for (auto& x : myvector)
+				std::cout << ' ' << x;
+			std::cout << '\n';
+
+			// constructed in place from the arguments, no temporary record
+			MySTL::vector<std::pair<std::string, int> > records;
+			records.emplace_back("alpha", 1);
+			records.emplace_back(std::string(20, 'b'), 2);
+			records.emplace(records.begin(), "first", 0);
+			records.emplace_back("last", 3);
+			records.emplace_back(records[0]);				// full: the argument is one of the old elements
+			for (auto& r : records)
+				std::cout << r.first << '=' << r.second << ' ';
+			std::cout << '\n';								// first=0 alpha=1 bbbbbbbbbbbbbbbbbbbb=2 last=3 first=0
+		}
+
+
+		// allocator
+		/*
+		void tc_get_allocator()
+		{
+		MySTL::vector<int> myvector;
+		int * p;
+		unsigned int i;
+
+		// allocate an array with space for 5 elements using vector's allocator:
+		p = myvector.get_allocator().allocate(5);
+
+		// construct values in-place on the array:
+		for (i = 0; i < 5; i++) myvector.get_allocator().construct(&p[i], i);
+
+		std::cout << "The allocated array contains:";
+		for (i = 0; i < 5; i++) std::cout << ' ' << p[i];
+		std::cout << '\n';
+
+		// destroy and deallocate:
+		for (i = 0; i < 5; i++) myvector.get_allocator().destroy(&p[i]);
+		myvector.get_allocator().deallocate(p, 5);
+		}
+		*/
+
+
+		void tc_relationalOperators()
+		{
+			std::cout << "-----\t relational operators" << '\n';
+			MySTL::vector<int> foo(3, 100);   // three ints with a value of 100
+			MySTL::vector<int> bar(2, 200);   // two ints with a value of 200
+
+			if (foo == bar) std::cout << "foo and bar are equal\n";
+			if (foo != bar) std::cout << "foo and bar are not equal\n";
+			if (foo < bar) std::cout << "foo is less than bar\n";
+			if (foo > bar) std::cout << "foo is greater than bar\n";
+			if (foo <= bar) std::cout << "foo is less than or equal to bar\n";
+			if (foo >= bar) std::cout << "foo is greater than or equal to bar\n";
+			// foo and bar are not equal, foo is less than bar, foo is less than or equal to bar
+
+			// lexicographical: the first difference decides, then the shorter one is less
+			MySTL::vector<int> a(3, 1), b(4, 1);
+			b[2] = 0;
+			std::cout << (a < b) << (b < a) << (a == a) << (a != a) << (a <= a) << (a >= a) << '\n';	// 011011
+			b[2] = 1;
+			std::cout << (a < b) << (b > a) << (a == b) << '\n';	// 110
+
+			// memcmp looks at unsigned bytes, the element comparison has to stay signed
+			MySTL::vector<signed char> sc(2, 1), sc2(2, 1);
+			sc2[1] = -1;
+			std::cout << (sc2 < sc) << (sc < sc2) << '\n';		// 10
+
+			MySTL::vector<std::string> s1, s2;
+			s1.push_back("apple");
+			s2.push_back("apple");
+			s2.push_back("");
+			std::cout << (s1 < s2) << (s1 == s2) << (s1 != s2) << '\n';	// 101
+		}
+
+
+		// records how elements are relocated when the vector grows
+		struct relocatable
+		{
+			static int copies;
+			static int moves;
+			std::string payload;
+
+			relocatable(const char *s) : payload(s) {}
+			relocatable(const relocatable &x) : payload(x.payload) { ++copies; }
+			relocatable(relocatable &&x) noexcept : payload(std::move(x.payload)) { ++moves; }
+			relocatable& operator=(const relocatable &x) { payload = x.payload; ++copies; return *this; }
+			relocatable& operator=(relocatable &&x) noexcept { payload = std::move(x.payload); ++moves; return *this; }
+		};
+		int relocatable::copies = 0;
+		int relocatable::moves = 0;
+
+		void tc_relocation()
+		{
+			std::cout << "-----\t relocation on growth" << '\n';
+			MySTL::vector<relocatable> v;
+			for (int i = 0; i < 10; ++i)
+				v.push_back("a string long enough to live on the heap");
+
+			relocatable::copies = relocatable::moves = 0;
+			v.reserve(100);
+			std::cout << "reserve: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 0, 10
+
+			relocatable::copies = relocatable::moves = 0;
+			v.resize(200, "x");
+			std::cout << "resize: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 190, 10
+
+			relocatable::copies = relocatable::moves = 0;
+			v.insert(v.begin() + 1, 1000, "y");
+			std::cout << "insert: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 1000, 200
+			std::cout << "size: " << v.size() << ", v[0]: " << v[0].payload << '\n';
+		}
+
+		void tc_move_insert()
+		{
+			std::cout << "-----\t rvalue push_back / insert" << '\n';
+			MySTL::vector<relocatable> v;
+			v.reserve(16);
+
+			relocatable::copies = relocatable::moves = 0;
+			v.push_back(relocatable("pushed"));
+			relocatable r("named");
+			v.push_back(std::move(r));
+			std::cout << "push_back: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 0, 2
+
+			relocatable::copies = relocatable::moves = 0;
+			v.insert(v.begin(), relocatable("front"));
+			std::cout << "insert: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 0, 4
+
+			MySTL::vector<relocatable> w;
+			w.push_back("a");
+			w.push_back("b");
+			w.push_back("c");
+			relocatable::copies = relocatable::moves = 0;
+			v.insert(v.begin() + 1, MySTL::make_move_iterator(w.begin()), MySTL::make_move_iterator(w.end()));
+			std::cout << "range insert: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 0, 5
+
+			relocatable::copies = relocatable::moves = 0;
+			MySTL::vector<relocatable> x(MySTL::make_move_iterator(v.begin()), MySTL::make_move_iterator(v.end()));
+			std::cout << "range constructor: copies " << relocatable::copies << ", moves " << relocatable::moves << '\n';	// 0, 6
+			for (auto &e : x)
+				std::cout << e.payload << ' ';
+			std::cout << '\n';								// front a b c pushed named
+
+			relocatable::copies = relocatable::moves = 0;
+			MySTL::vector<relocatable> y;
+			y = std::move(x);
+			y.push_back("again");							// the moved-from vector gave up its capacity
+			x.push_back("reused");
+			std::cout << "move assign: copies " << relocatable::copies << ", moves " << relocatable::moves
+				<< ", sizes " << x.size() << ' ' << y.size() << '\n';	// 0, 8, sizes 1 7
+		}
+
+		// copies throw once a budget runs out; no noexcept move, so growth has to copy
+		struct throwing_copy
+		{
+			static int budget;
+			static int live;
+			int value;
+
+			throwing_copy(int v) : value(v) { ++live; }
+			throwing_copy(const throwing_copy &x) : value(x.value) { if (budget-- == 0) throw std::runtime_error("copy"); ++live; }
+			throwing_copy& operator=(const throwing_copy &x) { value = x.value; return *this; }
+			~throwing_copy() { --live; }
+		};
+		int throwing_copy::budget = -1;
+		int throwing_copy::live = 0;
+
+		// counts the blocks a vector holds
+		template <typename T>
+		struct block_counting_allocator : public MySTL::allocator<T>
+		{
+			static int blocks;
+			static T* allocate(std::size_t n) { ++blocks; return MySTL::allocator<T>::allocate(n); }
+			static void deallocate(T *p, std::size_t n) { --blocks; MySTL::allocator<T>::deallocate(p, n); }
+		};
+		template <typename T>
+		int block_counting_allocator<T>::blocks = 0;
+
+		void tc_throwing_copy()
+		{
+			std::cout << "-----\t copy that throws during growth" << '\n';
+			typedef MySTL::vector<throwing_copy, block_counting_allocator<throwing_copy> > vec;
+			vec v;
+			v.reserve(5);
+			for (int i = 0; i < 5; ++i)
+				v.push_back(i);
+			const throwing_copy extra(9);
+			const throwing_copy more[] = { 7, 8 };
+
+			const char *steps[] = { "reserve", "resize", "fill insert", "range insert" };
+			for (int step = 0; step < 4; ++step)
+			{
+				throwing_copy::budget = 3;
+				try
+				{
+					switch (step)
+					{
+					case 0: v.reserve(100); break;
+					case 1: v.resize(10, extra); break;
+					case 2: v.insert(v.begin() + 2, 3, extra); break;
+					default: v.insert(v.begin() + 4, more, more + 2); break;
+					}
+				}
+				catch (const std::runtime_error &)
+				{
+					std::cout << steps[step] << " threw: ";
+				}
+				throwing_copy::budget = -1;
+				std::cout << "size " << v.size() << ", capacity " << v.capacity() << ", back " << v.back().value
+					<< ", live " << throwing_copy::live - 3 << ", blocks " << block_counting_allocator<throwing_copy>::blocks << '\n';
+			}
+			// reserve threw: size 5, capacity 5, back 4, live 5, blocks 1
+			// resize threw: size 5, capacity 5, back 4, live 5, blocks 1
+			// fill insert threw: size 5, capacity 5, back 4, live 5, blocks 1
+			// range insert threw: size 5, capacity 5, back 4, live 5, blocks 1
+
+			v.reserve(8);
+			throwing_copy::budget = 3;
+			try
+			{
+				v.shrink_to_fit();
+			}
+			catch (const std::runtime_error &)
+			{
+				std::cout << "shrink_to_fit threw: ";
+			}
+			throwing_copy::budget = -1;
+			std::cout << "size " << v.size() << ", capacity " << v.capacity()
+				<< ", live " << throwing_copy::live - 3 << ", blocks " << block_counting_allocator<throwing_copy>::blocks << '\n';
+			// shrink_to_fit threw: size 5, capacity 8, live 5, blocks 1
+		}
+
+		// capacities a vector goes through while 40 elements are pushed back
+		template <typename GrowthPolicy>
+		void print_capacities()
+		{
+			MySTL::vector<int, MySTL::allocator<int>, GrowthPolicy> v;
+			MySTL::vector<int>::size_type last = 0;
+			for (int i = 0; i < 40; ++i)
+			{
+				v.push_back(i);
+				if (v.capacity() != last)
+					std::cout << (last = v.capacity()) << ' ';
+			}
+			std::cout << "| " << v[0] << ' ' << v[39] << '\n';
+		}
+
+		void tc_growth_policy()
+		{
+			std::cout << "-----\t growth policy" << '\n';
+			print_capacities<MySTL::double_growth>();								// 1 2 4 8 16 32 64 | 0 39
+			print_capacities<MySTL::one_and_half_growth>();							// 1 2 3 4 6 9 13 19 28 42 | 0 39
+			print_capacities<MySTL::size_class_growth<MySTL::one_and_half_growth> >();	// 2 4 6 10 16 24 64 | 0 39
+			print_capacities<MySTL::capped_linear_growth<64, 32> >();					// 1 2 4 8 16 24 32 40 | 0 39
+
+			// insert makes room for the whole range at once
+			MySTL::vector<int, MySTL::allocator<int>, MySTL::one_and_half_growth> v(10, 1);
+			v.insert(v.end(), 20, 2);
+			std::cout << v.size() << ' ' << v.capacity() << '\n';				// 30 30
+		}
+
+		template <typename Vector>
+		void print_all(const Vector &v)
+		{
+			for (auto it = v.begin(); it != v.end(); ++it)
+				std::cout << *it << ' ';
+			std::cout << '\n';
+		}
+
+		void tc_erase_if()
+		{
+			std::cout << "-----\t erase_if / shifting insert and erase" << '\n';
+			// trivially copyable: the tail is shifted by memmove
+			MySTL::vector<int> v;
+			for (int i = 0; i < 10; ++i)
+				v.push_back(i);
+			v.reserve(32);
+			v.insert(v.begin() + 2, 3, 7);
+			print_all(v);									// 0 1 7 7 7 2 3 4 5 6 7 8 9
+			int arr[] = { 10, 11 };
+			v.insert(v.end() - 1, arr, arr + 2);
+			v.erase(v.begin(), v.begin() + 3);
+			print_all(v);									// 7 7 2 3 4 5 6 7 8 10 11 9
+			std::cout << MySTL::erase_if(v, [](int x) { return x % 2 == 0; }) << ' ' << v.size() << '\n';	// 5 7
+			print_all(v);									// 7 7 3 5 7 11 9
+
+			// not trivially copyable: move assignments, gap both shorter and longer than the tail
+			MySTL::vector<std::string> s;
+			s.reserve(16);
+			s.push_back("a");
+			s.push_back("b");
+			s.push_back("c");
+			std::string ins[] = { "x", "y", "z", "w" };
+			s.insert(s.begin() + 2, ins, ins + 4);
+			s.insert(s.begin() + 1, 2, "n");
+			print_all(s);									// a n n b x y z w c
+			s.erase(s.begin() + 1, s.begin() + 4);
+			std::cout << MySTL::erase_if(s, [](const std::string &e) { return e < "x"; }) << ' ';
+			print_all(s);									// 3 x y z
+		}
+
+		// counts default constructions, a non-trivial type still runs its constructor
+		struct counted
+		{
+			counted() : value(7) { ++constructed; }
+			int value;
+			static int constructed;
+		};
+		int counted::constructed = 0;
+
+		void tc_resize_default_init()
+		{
+			std::cout << "-----\t resize_default_init / resize_and_overwrite" << '\n';
+			MySTL::vector<int> v(3, 1);
+			v.resize_default_init(1000);
+			for (int i = 3; i < 1000; ++i)
+				v[i] = i;								// overwritten before being read
+			std::cout << v.size() << ' ' << v[0] << ' ' << v[999] << '\n';	// 1000 1 999
+			v.resize_default_init(2);
+			std::cout << v.size() << ' ' << v[1] << '\n';	// 2 1
+
+			MySTL::vector<char> buf;
+			buf.push_back('>');
+			buf.resize_and_overwrite(64, [](char *p, std::size_t n) {
+				const char msg[] = "read";
+				for (std::size_t i = 0; i != sizeof(msg) - 1 && 1 + i < n; ++i)
+					p[1 + i] = msg[i];
+				return 1 + sizeof(msg) - 1;			// only the written prefix is kept
+			});
+			std::cout << std::string(buf.begin(), buf.end()) << ' ' << buf.size() << ' ' << buf.capacity() << '\n';	// >read 5 64
+
+			MySTL::vector<counted> c;
+			c.resize_default_init(5);
+			std::cout << counted::constructed << ' ' << c[4].value << '\n';	// 5 7
+		}
+
+		void tc_unchecked_append()
+		{
+			std::cout << "-----\t reserve_back / commit_back" << '\n';
+			MySTL::vector<int> v(2, 9);
+			int *w = v.reserve_back(100);
+			std::cout << v.size() << ' ' << (v.capacity() >= 102) << '\n';	// 2 1
+			int k = 0;
+			for (; k < 50; ++k)
+				w[k] = k * k;							// only half of the window is used
+			v.commit_back(k);
+			std::cout << v.size() << ' ' << v[1] << ' ' << v[2] << ' ' << v[51] << '\n';	// 52 9 0 2401
+
+			MySTL::vector<std::string> s;
+			s.reserve(3);
+			s.unchecked_push_back("a");
+			s.unchecked_emplace_back(2, 'b');
+			std::string *ws = s.reserve_back(1);
+			::new (static_cast<void*>(ws)) std::string("c");
+			s.commit_back(1);
+			print_all(s);								// a bb c
+		}
+
+		void tc_parallel()
+		{
+			std::cout << "-----\t parallel construction" << '\n';
+			const MySTL::vector<int>::size_type n = 4 * 1024 * 1024;	// large enough to be split across the pool
+
+			MySTL::vector<int> filled(MySTL::par, n, 7);
+			MySTL::vector<int> copied(MySTL::par, filled);
+			MySTL::vector<int> ranged(MySTL::par, filled.begin(), filled.begin() + 100);
+			MySTL::vector<int> zeros(MySTL::par, n);
+
+			long long sum = 0;
+			for (auto x : copied)
+				sum += x;
+			std::cout << "size: " << copied.size() << ", sum: " << sum << '\n';	// 4194304, 29360128
+			std::cout << "range size: " << ranged.size() << ", zeros back: " << zeros.back() << '\n';
+
+			MySTL::vector<int> assigned;
+			assigned.assign(MySTL::par, n, 3);
+			assigned.assign(MySTL::par, copied.begin(), copied.begin() + 10);
+			std::cout << "assigned contains:";
+			printvector(assigned);
+
+			// process with the same partition that constructed the pages
+			std::atomic<long long> total(0);
+			MySTL::parallel_for(filled.size(), [&](std::size_t b, std::size_t e)
+			{
+				long long s = 0;
+				for (std::size_t i = b; i != e; ++i)
+					s += filled[i];
+				total += s;
+			});
+			std::cout << "parallel_for sum: " << total << '\n';
+		}
+
+
+		void test_all()
+		{
+			std::cout << "----------test vector----------" << std::endl;
+			tc_constructor();
+			tc_assignment();
+			tc_size();
+			tc_empty();
+			tc_resize();
+			tc_reserve();
+			tc_shrink_to_fit();
+			tc_elementAccess();
+			tc_at();
+			tc_front_back();
+			tc_data();
+			tc_assign();
+			tc_push_back();
+			tc_pop_back();
+			tc_insert();
+			tc_empty_insert();
+			tc_erase();
+			tc_swap();
+			tc_clear();
+			tc_emplace();
+			tc_emplace_back();
+			//tc_get_allocator();
+			tc_relationalOperators();
+			tc_relocation();
+			tc_move_insert();
+			tc_throwing_copy();
+			tc_growth_policy();
+			tc_erase_if();
+			tc_resize_default_init();
+			tc_unchecked_append();
+			tc_parallel();
+			std::cout << "----------test vector success----------\n" << std::endl;
+		}
+
+	}
+}
+
@@ -1,20 +1,107 @@
-#define  _SCL_SECURE_NO_WARNINGS
-#define D_SCL_SECURE_NO_WARNINGS
-//#define _ITERATOR_DEBUG_LEVEL 0
-#pragma warning(disable:4996)
-
-
-#include "TestCase/test_allocator.h"
-#include "TestCase/test_vector.h"
-
-using namespace MySTL;
-
-int main()
-{
-	MySTL::TestAllocator::tc_allocator();
-	MySTL::TestVector::test_all();
-
-
-	system("pause");
-	return 0;
-}
+#define  _SCL_SECURE_NO_WARNINGS
+#define D_SCL_SECURE_NO_WARNINGS
+//#define _ITERATOR_DEBUG_LEVEL 0
+#pragma warning(disable:4996)
+
+
+#include "TestCase/test_allocator.h"
+#include "TestCase/test_uninitialized_functions.h"
+#include "TestCase/test_algorithm.h"
+#include "TestCase/test_vector.h"
+#include "TestCase/test_string.h"
+#include "TestCase/test_small_vector.h"
+#include "TestCase/test_soa_vector.h"
+#include "TestCase/test_segmented_vector.h"
+#include "TestCase/test_mmap_vector.h"
+#include "TestCase/test_binary_io.h"
+#include "TestCase/test_bit_vector.h"
+#include "TestCase/test_compressed_int_vector.h"
+#include "TestCase/test_inplace_vector.h"
+#include "TestCase/test_concurrent_vector.h"
+#include "TestCase/test_flat_map.h"
+#include "TestCase/test_hash_map.h"
+#include "TestCase/test_cow_vector.h"
+#include "TestCase/test_persistent_vector.h"
+
+// define BENCHMARK to run the benchmarks after the test cases (use a Release build)
+//#define BENCHMARK
+#ifdef BENCHMARK
+#include "Benchmark/bench_uninitialized_copy.h"
+#include "Benchmark/bench_parallel_uninitialized.h"
+#include "Benchmark/bench_contiguous_dispatch.h"
+#include "Benchmark/bench_growth_policy.h"
+#include "Benchmark/bench_small_vector.h"
+#include "Benchmark/bench_emplace.h"
+#include "Benchmark/bench_move_insert.h"
+#include "Benchmark/bench_erase.h"
+#include "Benchmark/bench_resize_default_init.h"
+#include "Benchmark/bench_unchecked_append.h"
+#include "Benchmark/bench_vector_compare.h"
+#include "Benchmark/bench_soa_vector.h"
+#include "Benchmark/bench_segmented_vector.h"
+#include "Benchmark/bench_mmap_vector.h"
+#include "Benchmark/bench_binary_io.h"
+#include "Benchmark/bench_bit_vector.h"
+#include "Benchmark/bench_compressed_int_vector.h"
+#include "Benchmark/bench_inplace_vector.h"
+#include "Benchmark/bench_concurrent_vector.h"
+#include "Benchmark/bench_flat_map.h"
+#include "Benchmark/bench_hash_map.h"
+#include "Benchmark/bench_cow_vector.h"
+#include "Benchmark/bench_persistent_vector.h"
+#endif
+
+using namespace MySTL;
+
+int main()
+{
+	MySTL::TestAllocator::tc_allocator();
+	MySTL::TestAllocator::tc_destroy();
+	MySTL::TestUninitialized::test_all();
+	MySTL::TestAlgorithm::test_all();
+	MySTL::TestVector::test_all();
+	MySTL::TestString::test_all();
+	MySTL::TestSmallVector::test_all();
+	MySTL::TestSoaVector::test_all();
+	MySTL::TestSegmentedVector::test_all();
+	MySTL::TestMmapVector::test_all();
+	MySTL::TestBinaryIO::test_all();
+	MySTL::TestBitVector::test_all();
+	MySTL::TestCompressedIntVector::test_all();
+	MySTL::TestInplaceVector::test_all();
+	MySTL::TestConcurrentVector::test_all();
+	MySTL::TestFlatMap::test_all();
+	MySTL::TestHashMap::test_all();
+	MySTL::TestCowVector::test_all();
+	MySTL::TestPersistentVector::test_all();
+
+#ifdef BENCHMARK
+	MySTL::BenchUninitializedCopy::bench_all();
+	MySTL::BenchParallelUninitialized::bench_all();
+	MySTL::BenchContiguousDispatch::bench_all();
+	MySTL::BenchGrowthPolicy::bench_all();
+	MySTL::BenchSmallVector::bench_all();
+	MySTL::BenchEmplace::bench_all();
+	MySTL::BenchMoveInsert::bench_all();
+	MySTL::BenchErase::bench_all();
+	MySTL::BenchResizeDefaultInit::bench_all();
+	MySTL::BenchUncheckedAppend::bench_all();
+	MySTL::BenchVectorCompare::bench_all();
+	MySTL::BenchSoaVector::bench_all();
+	MySTL::BenchSegmentedVector::bench_all();
+	MySTL::BenchMmapVector::bench_all();
+	MySTL::BenchBinaryIO::bench_all();
+	MySTL::BenchBitVector::bench_all();
+	MySTL::BenchCompressedIntVector::bench_all();
+	MySTL::BenchInplaceVector::bench_all();
+	MySTL::BenchConcurrentVector::bench_all();
+	MySTL::BenchFlatMap::bench_all();
+	MySTL::BenchHashMap::bench_all();
+	MySTL::BenchCowVector::bench_all();
+	MySTL::BenchPersistentVector::bench_all();
+#endif
+
+
+	system("pause");
+	return 0;
+}